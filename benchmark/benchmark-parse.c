@@ -0,0 +1,117 @@
+/**
+ * @file
+ *
+ * Benchmarks bulk parsing of RA/Dec columns from CSV tables, as for ingesting large catalogs.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ */
+
+#if __STDC_VERSION__ < 201112L
+#  define _POSIX_C_SOURCE 199309      ///< struct timespec
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include <string.h>
+
+#include <novas.h>      ///< SuperNOVAS functions and definitions
+
+#define  LEAP_SECONDS     37        ///< [s] current leap seconds from IERS Bulletin C
+#define  DUT1             0.114     ///< [s] current UT1 - UTC time difference from IERS Bulletin A
+#define  ROW_LEN          64        ///< Maximum length of generated CSV rows
+#define  CHUNK_SIZE       65536     ///< [bytes] Chunk size for streaming parse
+
+static void timestamp(novas_timespec *t) {
+  novas_set_current_time(LEAP_SECONDS, DUT1, t);
+}
+
+int main(int argc, const char *argv[]) {
+  char *csv, *row;
+  double *ra, *dec;
+  size_t len = 0;
+  novas_timespec start, end;
+  int i, n, N = 1000000;
+
+  if(argc > 1) N = (int) strtol(argv[1], NULL, 10);
+
+  if(N < 1) {
+    fprintf(stderr, "ERROR! invalid row count: %d\n", N);
+    return 1;
+  }
+
+  csv = (char *) malloc((size_t) N * ROW_LEN + 1);
+  ra = (double *) calloc(N, sizeof(double));
+  dec = (double *) calloc(N, sizeof(double));
+
+  if(!csv || !ra || !dec) {
+    fprintf(stderr, "ERROR! alloc %d rows: %s\n", N, strerror(errno));
+    return 1;
+  }
+
+  // -------------------------------------------------------------------------
+  // Generate a CSV table with random sexagesimal coordinates
+  fprintf(stderr, "Generating %d rows...\n", N);
+
+  for(i = 0; i < N; i++) {
+    int h = rand() % 24, m = rand() % 60, d = rand() % 90, dm = rand() % 60;
+    double s = (60.0 * rand()) / (RAND_MAX + 1.0), ds = (60.0 * rand()) / (RAND_MAX + 1.0);
+
+    len += sprintf(&csv[len], "%d,%02d:%02d:%06.3f,%c%02d:%02d:%05.2f,%.2f\n", i, h, m, s, (rand() & 1) ? '-' : '+',
+            d, dm, ds, (20.0 * rand()) / RAND_MAX);
+  }
+
+  // -------------------------------------------------------------------------
+  // Start benchmarks...
+  fprintf(stderr, "Starting single-thread benchmarks...\n");
+
+  // -------------------------------------------------------------------------
+  // Benchmark bulk parse of entire table
+  timestamp(&start);
+  n = novas_parse_radec_table(csv, len, ',', 1, 2, ra, dec, N, NULL);
+  timestamp(&end);
+  if(n != N) {
+    fprintf(stderr, "ERROR! parsed %d rows, expected %d\n", n, N);
+    return 1;
+  }
+  printf(" - novas_parse_radec_table(), entire table:       %12.1f rows/sec\n", N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark streaming bulk parse, in fixed-size chunks
+  timestamp(&start);
+  for(n = 0, row = csv; row < &csv[len];) {
+    size_t used = 0, chunk = &csv[len] - row;
+    if(chunk > CHUNK_SIZE) chunk = CHUNK_SIZE;
+    n += novas_parse_radec_table(row, chunk, ',', 1, 2, &ra[n], &dec[n], N - n, &used);
+    if(!used) break;
+    row += used;
+  }
+  timestamp(&end);
+  printf(" - novas_parse_radec_table(), %d-byte chunks:  %12.1f rows/sec\n", CHUNK_SIZE,
+          N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark row-by-row parse, with the generic single-value parsers (on NUL-terminated lines)
+  timestamp(&start);
+  for(i = 0, row = csv; i < N; i++) {
+    char line[ROW_LEN], *tail, *eol = strchr(row, '\n');
+
+    memcpy(line, row, eol - row);
+    line[eol - row] = '\0';
+    row = eol + 1;
+
+    tail = strchr(line, ',') + 1;
+    ra[i] = novas_parse_hours(tail, &tail);
+    dec[i] = novas_parse_degrees(tail + 1, &tail);
+  }
+  timestamp(&end);
+  printf(" - novas_parse_hours() / novas_parse_degrees():   %12.1f rows/sec\n", N / novas_diff_time(&end, &start));
+
+  free(csv);
+  free(ra);
+  free(dec);
+
+  return 0;
+}
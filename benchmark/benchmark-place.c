@@ -39,6 +39,18 @@ static void calc_pos(const cat_entry *star, const novas_frame *frame) {
   }
 }
 
+static void calc_geom(const cat_entry *star, const novas_frame *frame) {
+  object source = NOVAS_OBJECT_INIT;
+  double pos[3], vel[3];
+
+  make_cat_object(star, &source);
+
+  if(novas_geom_posvel(&source, frame, NOVAS_ICRS, pos, vel) != 0) {
+    fprintf(stderr, "ERROR! failed to calculate geometric position.\n");
+    exit(1);
+  }
+}
+
 
 static void calc_place(const cat_entry *star, const novas_frame *frame) {
   const novas_timespec *time = &frame->time;
@@ -57,10 +69,13 @@ int main(int argc, const char *argv[]) {
   observer obs;                     // observer location
   novas_timespec obs_time;          // astrometric time of observation
   novas_frame obs_frame;            // observing frame defined for observing time and location
+  novas_field_transform field;      // field-local transform for stars in a small field
 
 
   // Intermediate variables we'll use -------------------------------------->
   novas_timespec start, end;        // timestamps for execution time
+  double *ra, *dec;                 // [h, deg] star positions in a small field
+  float *x, *y, *z, *az, *el;       // single-precision unit vectors and horizontal positions
 
 
   // Other variables we need ----------------------------------------------->
@@ -76,7 +91,14 @@ int main(int argc, const char *argv[]) {
   }
 
   stars = (cat_entry *) calloc(N, sizeof(cat_entry));
-  if(!stars) {
+  ra = (double *) calloc(N, sizeof(double));
+  dec = (double *) calloc(N, sizeof(double));
+  x = (float *) calloc(N, sizeof(float));
+  y = (float *) calloc(N, sizeof(float));
+  z = (float *) calloc(N, sizeof(float));
+  az = (float *) calloc(N, sizeof(float));
+  el = (float *) calloc(N, sizeof(float));
+  if(!stars || !ra || !dec || !x || !y || !z || !az || !el) {
     fprintf(stderr, "ERROR! alloc %d stars: %s\n", N, strerror(errno));
     return 1;
   }
@@ -151,6 +173,45 @@ int main(int argc, const char *argv[]) {
   printf(" - novas_sky_pos(), same frame, red. acc.:        %12.1f positions/sec\n",
           N / novas_diff_time(&end, &start));
 
+  // -------------------------------------------------------------------------
+  // Benchmark field-local transform, for stars within a 1 degree field, reduced accuracy
+  for(i = 0; i < N; i++) {
+    ra[i] = stars[0].ra + (0.1 * rand()) / RAND_MAX - 0.05;
+    dec[i] = 0.5 * (2.0 * rand() / RAND_MAX - 1.0);
+  }
+
+  timestamp(&start);
+  novas_make_field_transform(&obs_frame, NOVAS_TOD, stars[0].ra, 0.0, 1.0, &field);
+  novas_field_apply(&field, N, ra, dec, ra, dec);
+  timestamp(&end);
+  printf(" - novas_field_apply(), 1 deg field, red. acc.:   %12.1f positions/sec (%.1g arcsec)\n",
+          N / novas_diff_time(&end, &start), field.error);
+
+  // -------------------------------------------------------------------------
+  // Benchmark single-precision horizontal positions, with aberration and refraction
+  for(i = 0; i < N; i++) {
+    double pos[3];
+    radec2vector(stars[i].ra, stars[i].dec, 1.0, pos);
+    x[i] = (float) pos[0];
+    y[i] = (float) pos[1];
+    z[i] = (float) pos[2];
+  }
+
+  timestamp(&start);
+  novas_hor_positions_f32(&obs_frame, N, x, y, z, novas_standard_refraction, az, el);
+  timestamp(&end);
+  printf(" - novas_hor_positions_f32(), red. acc.:          %12.1f positions/sec\n",
+          N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark fast accuracy, same frame
+  obs_frame.accuracy = NOVAS_FAST_ACCURACY;
+  timestamp(&start);
+  for(i = 0; i < N; i++) calc_pos(&stars[i], &obs_frame);
+  timestamp(&end);
+  printf(" - novas_sky_pos(), same frame, fast acc.:        %12.1f positions/sec\n",
+          N / novas_diff_time(&end, &start));
+
   // -------------------------------------------------------------------------
   // Benchmark full accuracy, same frame
   obs_frame.accuracy = NOVAS_FULL_ACCURACY;
@@ -184,6 +245,18 @@ int main(int argc, const char *argv[]) {
   // benchmark over fewer iterations
   N /= 10;
 
+  // -------------------------------------------------------------------------
+  // Benchmark fast accuracy, individual fames
+  timestamp(&start);
+  for(i = 0; i < N2; i++) {
+    novas_set_time(NOVAS_TT, novas_get_time(&start, NOVAS_TT) + i, LEAP_SECONDS, DUT1, &obs_time);
+    novas_make_frame(NOVAS_FAST_ACCURACY, &obs, &obs_time, POLAR_DX, POLAR_DY, &obs_frame);
+    calc_pos(&stars[i], &obs_frame);
+  }
+  timestamp(&end);
+  printf(" - novas_sky_pos, individual, fast acc.:          %12.1f positions/sec\n",
+          N2 / novas_diff_time(&end, &start));
+
   // -------------------------------------------------------------------------
   // Benchmark reduced accuracy, individual fames
   timestamp(&start);
@@ -196,6 +269,42 @@ int main(int argc, const char *argv[]) {
   printf(" - novas_sky_pos, individual, red. acc.:          %12.1f positions/sec\n",
           N2 / novas_diff_time(&end, &start));
 
+  // -------------------------------------------------------------------------
+  // Benchmark reduced accuracy, individual lazy fames
+  timestamp(&start);
+  for(i = 0; i < N2; i++) {
+    novas_set_time(NOVAS_TT, novas_get_time(&start, NOVAS_TT) + i, LEAP_SECONDS, DUT1, &obs_time);
+    novas_make_lazy_frame(NOVAS_REDUCED_ACCURACY, &obs, &obs_time, POLAR_DX, POLAR_DY, &obs_frame);
+    calc_pos(&stars[i], &obs_frame);
+  }
+  timestamp(&end);
+  printf(" - novas_sky_pos, individual lazy, red. acc.:     %12.1f positions/sec\n",
+          N2 / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark geometric ICRS positions, reduced accuracy, individual fames
+  timestamp(&start);
+  for(i = 0; i < N2; i++) {
+    novas_set_time(NOVAS_TT, novas_get_time(&start, NOVAS_TT) + i, LEAP_SECONDS, DUT1, &obs_time);
+    novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &obs_time, POLAR_DX, POLAR_DY, &obs_frame);
+    calc_geom(&stars[i], &obs_frame);
+  }
+  timestamp(&end);
+  printf(" - novas_geom_posvel, individual, red. acc.:      %12.1f positions/sec\n",
+          N2 / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark geometric ICRS positions, reduced accuracy, individual lazy fames
+  timestamp(&start);
+  for(i = 0; i < N2; i++) {
+    novas_set_time(NOVAS_TT, novas_get_time(&start, NOVAS_TT) + i, LEAP_SECONDS, DUT1, &obs_time);
+    novas_make_lazy_frame(NOVAS_REDUCED_ACCURACY, &obs, &obs_time, POLAR_DX, POLAR_DY, &obs_frame);
+    calc_geom(&stars[i], &obs_frame);
+  }
+  timestamp(&end);
+  printf(" - novas_geom_posvel, individual lazy, red. acc.: %12.1f positions/sec\n",
+          N2 / novas_diff_time(&end, &start));
+
   // -------------------------------------------------------------------------
   // Benchmark full accuracy, individual frames
   timestamp(&start);
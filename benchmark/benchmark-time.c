@@ -0,0 +1,199 @@
+/**
+ * @file
+ *
+ * Benchmarks bulk parsing and printing of ISO 8601 timestamps, as for processing logs or
+ * telemetry, bulk conversion of TT-based times to TDB, TCB, and TCG, e.g. for pulsar timing, and
+ * sidereal time in a 1 kHz control loop.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ */
+
+#if __STDC_VERSION__ < 201112L
+#  define _POSIX_C_SOURCE 199309      ///< struct timespec
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include <string.h>
+
+#include <novas.h>      ///< SuperNOVAS functions and definitions
+
+#define  LEAP_SECONDS     37        ///< [s] current leap seconds from IERS Bulletin C
+#define  DUT1             0.114     ///< [s] current UT1 - UTC time difference from IERS Bulletin A
+#define  STAMP_LEN        32        ///< Storage size of each timestamp string
+#define  TDB_DAYS         3652.5    ///< [day] Time range for TT to TDB conversions
+
+static void timestamp(novas_timespec *t) {
+  novas_set_current_time(LEAP_SECONDS, DUT1, t);
+}
+
+int main(int argc, const char *argv[]) {
+  char *buf;
+  const char **str;
+  novas_timespec *times, start, end;
+  novas_tdb_table table = NOVAS_TDB_TABLE_INIT;
+  long *ijd;
+  double *fjd, *out;
+  novas_ns_time *ns;
+  novas_sidereal_clock clock;
+  on_surface site = ON_SURFACE_INIT;
+  double lst = 0.0;
+  int i, N = 1000000;
+
+  if(argc > 1) N = (int) strtol(argv[1], NULL, 10);
+
+  if(N < 1) {
+    fprintf(stderr, "ERROR! invalid timestamp count: %d\n", N);
+    return 1;
+  }
+
+  buf = (char *) malloc((size_t) N * STAMP_LEN);
+  str = (const char **) calloc(N, sizeof(char *));
+  times = (novas_timespec *) calloc(N, sizeof(novas_timespec));
+  ijd = (long *) calloc(N, sizeof(long));
+  fjd = (double *) calloc(N, sizeof(double));
+  out = (double *) calloc(N, sizeof(double));
+  ns = (novas_ns_time *) calloc(N, sizeof(novas_ns_time));
+
+  if(!buf || !str || !times || !ijd || !fjd || !out || !ns) {
+    fprintf(stderr, "ERROR! alloc %d timestamps: %s\n", N, strerror(errno));
+    return 1;
+  }
+
+  // -------------------------------------------------------------------------
+  // Generate timestamps, one every ~100 ms starting at J2000
+  fprintf(stderr, "Generating %d timestamps...\n", N);
+
+  for(i = 0; i < N; i++) {
+    str[i] = &buf[(long) i * STAMP_LEN];
+    novas_set_time(NOVAS_UTC, NOVAS_JD_J2000 + 1e-1 * i / NOVAS_DAY, LEAP_SECONDS, DUT1, &times[i]);
+  }
+
+  // Random TT dates over a decade, for the TDB conversions
+  for(i = 0; i < N; i++) {
+    double dt = TDB_DAYS * rand() / (RAND_MAX + 1.0);
+    ijd[i] = 2451545L + (long) dt;
+    fjd[i] = dt - (long) dt;
+    ns[i] = (novas_ns_time) (dt * NOVAS_DAY * 1e9);
+  }
+
+  // -------------------------------------------------------------------------
+  // Start benchmarks...
+  fprintf(stderr, "Starting single-thread benchmarks...\n");
+
+  // -------------------------------------------------------------------------
+  // Benchmark bulk printing of timestamps
+  timestamp(&start);
+  novas_iso_timestamps(times, N, buf, STAMP_LEN);
+  timestamp(&end);
+  printf(" - novas_iso_timestamps():        %12.1f timestamps/sec\n", N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark printing timestamps one at a time
+  timestamp(&start);
+  for(i = 0; i < N; i++)
+    novas_iso_timestamp(&times[i], &buf[(long) i * STAMP_LEN], STAMP_LEN);
+  timestamp(&end);
+  printf(" - novas_iso_timestamp():         %12.1f timestamps/sec\n", N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark bulk parsing of timestamps
+  timestamp(&start);
+  i = novas_parse_iso_times(str, N, NOVAS_UTC, LEAP_SECONDS, DUT1, times);
+  timestamp(&end);
+  if(i != N) {
+    fprintf(stderr, "ERROR! parsed %d timestamps, expected %d\n", i, N);
+    return 1;
+  }
+  printf(" - novas_parse_iso_times():       %12.1f timestamps/sec\n", N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark parsing timestamps one at a time
+  timestamp(&start);
+  for(i = 0; i < N; i++)
+    novas_set_time(NOVAS_UTC, novas_parse_iso_date(str[i], NULL), LEAP_SECONDS, DUT1, &times[i]);
+  timestamp(&end);
+  printf(" - novas_parse_iso_date():        %12.1f timestamps/sec\n", N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark creating a decade-long TDB table
+  timestamp(&start);
+  novas_make_tdb_table(NOVAS_JD_J2000, TDB_DAYS, 0.0, &table);
+  timestamp(&end);
+  printf(" - novas_make_tdb_table():        %12.1f ms for %g days (max error %.1e s)\n",
+          1e3 * novas_diff_time(&end, &start), TDB_DAYS, table.max_error);
+
+  // -------------------------------------------------------------------------
+  // Benchmark bulk TT to TDB / TCB conversion
+  timestamp(&start);
+  novas_convert_tt_times(&table, N, ijd, fjd, NOVAS_TDB, out);
+  timestamp(&end);
+  printf(" - novas_convert_tt_times() TDB:  %12.1f times/sec\n", N / novas_diff_time(&end, &start));
+
+  timestamp(&start);
+  novas_convert_tt_times(&table, N, ijd, fjd, NOVAS_TCB, out);
+  timestamp(&end);
+  printf(" - novas_convert_tt_times() TCB:  %12.1f times/sec\n", N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark TT to TDB one at a time, from the full series or the truncated one
+  timestamp(&start);
+  for(i = 0; i < N; i++)
+    out[i] = fjd[i] + tt2tdb_hp(ijd[i] + fjd[i]) / NOVAS_DAY;
+  timestamp(&end);
+  printf(" - tt2tdb_hp():                   %12.1f times/sec\n", N / novas_diff_time(&end, &start));
+
+  timestamp(&start);
+  for(i = 0; i < N; i++)
+    out[i] = fjd[i] + tt2tdb(ijd[i] + fjd[i]) / NOVAS_DAY;
+  timestamp(&end);
+  printf(" - tt2tdb():                      %12.1f times/sec\n", N / novas_diff_time(&end, &start));
+
+  // -------------------------------------------------------------------------
+  // Benchmark bulk conversion of nanosecond times
+  timestamp(&start);
+  novas_convert_ns_times(&table, N, ns, NOVAS_TDB, ns);
+  timestamp(&end);
+  printf(" - novas_convert_ns_times() TDB:  %12.1f times/sec\n", N / novas_diff_time(&end, &start));
+
+  timestamp(&start);
+  novas_convert_ns_times(NULL, N, ns, NOVAS_UTC, ns);
+  timestamp(&end);
+  printf(" - novas_convert_ns_times() UTC:  %12.1f times/sec\n", N / novas_diff_time(&end, &start));
+
+  novas_free_tdb_table(&table);
+
+  // -------------------------------------------------------------------------
+  // Benchmark LST in a 1 kHz control loop, with a sidereal clock or with full calculations
+  novas_init_sidereal_clock(&times[0], &site, NOVAS_FULL_ACCURACY, 0.0, &clock);
+  timestamp(&start);
+  for(i = 0; i < N; i++)
+    lst += novas_advance_sidereal_clock(&clock, 1e-3);
+  timestamp(&end);
+  printf(" - novas_advance_sidereal_clock():%12.1f LSTs/sec\n", N / novas_diff_time(&end, &start));
+
+  timestamp(&start);
+  for(i = 0; i < N; i++) {
+    novas_timespec t;
+    novas_offset_time(&times[0], 1e-3 * i, &t);
+    lst += novas_time_lst(&t, site.longitude, NOVAS_FULL_ACCURACY);
+  }
+  timestamp(&end);
+  printf(" - novas_time_lst():              %12.1f LSTs/sec\n", N / novas_diff_time(&end, &start));
+
+  if(lst < 0.0)
+    fprintf(stderr, "ERROR! negative LST\n");
+
+  free(buf);
+  free(str);
+  free(times);
+  free(ijd);
+  free(fjd);
+  free(out);
+  free(ns);
+
+  return 0;
+}
@@ -0,0 +1,27 @@
+# CMake script to generate an amalgamated SuperNOVAS source file, which
+# concatenates the core library sources into a single translation unit, so
+# that the compiler may inline across modules even without link-time
+# optimization.
+#
+# Usage:
+#
+#    $ cmake -DOUTPUT=<file> -DSOURCE_DIR=<dir> -DSOURCES="<src1>|<src2>|..." \
+#        -P amalgamate.cmake
+#
+# The sources are listed relative to SOURCE_DIR, separated by '|'.
+#
+# Author: Attila Kovacs
+
+string(REPLACE "|" ";" SOURCES "${SOURCES}")
+
+file(WRITE ${OUTPUT}
+    "/*\n"
+    " * Amalgamated SuperNOVAS core sources, for building the library as a single translation unit.\n"
+    " * This file is generated automatically. Do not edit.\n"
+    " */\n"
+)
+
+foreach(SOURCE ${SOURCES})
+    file(READ ${SOURCE_DIR}/${SOURCE} CONTENT)
+    file(APPEND ${OUTPUT} "#line 1 \"${SOURCE}\"\n${CONTENT}")
+endforeach()
@@ -49,6 +49,18 @@ CFLAGS ?= -g -Os -Wall
 #READEPH_SOURCE = legacy/readeph0.c
 
 
+# Whether to enable multithreaded processing in the core library (e.g. for
+# catalog cross-matching) via POSIX threads (pthread). Enabled by default, 
+# same as the ENABLE_THREADS option of the CMake build. Set to 0 to disable.
+THREADS_SUPPORT ?= 1
+
+
+# Whether to enable the built-in instrumentation counters and timers for the
+# hot paths of the library (see novas_get_profile()). It adds some overhead,
+# and so it is meant for profiling builds only.
+#PROFILE_SUPPORT = 1
+
+
 # Whether or not to build solsys-calceph libraries. You need the calceph 
 # development libraries (libcalceph.so and/or libcaclceph.a) installed in
 # LD_LIBRARY_PATH, and calceph.h in /usr/include or some other accessible
@@ -104,6 +116,17 @@ ifdef THREAD_LOCAL
   CPPFLAGS += -DTHREAD_LOCAL=\"$(THREAD_LOCAL)\"
 endif
 
+# Whether to use POSIX threads for multithreaded processing in core
+ifeq ($(THREADS_SUPPORT),1)
+  CPPFLAGS += -DSUPERNOVAS_USE_PTHREAD
+  LDFLAGS += -lpthread
+endif
+
+# Whether to enable hot-path instrumentation counters and timers
+ifeq ($(PROFILE_SUPPORT),1)
+  CPPFLAGS += -DNOVAS_PROFILE
+endif
+
 # Whether to use user-provided legacy `solarsystem()` / `solarsystem_hp()` 
 # functions as the  default planetary ephemeris provider.
 ifdef SOLSYS_SOURCE
@@ -178,7 +201,10 @@ SOURCES = $(SRC)/target.c $(SRC)/observer.c $(SRC)/earth.c $(SRC)/equator.c $(SR
           $(SRC)/transform.c $(SRC)/cio.c $(SRC)/orbital.c $(SRC)/spectral.c $(SRC)/grav.c \
           $(SRC)/nutation.c $(SRC)/timescale.c $(SRC)/frames.c $(SRC)/place.c $(SRC)/calendar.c  \
           $(SRC)/refract.c $(SRC)/naif.c $(SRC)/parse.c $(SRC)/util.c $(SRC)/planets.c \
-          $(SRC)/itrf.c $(SRC)/ephemeris.c $(SRC)/solsys3.c $(SRC)/solsys-ephem.c
+          $(SRC)/itrf.c $(SRC)/ephemeris.c $(SRC)/solsys3.c $(SRC)/solsys-ephem.c \
+          $(SRC)/events.c $(SRC)/grid.c $(SRC)/field.c $(SRC)/skyindex.c \
+          $(SRC)/xmatch.c $(SRC)/starcat.c $(SRC)/leap.c $(SRC)/eop.c $(SRC)/context.c $(SRC)/simd.c \
+          $(SRC)/profile.c
 
 # Generate a list of object (obj/*.o) files from the input sources
 OBJECTS := $(subst $(SRC),$(OBJ),$(SOURCES))
@@ -114,6 +114,8 @@
 #  ifdef NOVAS_NAMESPACE
 namespace novas {
 #  endif
+
+extern "C" {
 #endif
 
 // Doxygen topical sections (ordered)
@@ -856,7 +858,14 @@ enum novas_accuracy {
 
   /// Calculate with truncated terms. It can be significantly faster if a few milliarcsecond
   /// accuracy is sufficient.
-  NOVAS_REDUCED_ACCURACY
+  NOVAS_REDUCED_ACCURACY,
+
+  /// Calculate with a trimmed pipeline, to ~1 arcsec accuracy, e.g. for coarse scheduling. It
+  /// uses a short nutation series, single-pass light-time, deflection by the Sun only, and
+  /// first-order aberration. It is supported by novas_make_frame() and the frame-based
+  /// functions (and by nutation_angles()), but not by the lower-level functions of the library.
+  /// @since 1.6
+  NOVAS_FAST_ACCURACY
 };
 
 /**
@@ -1753,12 +1762,18 @@ typedef struct novas_planet_bundle {
  * should always be initialized by an appropriate call to novas_make_frame(). After that you
  * may change the observer location, if need be, with novas_change_observer().
  *
+ * Frames created by novas_make_lazy_frame() are updated with the deferred components on first
+ * use, including by functions that take a `const novas_frame *` argument. Call
+ * novas_frame_evaluate() on them before placing them in read-only storage or sharing them among
+ * threads in builds without POSIX threads support.
+ *
  * The structure may expand with additional field in the future. Thus neither its size nor its
  * particular layout should be assumed fixed over SuperNOVAS releases.
  *
  * @since 1.1
  *
- * @sa novas_make_frame(), novas_change_observer(), novas_make_transform(), NOVAS_FRAME_INIT
+ * @sa novas_make_frame(), novas_make_lazy_frame(), novas_change_observer(), novas_make_transform(),
+ *     NOVAS_FRAME_INIT
  * @sa novas_sky_pos(), novas_geom_posvel(), novas_geom_to_app(), novas_app_to_geom(),
  *     novas_app_to_hor(), novas_hor_to_app(), novas_rises_above(), novas_sets_below(),
  *     novas_transit_time()
@@ -1914,6 +1929,690 @@ typedef struct novas_track {
  */
 #define NOVAS_TRACK_INIT { NOVAS_TIMESPEC_INIT, NOVAS_OBSERVABLE_INIT, NOVAS_OBSERVABLE_INIT, NOVAS_OBSERVABLE_INIT }
 
+/**
+ * Types of events that novas_find_events() can locate. The values are bit flags, which may be
+ * combined to search for several types of events at once.
+ *
+ * @since 1.6
+ *
+ * @sa novas_find_events(), novas_event, NOVAS_EVENT_CROSSING, NOVAS_EVENT_EXTREMUM, NOVAS_EVENT_ANY
+ * @ingroup time
+ */
+enum novas_event_type {
+  NOVAS_EVENT_RISING = 1,       ///< Observable crosses the search level while increasing
+  NOVAS_EVENT_FALLING = 2,      ///< Observable crosses the search level while decreasing
+  NOVAS_EVENT_MAXIMUM = 4,      ///< Observable reaches a local maximum
+  NOVAS_EVENT_MINIMUM = 8       ///< Observable reaches a local minimum
+};
+
+/**
+ * Search for both rising and falling crossings of the search level.
+ *
+ * @since 1.6
+ * @sa enum novas_event_type
+ * @ingroup time
+ */
+#define NOVAS_EVENT_CROSSING      (NOVAS_EVENT_RISING | NOVAS_EVENT_FALLING)
+
+/**
+ * Search for both local maxima and minima.
+ *
+ * @since 1.6
+ * @sa enum novas_event_type
+ * @ingroup time
+ */
+#define NOVAS_EVENT_EXTREMUM      (NOVAS_EVENT_MAXIMUM | NOVAS_EVENT_MINIMUM)
+
+/**
+ * Search for all types of events.
+ *
+ * @since 1.6
+ * @sa enum novas_event_type
+ * @ingroup time
+ */
+#define NOVAS_EVENT_ANY           (NOVAS_EVENT_CROSSING | NOVAS_EVENT_EXTREMUM)
+
+/**
+ * Function type for an observable quantity that can be evaluated for an observing frame, and
+ * whose crossings and extrema may be located via novas_find_events().
+ *
+ * @param frame     Observing frame, defining the observer location and time of observation.
+ * @param arg       Optional argument(s) to the observable, such as the observed source(s).
+ * @return          The value of the observable, or else NAN if it could not be evaluated
+ *                  (errno should be set to indicate the type of error).
+ *
+ * @since 1.6
+ *
+ * @sa novas_find_events(), novas_event_finder, novas_event_elevation(), novas_event_sun_angle(),
+ *     novas_event_moon_angle(), novas_event_separation(), novas_event_moon_phase(),
+ *     novas_event_solar_illum()
+ * @ingroup time
+ */
+typedef double (*novas_event_observable)(const novas_frame *restrict frame, const void *restrict arg);
+
+/**
+ * Parameters for locating events via novas_find_events().
+ *
+ * @since 1.6
+ *
+ * @sa novas_find_events(), NOVAS_EVENT_FINDER_INIT
+ * @ingroup time
+ */
+typedef struct novas_event_finder {
+  novas_event_observable func;  ///< The observable function
+  const void *arg;              ///< Argument(s) to pass to the observable function.
+  double level;                 ///< The level whose crossings are to be located
+  double period;                ///< Period of wrapping observables (e.g. 360.0 for angles), or 0 if not periodic.
+  int types;                    ///< Bitwise OR of the types of events to locate (see enum novas_event_type)
+  double step;                  ///< [day] Sampling step, which should be shorter than the spacing of events.
+  double tol;                   ///< [s] Time tolerance of the refined events, or 0 to use the default (1 ms).
+} novas_event_finder;
+
+/**
+ * Default initializer for novas_event_finder, for locating all events at an hourly sampling, and
+ * at the default (1 ms) precision.
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_event_finder
+ * @ingroup time
+ */
+#define NOVAS_EVENT_FINDER_INIT { NULL, NULL, 0.0, 0.0, NOVAS_EVENT_ANY, 1.0 / 24.0, 0.0 }
+
+/**
+ * An event located by novas_find_events().
+ *
+ * @since 1.6
+ *
+ * @sa novas_find_events(), NOVAS_EVENT_INIT
+ * @ingroup time
+ */
+typedef struct novas_event {
+  enum novas_event_type type;   ///< The type of event
+  struct novas_timespec time;   ///< The astronomical time of the event
+  double dt;                    ///< [day] Time of the event relative to the start of the search
+  double value;                 ///< The value of the observable at the event
+} novas_event;
+
+/**
+ * Empty initializer for novas_event
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_event
+ * @ingroup time
+ */
+#define NOVAS_EVENT_INIT { NOVAS_EVENT_RISING, NOVAS_TIMESPEC_INIT, 0.0, 0.0 }
+
+/**
+ * Maximum depth of a hierarchical sky index, with 8 &times; 4<sup>10</sup> (about 8.4 million)
+ * cells of about 4 arcmin on a side.
+ *
+ * @since 1.6
+ * @sa novas_make_sky_index()
+ * @ingroup source
+ */
+#define NOVAS_SKY_INDEX_MAX_LEVEL   10
+
+/**
+ * A hierarchical (Hierarchical Triangular Mesh, HTM) index of catalog sources on the sky, which
+ * can be used to quickly select candidate sources inside some region of the sky, such as above
+ * the horizon or near some position, before calculating precise positions for these only.
+ *
+ * The sources are stored in the order of their leaf cell in the mesh, so that the sources in any
+ * cell (at any level) occupy a contiguous range in the index.
+ *
+ * @since 1.6
+ *
+ * @sa novas_make_sky_index(), novas_free_sky_index(), novas_sky_index_cone(),
+ *     novas_sky_index_above(), novas_sky_index_near(), NOVAS_SKY_INDEX_INIT
+ * @ingroup source
+ */
+typedef struct novas_sky_index {
+  int level;            ///< Depth of the mesh, with 8 &times; 4<sup>level</sup> leaf cells
+  int n;                ///< Number of sources in the index
+  double *dirs;         ///< ICRS unit vectors of the sources, as (x, y, z) triplets, in index order
+  int *src;             ///< The catalog index (0-based) of each source, in index order
+  int *cell;            ///< Index of the first source in each leaf cell (plus the total at the end)
+  double pm_max;        ///< [mas/yr] Largest proper motion of any source in the index
+  double plx_max;       ///< [mas] Largest parallax of any source in the index
+} novas_sky_index;
+
+/**
+ * Empty initializer for novas_sky_index
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_sky_index
+ * @ingroup source
+ */
+#define NOVAS_SKY_INDEX_INIT { 0, 0, NULL, NULL, NULL, 0.0, 0.0 }
+
+/**
+ * A catalog prepared for cross-matching, with all sources propagated to a common epoch and
+ * arranged into declination zones, sorted by right ascension within each zone.
+ *
+ * @since 1.6
+ *
+ * @sa novas_make_zone_catalog(), novas_free_zone_catalog(), novas_xmatch(),
+ *     NOVAS_ZONE_CATALOG_INIT
+ * @ingroup source
+ */
+typedef struct novas_zone_catalog {
+  double jd_tdb;        ///< [day] TDB-based Julian date of the epoch of the positions
+  double zone_height;   ///< [deg] Height of the declination zones
+  int n;                ///< Number of sources
+  int n_zones;          ///< Number of declination zones
+  double *x;            ///< ICRS unit vector x components, in zone order
+  double *y;            ///< ICRS unit vector y components, in zone order
+  double *z;            ///< ICRS unit vector z components, in zone order
+  double *ra;           ///< [deg] ICRS right ascensions [0:360), in zone order
+  int *src;             ///< The catalog index (0-based) of each source, in zone order
+  int *zone;            ///< Index of the first source in each zone (plus the total at the end)
+} novas_zone_catalog;
+
+/**
+ * Empty initializer for novas_zone_catalog
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_zone_catalog
+ * @ingroup source
+ */
+#define NOVAS_ZONE_CATALOG_INIT { 0.0, 0.0, 0, 0, NULL, NULL, NULL, NULL, NULL, NULL }
+
+/**
+ * Types of catalog cross-matches to return
+ *
+ * @since 1.6
+ * @sa novas_xmatch()
+ * @ingroup source
+ */
+enum novas_xmatch_mode {
+  NOVAS_XMATCH_ALL = 0,         ///< All pairs of sources within the match radius
+  NOVAS_XMATCH_BEST             ///< Only the closest match for each source in the first catalog
+};
+
+/**
+ * A pair of cross-matched sources
+ *
+ * @since 1.6
+ * @sa novas_xmatch()
+ * @ingroup source
+ */
+typedef struct novas_xmatch_pair {
+  int a;                ///< Catalog index (0-based) of the source in the first catalog
+  int b;                ///< Catalog index (0-based) of the source in the second catalog
+  double sep;           ///< [arcsec] Angular separation of the sources
+} novas_xmatch_pair;
+
+/**
+ * Precomputed star vectors: the barycentric ICRS position and motion of a star at the J2000
+ * catalog epoch, as calculated by starvectors().
+ *
+ * @since 1.6
+ * @sa novas_make_star_vec(), novas_star_vec_sky_pos(), novas_star_catalog
+ * @ingroup source
+ */
+typedef struct novas_star_vec {
+  double pos[3];        ///< [AU] Barycentric ICRS position vector at J2000
+  double vel[3];        ///< [AU/day] Barycentric ICRS motion vector
+} novas_star_vec;
+
+/**
+ * Optional metadata for stars in a binary star vector catalog.
+ *
+ * @since 1.6
+ * @sa novas_star_catalog
+ * @ingroup source
+ */
+typedef struct novas_star_meta {
+  char starname[SIZE_OF_OBJ_NAME];  ///< name of celestial object
+  char catalog[SIZE_OF_CAT_NAME];   ///< catalog designator (e.g., HIP)
+  long starnumber;                  ///< integer identifier assigned to object
+} novas_star_meta;
+
+/**
+ * A binary star vector catalog, opened (mapped into memory) by novas_open_star_catalog(). The
+ * star vectors and metadata point directly into the mapped file.
+ *
+ * @since 1.6
+ * @sa novas_open_star_catalog(), novas_close_star_catalog(), novas_write_star_catalog()
+ * @ingroup source
+ */
+typedef struct novas_star_catalog {
+  int n;                              ///< Number of stars
+  const novas_star_vec *stars;        ///< Star vectors
+  const novas_star_meta *meta;        ///< Star metadata, or NULL if the catalog has none
+  void *data;                         ///< (private) the mapped (or loaded) file contents
+  size_t size;                        ///< (private) the size of the mapped (or loaded) file
+} novas_star_catalog;
+
+/**
+ * Empty initializer for novas_star_catalog
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_star_catalog
+ * @ingroup source
+ */
+#define NOVAS_STAR_CATALOG_INIT { 0, NULL, NULL, NULL, 0 }
+
+/**
+ * Earth Orientation Parameters (EOP) for a date, e.g. as published by the IERS, without the
+ * diurnal corrections for libration and ocean tides.
+ *
+ * @since 1.6
+ * @sa novas_eop_table, novas_eop_at()
+ * @ingroup observer
+ */
+typedef struct novas_eop {
+  double mjd;                         ///< [day] UTC-based Modified Julian Date
+  double xp;                          ///< [mas] polar offset _x_
+  double yp;                          ///< [mas] polar offset _y_
+  double dut1;                        ///< [s] UT1 - UTC time difference
+  double dx;                          ///< [mas] celestial pole offset dX (IAU 2000)
+  double dy;                          ///< [mas] celestial pole offset dY (IAU 2000)
+} novas_eop;
+
+/**
+ * A table of daily Earth Orientation Parameters (EOP), read from an IERS data file by
+ * novas_read_eop_table() or opened (mapped into memory) from a binary EOP table by
+ * novas_open_eop_table().
+ *
+ * @since 1.6
+ * @sa novas_read_eop_table(), novas_open_eop_table(), novas_close_eop_table(), novas_eop_at()
+ * @ingroup observer
+ */
+typedef struct novas_eop_table {
+  int n;                              ///< Number of daily entries
+  const novas_eop *eop;               ///< Daily EOP values, at 0h UTC of consecutive days
+  void *data;                         ///< (private) the allocated, or mapped, data
+  size_t size;                        ///< (private) the size of the mapped file, or 0 if allocated
+} novas_eop_table;
+
+/**
+ * Empty initializer for novas_eop_table
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_eop_table
+ * @ingroup observer
+ */
+#define NOVAS_EOP_TABLE_INIT { 0, NULL, NULL, 0 }
+
+/**
+ * [day] Default grid spacing for tabulated diurnal EOP corrections (30 minutes).
+ *
+ * @since 1.6
+ * @sa novas_make_diurnal_eop_table()
+ * @ingroup observer
+ */
+#define NOVAS_DIURNAL_EOP_STEP    (1.0 / 48.0)
+
+/**
+ * Diurnal and semi-diurnal corrections to the Earth orientation parameters (due to libration and
+ * the ocean tides), tabulated on a regular grid of times for fast interpolation.
+ *
+ * @since 1.6
+ * @sa novas_make_diurnal_eop_table(), novas_diurnal_eop_from_table(), novas_set_diurnal_eop_table()
+ * @ingroup observer
+ */
+typedef struct novas_diurnal_eop_table {
+  double jd_tt;                       ///< [day] TT-based Julian date of the first grid point
+  double step;                        ///< [day] Grid spacing
+  double ut1_to_tt;                   ///< [s] UT1 - TT time difference used for the tabulation
+  int n;                              ///< Number of grid points
+  double pole_error;                  ///< [arcsec] Maximum interpolation error of the polar offsets
+  double ut1_error;                   ///< [s] Maximum interpolation error of UT1
+  double *data;                       ///< (private) xp, yp, UT1 corrections at each grid point
+} novas_diurnal_eop_table;
+
+/**
+ * Empty initializer for novas_diurnal_eop_table
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_diurnal_eop_table
+ * @ingroup observer
+ */
+#define NOVAS_DIURNAL_EOP_TABLE_INIT { 0.0, 0.0, 0.0, 0, 0.0, 0.0, NULL }
+
+/**
+ * [day] Default time span of the polynomial segments in TDB - TT tables.
+ *
+ * @since 1.6
+ * @sa novas_make_tdb_table()
+ * @ingroup time
+ */
+#define NOVAS_TDB_TABLE_SPAN      16.0
+
+/**
+ * The TDB - TT time difference, precomputed as piecewise Chebyshev polynomials over consecutive
+ * time spans, for fast conversion of TT-based times to TDB, TCB or TCG.
+ *
+ * @since 1.6
+ * @sa novas_make_tdb_table(), novas_tt2tdb_table(), novas_convert_tt_times()
+ * @ingroup time
+ */
+typedef struct novas_tdb_table {
+  double jd_tt;                       ///< [day] TT-based Julian date at the start of the table
+  double span;                        ///< [day] Time span of each polynomial segment
+  int n;                              ///< Number of polynomial segments
+  double max_error;                   ///< [s] Maximum deviation from tt2tdb_hp()
+  double *coeffs;                     ///< (private) Chebyshev coefficients for each segment
+} novas_tdb_table;
+
+/**
+ * Empty initializer for novas_tdb_table
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_tdb_table
+ * @ingroup time
+ */
+#define NOVAS_TDB_TABLE_INIT { 0.0, 0.0, 0, 0.0, NULL }
+
+/**
+ * [ns] Time as an integer count of nanoseconds since J2000.0 (JD 2451545.0) in some timescale,
+ * e.g. for high-rate telemetry timestamps, which can be offset and differenced without
+ * floating-point renormalization. 64-bit nanosecond counts cover about &pm;292 years around
+ * J2000.0.
+ *
+ * @since 1.6
+ * @sa novas_get_ns_time(), novas_set_ns_time(), novas_ns_offset(), novas_ns_diff(),
+ *     novas_convert_ns_times()
+ * @ingroup time
+ */
+typedef int64_t novas_ns_time;
+
+/**
+ * [s] Default interval between full LST calculations in a sidereal clock.
+ *
+ * @since 1.6
+ * @sa novas_init_sidereal_clock()
+ * @ingroup time
+ */
+#define NOVAS_SIDEREAL_CLOCK_INTERVAL   60.0
+
+/**
+ * [s/s] Upper bound to the rate at which the LST extrapolated by a sidereal clock may drift
+ * from the precise LST between anchorings, due to the changing equation of the equinoxes
+ * (nutation) and length of day.
+ *
+ * @since 1.6
+ * @sa novas_sidereal_clock_error()
+ * @ingroup time
+ */
+#define NOVAS_SIDEREAL_CLOCK_DRIFT      2.5e-7
+
+/**
+ * A sidereal clock, which extrapolates the Local apparent Sidereal Time (LST) linearly from
+ * periodic full calculations, e.g. for control loops running at high rates.
+ *
+ * @since 1.6
+ * @sa novas_init_sidereal_clock(), novas_advance_sidereal_clock(), novas_sidereal_clock_error()
+ * @ingroup time
+ */
+typedef struct novas_sidereal_clock {
+  novas_timespec anchor;              ///< Time of the last full LST calculation
+  double lon;                         ///< [deg] Geodetic longitude of the observer
+  enum novas_accuracy accuracy;       ///< Accuracy of the full LST calculations
+  double interval;                    ///< [s] Interval between full LST calculations
+  double lst0;                        ///< [h] LST at the anchor time
+  double rate;                        ///< [h/s] Rate of LST progression, per second of time
+  double elapsed;                     ///< [s] Time elapsed since the anchor time
+} novas_sidereal_clock;
+
+/**
+ * [deg] Maximum field radius for field-local transforms.
+ *
+ * @since 1.6
+ * @sa novas_make_field_transform(), novas_make_hor_field_transform()
+ * @ingroup apparent
+ */
+#define NOVAS_FIELD_MAX_RADIUS          10.0
+
+/**
+ * A field-local transform, which maps ICRS positions of distant sources inside a small field of
+ * view to apparent (or horizontal) positions with a quadratic polynomial in tangent-plane
+ * (gnomonic) projection, fitted to the exact transform.
+ *
+ * @since 1.6
+ * @sa novas_make_field_transform(), novas_make_hor_field_transform(), novas_field_apply(),
+ *     novas_field_apply_offsets()
+ * @ingroup apparent
+ */
+typedef struct novas_field_transform {
+  enum novas_reference_system sys;    ///< Output coordinate system (for equatorial outputs)
+  int horizontal;                     ///< Whether outputs are horizontal (azimuth, elevation)
+  double ra;                          ///< [h] ICRS right ascension of the field center
+  double dec;                         ///< [deg] ICRS declination of the field center
+  double radius;                      ///< [deg] Field radius
+  double lon;                         ///< Output R.A. [h] or azimuth [deg] of the field center
+  double lat;                         ///< [deg] Output declination or elevation of the field center
+  double coeff[2][6];                 ///< [rad] Polynomial coefficients for the output tangent-plane
+                                      ///< offsets: 1, x, y, x<sup>2</sup>, xy, y<sup>2</sup>
+  double error;                       ///< [arcsec] Maximum deviation from the exact transform in the field
+} novas_field_transform;
+
+/**
+ * Number of entries in each cache of a computation context.
+ *
+ * @since 1.6
+ * @sa novas_context
+ * @ingroup util
+ */
+#define NOVAS_CONTEXT_SLOTS             4
+
+/**
+ * The caches of a computation context, for the context-aware variants of functions, whose
+ * regular versions keep a single-entry thread-local cache.
+ *
+ * @since 1.6
+ * @sa novas_context, novas_get_cache_stats()
+ * @ingroup util
+ */
+enum novas_context_cache {
+  NOVAS_NUTATION_CACHE = 0,           ///< Nutation angles, for nutation_angles_ctx()
+  NOVAS_EE_CT_CACHE,                  ///< Equation of the equinoxes complementary terms, for e_tilt_ctx()
+  NOVAS_GAST_CACHE,                   ///< Greenwich Apparent Sidereal Time, for novas_gast_ctx()
+  NOVAS_PRECESSION_CACHE,             ///< Precession matrices, for precession_ctx()
+  NOVAS_TT2TDB_CACHE,                 ///< TDB - TT time differences, for tt2tdb_hp_ctx()
+  NOVAS_SPIN_CACHE                    ///< Rotation matrices about z, for spin_ctx()
+};
+
+/**
+ * The number of distinct caches in a computation context.
+ *
+ * @since 1.6
+ * @sa novas_context_cache
+ * @ingroup util
+ */
+#define NOVAS_CONTEXT_CACHES            (NOVAS_SPIN_CACHE + 1)
+
+/**
+ * A single entry in a cache of a computation context.
+ *
+ * @since 1.6
+ * @sa novas_cache
+ * @ingroup util
+ */
+typedef struct novas_cache_entry {
+  double key[3];                      ///< Input parameters for which the value was calculated
+  double value[9];                    ///< Calculated value(s)
+} novas_cache_entry;
+
+/**
+ * A multi-entry cache of a computation context, with hit / miss counters. Entries are replaced in
+ * round-robin order.
+ *
+ * @since 1.6
+ * @sa novas_context
+ * @ingroup util
+ */
+typedef struct novas_cache {
+  novas_cache_entry entry[NOVAS_CONTEXT_SLOTS]; ///< Cached entries
+  int size;                           ///< Number of entries in use
+  int next;                           ///< Index of the entry to replace next
+  long hits;                          ///< Number of lookups that found a cached value
+  long misses;                        ///< Number of lookups that required a new calculation
+} novas_cache;
+
+/**
+ * An explicit computation context, holding multi-entry caches for the context-aware variants
+ * (`..._ctx()`) of functions, whose regular versions keep hidden single-entry thread-local
+ * caches. A context may be used by one thread (or coroutine / fiber) at a time. Each thread may
+ * use its own context(s), or contexts may be handed from one thread to another, as
+ * appropriate. You should initialize a context with novas_init_context() or
+ * NOVAS_CONTEXT_INIT before use.
+ *
+ * @since 1.6
+ * @sa novas_init_context(), novas_get_cache_stats(), NOVAS_CONTEXT_INIT
+ * @ingroup util
+ */
+typedef struct novas_context {
+  novas_cache cache[NOVAS_CONTEXT_CACHES];  ///< The caches, indexed by enum novas_context_cache.
+} novas_context;
+
+/**
+ * Empty initializer for novas_context
+ *
+ * @hideinitializer
+ * @since 1.6
+ * @sa novas_context
+ * @ingroup util
+ */
+#define NOVAS_CONTEXT_INIT { { { { { {0.0}, {0.0} } }, 0, 0, 0L, 0L } } }
+
+/**
+ * SIMD instruction set levels, for which the vectorized batch-processing kernels of the library
+ * (e.g. novas_hor_grid(), novas_hor_positions_f32(), novas_field_apply_offsets()) may be
+ * dispatched at runtime. Levels other than NOVAS_SIMD_SCALAR are available on x86 CPUs only,
+ * and only for builds with GCC or clang.
+ *
+ * @since 1.6
+ * @sa novas_get_simd(), novas_set_simd(), novas_max_simd()
+ * @ingroup util
+ */
+enum novas_simd {
+  NOVAS_SIMD_SCALAR = 0,              ///< Scalar code, without vectorization.
+  NOVAS_SIMD_SSE2,                    ///< 128-bit SSE2 vectors
+  NOVAS_SIMD_AVX2,                    ///< 256-bit AVX2 vectors with FMA
+  NOVAS_SIMD_AVX512                   ///< 512-bit AVX-512 vectors
+};
+
+/**
+ * The number of SIMD instruction set levels defined.
+ *
+ * @since 1.6
+ * @sa novas_simd
+ * @ingroup util
+ */
+#define NOVAS_SIMD_LEVELS               (NOVAS_SIMD_AVX512 + 1)
+
+/**
+ * Environment variable, which may be set to `scalar`, `sse2`, `avx2`, or `avx512` to override
+ * the SIMD instruction set level that is otherwise selected automatically for the CPU, e.g. for
+ * testing. Levels not supported by the CPU are capped to the highest supported one.
+ *
+ * @since 1.6
+ * @sa novas_simd, novas_get_simd()
+ * @ingroup util
+ */
+#define NOVAS_SIMD_ENV                  "SUPERNOVAS_SIMD"
+
+/**
+ * Stages of the calculations, for which the library keeps call counts and cumulative timers, if
+ * it was built with the `NOVAS_PROFILE` compile-time option. The timers are inclusive, i.e. the
+ * time spent in a stage includes the time spent in other stages called from it (e.g. light-time
+ * calculations include the ephemeris calls they make).
+ *
+ * @since 1.6
+ * @sa novas_profile, novas_get_profile()
+ * @ingroup util
+ */
+enum novas_profile_stage {
+  NOVAS_PROFILE_FRAME = 0,            ///< Observing frame setup, including the deferred evaluation of lazy frames
+  NOVAS_PROFILE_EPHEMERIS,            ///< Calls to planet and ephemeris providers
+  NOVAS_PROFILE_LIGHT_TIME,           ///< Light-time calculations, via light_time2()
+  NOVAS_PROFILE_DEFLECTION,           ///< Gravitational deflection calculations, via grav_planets()
+  NOVAS_PROFILE_REFRACTION            ///< Calls to refraction models
+};
+
+/**
+ * The number of profiled stages.
+ *
+ * @since 1.6
+ * @sa novas_profile_stage
+ * @ingroup util
+ */
+#define NOVAS_PROFILE_STAGES            (NOVAS_PROFILE_REFRACTION + 1)
+
+/**
+ * Iterative calculations, for which the library counts iterations, if it was built with the
+ * `NOVAS_PROFILE` compile-time option.
+ *
+ * @since 1.6
+ * @sa novas_profile, novas_get_profile()
+ * @ingroup util
+ */
+enum novas_profile_iteration {
+  NOVAS_LIGHT_TIME_ITERATIONS = 0,    ///< Light-time iterations in light_time2()
+  NOVAS_GRAV_UNDO_ITERATIONS,         ///< Iterations undoing gravitational deflection in grav_undo_planets()
+  NOVAS_INV_REFRACT_ITERATIONS        ///< Iterations inverting refraction in novas_inv_refract()
+};
+
+/**
+ * The number of profiled iterative calculations.
+ *
+ * @since 1.6
+ * @sa novas_profile_iteration
+ * @ingroup util
+ */
+#define NOVAS_PROFILE_ITERATIONS        (NOVAS_INV_REFRACT_ITERATIONS + 1)
+
+/**
+ * The thread-local single-entry caches of functions, whose hits and misses are counted if the
+ * library was built with the `NOVAS_PROFILE` compile-time option.
+ *
+ * @since 1.6
+ * @sa novas_profile, novas_get_profile()
+ * @ingroup util
+ */
+enum novas_profile_cache {
+  NOVAS_PROFILE_NUTATION_CACHE = 0,   ///< Nutation angles, in nutation_angles()
+  NOVAS_PROFILE_CIO_LOCATION_CACHE,   ///< CIO location, in cio_location()
+  NOVAS_PROFILE_CIO_BASIS_CACHE,      ///< CIO basis vectors, in cio_basis()
+  NOVAS_PROFILE_GAST_CACHE,           ///< Greenwich Apparent Sidereal Time, in novas_gast()
+  NOVAS_PROFILE_DIURNAL_EOP_CACHE     ///< Diurnal Earth orientation corrections, in novas_diurnal_eop_at_time()
+};
+
+/**
+ * The number of profiled thread-local caches.
+ *
+ * @since 1.6
+ * @sa novas_profile_cache
+ * @ingroup util
+ */
+#define NOVAS_PROFILE_CACHES            (NOVAS_PROFILE_DIURNAL_EOP_CACHE + 1)
+
+/**
+ * A snapshot of the instrumentation counters and timers of a thread, if the library was built
+ * with the `NOVAS_PROFILE` compile-time option, e.g. for exporting to a metrics system.
+ *
+ * @since 1.6
+ * @sa novas_get_profile(), novas_reset_profile()
+ * @ingroup util
+ */
+typedef struct novas_profile {
+  long calls[NOVAS_PROFILE_STAGES];         ///< Number of times each stage was entered, by enum novas_profile_stage
+  int64_t nanos[NOVAS_PROFILE_STAGES];      ///< [ns] Cumulative time spent in each stage, by enum novas_profile_stage
+  long iterations[NOVAS_PROFILE_ITERATIONS]; ///< Number of iterations, by enum novas_profile_iteration
+  long cache_hits[NOVAS_PROFILE_CACHES];    ///< Thread-local cache hits, by enum novas_profile_cache
+  long cache_misses[NOVAS_PROFILE_CACHES];  ///< Thread-local cache misses, by enum novas_profile_cache
+} novas_profile;
+
 /**
  * The general order of date components for parsing.
  *
@@ -3204,6 +3903,294 @@ int novas_itrs_to_enu(const double *itrf, double lon, double lat, double *enu);
 /// @ingroup observer
 int novas_enu_to_itrs(const double *enu, double lon, double lat, double *itrf);
 
+// in events.c
+/// @ingroup time
+int novas_find_events(const novas_event_finder *restrict finder, const novas_frame *restrict frame, double span,
+        novas_event *restrict events, int n_max);
+
+/// @ingroup time
+double novas_event_elevation(const novas_frame *restrict frame, const void *restrict arg);
+
+/// @ingroup time
+double novas_event_sun_angle(const novas_frame *restrict frame, const void *restrict arg);
+
+/// @ingroup time
+double novas_event_moon_angle(const novas_frame *restrict frame, const void *restrict arg);
+
+/// @ingroup time
+double novas_event_separation(const novas_frame *restrict frame, const void *restrict arg);
+
+/// @ingroup time
+double novas_event_moon_phase(const novas_frame *restrict frame, const void *restrict arg);
+
+/// @ingroup time
+double novas_event_solar_illum(const novas_frame *restrict frame, const void *restrict arg);
+
+// in grid.c
+/// @ingroup apparent
+int novas_hor_grid(const novas_frame *restrict frames, int n_times, const double *restrict dirs, int n_src, int aberration,
+        RefractionModel ref_model, double *restrict az, double *restrict el, double *restrict airmass);
+
+/// @ingroup refract
+double novas_airmass(double el);
+
+// in skyindex.c
+/// @ingroup source
+int novas_make_sky_index(const cat_entry *catalog, int n, int level, novas_sky_index *index);
+
+/// @ingroup source
+void novas_free_sky_index(novas_sky_index *index);
+
+/// @ingroup source
+int novas_sky_index_cone(const novas_sky_index *restrict index, const double *restrict dir, double radius,
+        int *restrict src, int n_max);
+
+/// @ingroup source
+int novas_sky_index_above(const novas_sky_index *restrict index, const novas_frame *restrict frame, double el,
+        int *restrict src, int n_max);
+
+/// @ingroup source
+int novas_sky_index_near(const novas_sky_index *restrict index, const novas_frame *restrict frame,
+        enum novas_reference_system sys, double ra, double dec, double radius, int *restrict src, int n_max);
+
+// in xmatch.c
+/// @ingroup source
+int novas_make_zone_catalog(const cat_entry *catalog, int n, double jd_tdb_cat, double jd_tdb, double zone_height,
+        novas_zone_catalog *zc);
+
+/// @ingroup source
+void novas_free_zone_catalog(novas_zone_catalog *zc);
+
+/// @ingroup source
+int novas_xmatch(const novas_zone_catalog *a, const novas_zone_catalog *b, double radius, enum novas_xmatch_mode mode,
+        int threads, novas_xmatch_pair *matches, int n_max);
+
+// in parse.c
+/// @ingroup util
+int novas_parse_radec_table(const char *restrict buf, size_t len, char delim, int ra_col, int dec_col,
+        double *restrict ra, double *restrict dec, int n_max, size_t *restrict consumed);
+
+// in starcat.c
+/// @ingroup source
+int novas_make_star_vec(const cat_entry *restrict star, novas_star_vec *restrict vec);
+
+/// @ingroup source
+int novas_star_vec_geom_pos(const novas_star_vec *restrict vec, const novas_frame *restrict frame,
+        enum novas_reference_system sys, double *restrict pos);
+
+/// @ingroup source
+int novas_star_vec_sky_pos(const novas_star_vec *restrict vec, const novas_frame *restrict frame,
+        enum novas_reference_system sys, sky_pos *restrict out);
+
+/// @ingroup source
+int novas_write_star_catalog(const char *restrict filename, const cat_entry *restrict catalog, int n, int with_meta);
+
+/// @ingroup source
+int novas_open_star_catalog(const char *restrict filename, novas_star_catalog *restrict cat);
+
+/// @ingroup source
+void novas_close_star_catalog(novas_star_catalog *cat);
+
+// in timescale.c
+/// @ingroup time
+int novas_parse_iso_times(const char *const *restrict str, int n, enum novas_timescale scale, int leap, double dut1,
+        novas_timespec *restrict times);
+
+/// @ingroup time
+int novas_iso_timestamps(const novas_timespec *restrict times, int n, char *restrict buf, int stride);
+
+// in leap.c
+/// @ingroup time
+int novas_leap_seconds(double jd_utc);
+
+/// @ingroup time
+int novas_load_leap_seconds(const char *filename);
+
+/// @ingroup time
+int novas_unix_to_jd(const double *restrict unix_time, int n, enum novas_timescale scale, long *restrict ijd,
+        double *restrict fjd);
+
+// in eop.c
+/// @ingroup observer
+int novas_read_eop_table(const char *restrict filename, novas_eop_table *restrict table);
+
+/// @ingroup observer
+int novas_write_eop_table(const char *restrict filename, const novas_eop_table *restrict table);
+
+/// @ingroup observer
+int novas_open_eop_table(const char *restrict filename, novas_eop_table *restrict table);
+
+/// @ingroup observer
+void novas_close_eop_table(novas_eop_table *table);
+
+/// @ingroup observer
+int novas_eop_at(const novas_eop_table *restrict table, double jd_utc, novas_eop *restrict eop);
+
+/// @ingroup frame
+int novas_make_eop_frame(enum novas_accuracy accuracy, const observer *obs, const novas_timespec *time,
+        const novas_eop_table *table, novas_frame *frame);
+
+// in earth.c
+/// @ingroup observer
+int novas_make_diurnal_eop_table(const novas_timespec *restrict start, double days, double step,
+        novas_diurnal_eop_table *restrict table);
+
+/// @ingroup observer
+void novas_free_diurnal_eop_table(novas_diurnal_eop_table *table);
+
+/// @ingroup observer
+int novas_diurnal_eop_from_table(const novas_diurnal_eop_table *restrict table, const novas_timespec *restrict time,
+        double *restrict dxp, double *restrict dyp, double *restrict dut1);
+
+/// @ingroup observer
+int novas_set_diurnal_eop_table(const novas_diurnal_eop_table *table);
+
+// in timescale.c
+/// @ingroup time
+int novas_make_tdb_table(double jd_tt, double days, double span, novas_tdb_table *table);
+
+/// @ingroup time
+void novas_free_tdb_table(novas_tdb_table *table);
+
+/// @ingroup time
+double novas_tt2tdb_table(const novas_tdb_table *table, double jd_tt);
+
+/// @ingroup time
+int novas_convert_tt_times(const novas_tdb_table *table, int n, const long *ijd, const double *fjd,
+        enum novas_timescale scale, double *out);
+
+/// @ingroup time
+int novas_get_ns_time(const novas_timespec *restrict time, enum novas_timescale scale, novas_ns_time *restrict ns);
+
+/// @ingroup time
+int novas_set_ns_time(enum novas_timescale scale, novas_ns_time ns, int leap, double dut1,
+        novas_timespec *restrict time);
+
+/// @ingroup time
+novas_ns_time novas_ns_offset(novas_ns_time t, double seconds);
+
+/// @ingroup time
+double novas_ns_diff(novas_ns_time t1, novas_ns_time t2);
+
+/// @ingroup time
+int novas_convert_ns_times(const novas_tdb_table *table, int n, const novas_ns_time *tt,
+        enum novas_timescale scale, novas_ns_time *out);
+
+/// @ingroup time
+int novas_init_sidereal_clock(const novas_timespec *restrict time, const on_surface *restrict site,
+        enum novas_accuracy accuracy, double interval, novas_sidereal_clock *restrict clock);
+
+/// @ingroup time
+double novas_advance_sidereal_clock(novas_sidereal_clock *restrict clock, double seconds);
+
+/// @ingroup time
+double novas_sidereal_clock_error(const novas_sidereal_clock *restrict clock);
+
+// in grid.c
+/// @ingroup nonequatorial
+int novas_hor_to_app_array(const novas_frame *restrict frame, int n, const double *restrict az,
+        const double *restrict el, RefractionModel ref_model, enum novas_reference_system sys, double *restrict ra,
+        double *restrict dec);
+
+/// @ingroup nonequatorial
+int novas_hor_positions_f32(const novas_frame *restrict frame, int n, const float *restrict x,
+        const float *restrict y, const float *restrict z, RefractionModel ref_model, float *restrict az,
+        float *restrict el);
+
+// in frames.c
+/// @ingroup frame
+int novas_transform_vectors(const double *in, int in_stride, int n, const novas_transform *restrict transform,
+        double *out, int out_stride);
+
+/// @ingroup frame
+int novas_transform_sky_positions(const sky_pos *in, int n, const novas_transform *restrict transform, sky_pos *out);
+
+/// @ingroup apparent
+int novas_app_to_geom_array(const novas_frame *restrict frame, enum novas_reference_system sys, int n,
+        const double *restrict ra, const double *restrict dec, const double *restrict dist, double *restrict geom_icrs,
+        int *restrict iter);
+
+// in field.c
+/// @ingroup apparent
+int novas_make_field_transform(const novas_frame *restrict frame, enum novas_reference_system sys, double ra,
+        double dec, double radius, novas_field_transform *restrict field);
+
+/// @ingroup apparent
+int novas_make_hor_field_transform(const novas_frame *restrict frame, RefractionModel ref_model, double ra,
+        double dec, double radius, novas_field_transform *restrict field);
+
+/// @ingroup apparent
+int novas_field_apply_offsets(const novas_field_transform *restrict field, int n, const double *x, const double *y,
+        double *out_x, double *out_y);
+
+/// @ingroup apparent
+int novas_field_apply(const novas_field_transform *restrict field, int n, const double *ra, const double *dec,
+        double *lon, double *lat);
+
+// in nutation.c
+/// @ingroup earth
+int novas_nutation_fast(double jd_tt_high, double jd_tt_low, double *restrict dpsi, double *restrict deps);
+
+// in frames.c
+/// @ingroup frame
+int novas_make_lazy_frame(enum novas_accuracy accuracy, const observer *obs, const novas_timespec *time, double xp,
+        double yp, novas_frame *frame);
+
+/// @ingroup frame
+int novas_frame_evaluate(novas_frame *frame);
+
+// in context.c
+/// @ingroup util
+int novas_init_context(novas_context *ctx);
+
+/// @ingroup util
+int novas_get_cache_stats(const novas_context *ctx, enum novas_context_cache cache, long *hits, long *misses);
+
+/// @ingroup util
+int novas_reset_cache_stats(novas_context *ctx);
+
+// in nutation.c
+/// @ingroup earth
+int nutation_angles_ctx(novas_context *ctx, double t, enum novas_accuracy accuracy, double *restrict dpsi,
+        double *restrict deps);
+
+// in equator.c
+/// @ingroup earth
+int e_tilt_ctx(novas_context *ctx, double jd_tdb, enum novas_accuracy accuracy, double *restrict mobl,
+        double *restrict tobl, double *restrict ee, double *restrict dpsi, double *restrict deps);
+
+/// @ingroup earth
+int precession_ctx(novas_context *ctx, double jd_tdb_in, const double *in, double jd_tdb_out, double *out);
+
+// in earth.c
+/// @ingroup earth
+double novas_gast_ctx(novas_context *ctx, double jd_ut1, double ut1_to_tt, enum novas_accuracy accuracy);
+
+// in timescale.c
+/// @ingroup time
+double tt2tdb_hp_ctx(novas_context *ctx, double jd_tt);
+
+// in util.c
+/// @ingroup util
+int spin_ctx(novas_context *ctx, double angle, const double *in, double *out);
+
+// in simd.c
+/// @ingroup util
+enum novas_simd novas_max_simd(void);
+
+/// @ingroup util
+enum novas_simd novas_get_simd(void);
+
+/// @ingroup util
+int novas_set_simd(enum novas_simd level);
+
+// in profile.c
+/// @ingroup util
+int novas_get_profile(novas_profile *profile);
+
+/// @ingroup util
+int novas_reset_profile(void);
+
 
 // <================= END of SuperNOVAS API =====================>
 
@@ -3231,6 +4218,7 @@ int novas_enu_to_itrs(const double *enu, double lon, double lat, double *itrf);
 // Various locally used physical units
 #  define DAY                 NOVAS_DAY
 #  define DAY_HOURS           24.0
+#  define GPS2TAI             ( NOVAS_GPS_TO_TAI / DAY )
 #  define DEG360              360.0
 #  define JULIAN_YEAR_DAYS    NOVAS_JULIAN_YEAR_DAYS
 #  define JULIAN_CENTURY_DAYS ( 100.0 * JULIAN_YEAR_DAYS )
@@ -3288,6 +4276,52 @@ int novas_enu_to_itrs(const double *enu, double lon, double lat, double *itrf);
 #    endif
 #  endif
 
+// Function attributes for building SIMD variants of batch-processing kernels, which are then
+// selected at runtime by novas_get_simd(). The kernel bodies are inlined into each variant, and
+// vectorized by the compiler for the instruction set of the variant.
+#  if defined(__GNUC__)
+#    define SIMD_INLINE       static inline __attribute__((always_inline))
+#  else
+#    define SIMD_INLINE       static inline
+#  endif
+
+#  if defined(__GNUC__) && !defined(__clang__)
+#    define SIMD_SCALAR       __attribute__((optimize("no-tree-vectorize")))
+#  else
+#    define SIMD_SCALAR
+#  endif
+
+#  if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    define SIMD_X86          1     ///< Whether x86 SIMD kernel variants are built
+#    define SIMD_SSE2         __attribute__((target("sse2")))
+#    define SIMD_AVX2         __attribute__((target("avx2,fma")))
+#    if defined(__clang__)
+#      define SIMD_AVX512     __attribute__((target("avx512f,avx512dq,avx512vl,avx2,fma"), min_vector_width(512)))
+#    else
+#      define SIMD_AVX512     __attribute__((target("avx512f,avx512dq,avx512vl,avx2,fma,prefer-vector-width=512")))
+#    endif
+#  endif
+
+// Optional instrumentation of hot paths, for builds with the NOVAS_PROFILE compile-time option.
+// PROFILE_START() declares a start time, and PROFILE_STOP() adds the time elapsed since, and n
+// calls, to the stage. Without NOVAS_PROFILE, they compile to nothing.
+#  ifdef NOVAS_PROFILE
+#    define PROFILE_START(t0)             const int64_t t0 = novas_profile_clock()
+#    define PROFILE_STOP(stage, t0, n)    novas_profile_stop(stage, t0, n)
+#    define PROFILE_ITERATION(type)       novas_profile_iteration(type)
+#    define PROFILE_CACHE(cache, hit)     novas_profile_cache(cache, hit)
+
+int64_t novas_profile_clock(void);
+void novas_profile_stop(enum novas_profile_stage stage, int64_t t0, long n);
+void novas_profile_iteration(enum novas_profile_iteration type);
+void novas_profile_cache(enum novas_profile_cache cache, int hit);
+#  else
+#    define PROFILE_START(t0)
+#    define PROFILE_STOP(stage, t0, n)
+#    define PROFILE_ITERATION(type)
+#    define PROFILE_CACHE(cache, hit)
+#  endif
+
 
 int novas_trace(const char *restrict loc, int n, int offset);
 double novas_trace_nan(const char *restrict loc);
@@ -3340,6 +4374,15 @@ double novas_vdot(const double *v1, const double *v2);
 
 int polar_dxdy_to_dpsideps(double jd_tt, double dx, double dy, double *restrict dpsi, double *restrict deps);
 int novas_frame_is_initialized(const novas_frame *frame);
+
+#  define FRAME_ORIENTATION   (1 << 0)    ///< lazy novas_frame.state bit: Earth orientation is not yet evaluated
+#  define FRAME_DIURNAL_EOP   (1 << 1)    ///< lazy novas_frame.state bit: diurnal EOP is not yet evaluated
+#  define FRAME_PLANETS       (1 << 2)    ///< lazy novas_frame.state bit: planet positions are not yet evaluated
+
+int novas_frame_require(const novas_frame *frame, int components);
+
+double *novas_cache_lookup(novas_context *ctx, enum novas_context_cache cache, const double *key, int nkey);
+double *novas_cache_store(novas_context *ctx, enum novas_context_cache cache, const double *key, int nkey);
 double novas_gmst_prec(double jd_tdb);
 double novas_cio_gcrs_ra(double jd_tdb);
 void novas_set_max_iter(int n);
@@ -3348,6 +4391,9 @@ int novas_Rx(double angle, double *v);
 int novas_Ry(double angle, double *v);
 int novas_Rz(double angle, double *v);
 
+int novas_map_file(const char *restrict filename, size_t min_size, void **restrict data, size_t *restrict size);
+void novas_unmap_file(void *data, size_t size);
+
 
 /**
  * Deprecated.
@@ -3360,6 +4406,8 @@ extern int novas_inv_max_iter;
 /// \endcond
 
 #if __cplusplus
+} // extern "C"
+
 #  ifdef NOVAS_NAMESPACE
 } // namespace novas
 #  endif
@@ -0,0 +1,469 @@
+/**
+ * @file
+ *
+ *  Header-only C++17 layer over the SuperNOVAS C API, for reducing many positions with the same
+ *  observing frame, with the output coordinate system and accuracy fixed at compile time.
+ *
+ *  The C functions, such as novas_geom_to_app(), select the rotations to the output system and
+ *  the aberration formula for the frame's accuracy at runtime, for every position they process.
+ *  The `supernovas::reduction` template takes the output system and accuracy as template
+ *  parameters instead. The chain of rotations from GCRS to the output system (frame bias,
+ *  precession, and nutation for equinox-based systems, or else CIRS, Earth rotation, and polar
+ *  wobble) is selected at compile time, and composed once into a single matrix when the reduction
+ *  is created for a frame (or skipped altogether for ICRS / GCRS outputs), so that the compiler
+ *  can generate tight, branch-free, inlined loops for each configuration. Reductions operate on the regular C `novas_frame` structures, and so they
+ *  may be freely mixed with calls to the C API.
+ *
+ *  ```cpp
+ *   #include <novas.hpp>
+ *
+ *   novas_frame frame = NOVAS_FRAME_INIT;
+ *   novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, dx, dy, &frame);
+ *
+ *   // Apparent TOD positions for the frame, with reduced accuracy.
+ *   supernovas::reduction<NOVAS_TOD, NOVAS_REDUCED_ACCURACY> tod(frame);
+ *   if(!tod.is_valid()) ...
+ *
+ *   // Reduce n geometric positions (3 x n doubles) to apparent positions on the sky.
+ *   tod.geom_to_app(pos, n, skypos);
+ *  ```
+ *
+ *  Errors are reported the same way as by the C API: functions return 0 if successful, or else
+ *  -1 with `errno` set to indicate the type of error.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa novas.h, frames.c
+ */
+
+#ifndef NOVAS_HPP_
+#define NOVAS_HPP_
+
+#if __cplusplus < 201703L
+#  error "novas.hpp requires C++17 or later"
+#endif
+
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+
+#if __has_include(<span>)
+#  include <span>
+#endif
+
+#include "novas.h"
+
+namespace supernovas {
+
+#ifdef NOVAS_NAMESPACE
+using namespace ::novas;
+#endif
+
+/**
+ * Compile-time properties of a coordinate reference system, which determine what rotations are
+ * needed to get there from GCRS. As in the C library, ICRS and GCRS are treated as the same
+ * system.
+ *
+ * @tparam SYS    The coordinate reference system
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ */
+template<enum novas_reference_system SYS>
+struct system_traits {
+  static_assert(SYS >= 0 && SYS < NOVAS_REFERENCE_SYSTEMS, "invalid reference system");
+
+  /// Whether the system is rotated w.r.t. GCRS.
+  static constexpr bool is_rotated = (SYS != NOVAS_GCRS && SYS != NOVAS_ICRS);
+
+  /// Whether the system is based on the dynamical equator and equinox of date (or of J2000).
+  static constexpr bool is_equinox_based = (SYS == NOVAS_J2000 || SYS == NOVAS_MOD || SYS == NOVAS_TOD);
+
+  /// Whether the system rotates with the Earth.
+  static constexpr bool is_earth_fixed = (SYS == NOVAS_TIRS || SYS == NOVAS_ITRS);
+};
+
+/**
+ * Compile-time properties of an accuracy setting, which determine the formulae used in the
+ * reduction of positions.
+ *
+ * @tparam ACC    The accuracy setting
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ */
+template<enum novas_accuracy ACC>
+struct accuracy_traits {
+  static_assert(ACC >= NOVAS_FULL_ACCURACY && ACC <= NOVAS_FAST_ACCURACY, "invalid accuracy");
+
+  /// Whether to use the first-order (classical) aberration formula instead of the relativistic one.
+  static constexpr bool is_first_order_aberration = (ACC == NOVAS_FAST_ACCURACY);
+};
+
+/**
+ * Reduction of many positions with the same observing frame, with the output coordinate system
+ * and accuracy fixed at compile time. It is equivalent to calling novas_geom_to_app() on each
+ * position, but it composes the rotations to the output system only once, and the per-position
+ * loops are free of runtime switches on the system or the accuracy.
+ *
+ * A reduction holds its own (fully evaluated) copy of the frame it was created for, and so it
+ * may be shared among threads, and remains valid even if the original frame is modified or
+ * destroyed.
+ *
+ * @tparam SYS    The coordinate reference system of the outputs
+ * @tparam ACC    The accuracy of the observing frames, for which the reduction is used.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_geom_to_app(), novas_make_transform()
+ */
+template<enum novas_reference_system SYS, enum novas_accuracy ACC>
+class reduction {
+private:
+  novas_frame frame_;         ///< Fully evaluated copy of the observing frame
+  double M_[3][3] = {};       ///< GCRS to output system rotation (unused if not rotated)
+  int status_;                ///< 0 if initialized successfully, or else -1.
+
+  int init() noexcept {
+    if(novas_frame_evaluate(&frame_) != 0)
+      return -1;
+
+    if(frame_.accuracy != ACC) {
+      errno = EINVAL;
+      return -1;
+    }
+
+    if constexpr(system_traits<SYS>::is_rotated) {
+      // Columns of the composite matrix are the rotated GCRS unit vectors.
+      for(int j = 0; j < 3; j++) {
+        double e[3] = {};
+
+        e[j] = 1.0;
+        chain(e);
+
+        for(int i = 0; i < 3; i++)
+          M_[i][j] = e[i];
+      }
+    }
+
+    return 0;
+  }
+
+  /**
+   * Rotates a vector in place with one of the frame's rotation matrices.
+   */
+  static void apply(const novas_matrix &A, double *p) noexcept {
+    const double x = p[0], y = p[1], z = p[2];
+
+    for(int i = 0; i < 3; i++)
+      p[i] = A.M[i][0] * x + A.M[i][1] * y + A.M[i][2] * z;
+  }
+
+  /**
+   * Rotates a GCRS vector to the output system in place, step by step, via the chain of
+   * rotations that is selected for the output system at compile time: frame bias, precession,
+   * and nutation for the equinox-based systems, or else GCRS to CIRS, followed by Earth rotation
+   * and polar wobble for the Earth-fixed systems. It is used only for composing the rotation
+   * matrix of the reduction.
+   */
+  void chain(double *p) const noexcept {
+    if constexpr(system_traits<SYS>::is_equinox_based) {
+      apply(frame_.icrs_to_j2000, p);
+
+      if constexpr(SYS != NOVAS_J2000)
+        apply(frame_.precession, p);
+
+      if constexpr(SYS == NOVAS_TOD)
+        apply(frame_.nutation, p);
+    }
+    else {
+      apply(frame_.gcrs_to_cirs, p);
+
+      if constexpr(system_traits<SYS>::is_earth_fixed)
+        spin(frame_.era, p, p);
+
+      if constexpr(SYS == NOVAS_ITRS)
+        wobble(frame_.time.ijd_tt + frame_.time.fjd_tt, WOBBLE_TIRS_TO_ITRS, 1e-3 * frame_.dx, 1e-3 * frame_.dy, p, p);
+    }
+  }
+
+  /**
+   * Corrects a geometric position for the observer's motion, in the same way as the
+   * novas_geom_to_app() does for the given accuracy.
+   */
+  void aberrate(double *p) const noexcept {
+    const double *v = frame_.obs_vel;
+    const double d = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+
+    if(frame_.v_obs == 0.0 || d == 0.0)
+      return;
+
+    if constexpr(accuracy_traits<ACC>::is_first_order_aberration) {
+      const double f = d / NOVAS_C_AU_PER_DAY;
+
+      for(int i = 0; i < 3; i++)
+        p[i] += f * v[i];
+    }
+    else {
+      const double pos0[3] = { p[0], p[1], p[2] };
+      const double q0 = frame_.beta * (pos0[0] * v[0] + pos0[1] * v[1] + pos0[2] * v[2]) / (d * frame_.v_obs);
+      const double q = (1.0 + q0 / (1.0 + frame_.gamma)) * d / NOVAS_C_AU_PER_DAY;
+      const double r = 1.0 + q0;
+
+      for(int i = 0; i < 3; i++)
+        p[i] = (frame_.gamma * pos0[i] + q * v[i]) / r;
+    }
+  }
+
+  /**
+   * Rotates a GCRS vector to the output system in place. It is a no-op for ICRS / GCRS outputs.
+   */
+  void rotate(double *p) const noexcept {
+    if constexpr(system_traits<SYS>::is_rotated) {
+      const double x = p[0], y = p[1], z = p[2];
+
+      for(int i = 0; i < 3; i++)
+        p[i] = M_[i][0] * x + M_[i][1] * y + M_[i][2] * z;
+    }
+  }
+
+  /**
+   * Calculates the apparent position vector, in the output system, for a geometric ICRS
+   * position relative to the observer.
+   */
+  void apparent(const double *pos, double *app) const noexcept {
+    grav_planets(pos, frame_.obs_pos, &frame_.planets, app);
+    aberrate(app);
+    rotate(app);
+  }
+
+  /**
+   * Rotates an ICRS / GCRS vector to the output system.
+   */
+  void rotate_copy(const double *in, double *out) const noexcept {
+    double p[3] = { in[0], in[1], in[2] };
+    rotate(p);
+    out[0] = p[0];
+    out[1] = p[1];
+    out[2] = p[2];
+  }
+
+  /**
+   * Calculates the apparent position on the sky, in the output system, for a geometric ICRS
+   * position relative to the observer, in the same way as novas_geom_to_app().
+   */
+  void sky(const double *pos, sky_pos *out) const noexcept {
+    double p[3], xy;
+
+    apparent(pos, p);
+
+    xy = std::sqrt(p[0] * p[0] + p[1] * p[1]);
+    out->dis = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+    out->ra = std::atan2(p[1], p[0]) / NOVAS_HOURANGLE;
+    if(out->ra < 0.0)
+      out->ra += 24.0;
+    out->dec = std::atan2(p[2], xy) / NOVAS_DEGREE;
+    out->rv = NAN;
+
+    for(int i = 0; i < 3; i++)
+      out->r_hat[i] = p[i] / out->dis;
+  }
+
+  int check(const void *in, const void *out) const noexcept {
+    if(status_ != 0 || !in || !out) {
+      errno = EINVAL;
+      return -1;
+    }
+    return 0;
+  }
+
+#ifdef __cpp_lib_span
+  template<typename IN, typename OUT>
+  int check(std::span<IN> in, std::span<OUT> out) const noexcept {
+    if(status_ != 0 || out.size() < in.size()) {
+      errno = EINVAL;
+      return -1;
+    }
+    return 0;
+  }
+#endif
+
+public:
+  /// The coordinate reference system of the outputs.
+  static constexpr enum novas_reference_system system = SYS;
+
+  /// The accuracy of the reduction.
+  static constexpr enum novas_accuracy accuracy = ACC;
+
+  /**
+   * Creates a reduction for the specified observing frame. The frame should have the same
+   * accuracy as the template parameter. You should check the validity of the new reduction with
+   * is_valid() before use.
+   *
+   * @param frame   An observing frame, initialized via novas_make_frame() or similar. Lazy frames
+   *                are evaluated (in a copy) as necessary.
+   *
+   * @sa is_valid()
+   */
+  explicit reduction(const novas_frame &frame) noexcept : frame_(frame) {
+    status_ = init();
+  }
+
+  /**
+   * Checks if the reduction was created successfully.
+   *
+   * @return    `true` if the reduction may be used, or else `false` if the frame, from which it
+   *            was created, was not initialized, or if its accuracy does not match the template
+   *            parameter (`errno` will indicate the type of error).
+   */
+  bool is_valid() const noexcept {
+    return status_ == 0;
+  }
+
+  /**
+   * Returns the (fully evaluated) copy of the observing frame, for which the reduction was
+   * created, e.g. for use with the C API.
+   *
+   * @return    The observing frame of this reduction.
+   */
+  const novas_frame &frame() const noexcept {
+    return frame_;
+  }
+
+  /**
+   * Rotates ICRS / GCRS vectors into the output system, without applying aberration or
+   * gravitational deflection corrections.
+   *
+   * @param in        Input vectors (3 components each) in ICRS / GCRS.
+   * @param n         Number of vectors
+   * @param[out] out  Output vectors (3 components each) in the output system. It may be the same
+   *                  as the input.
+   * @return          0 if successful, or else -1 if the reduction is invalid or if either array
+   *                  is NULL (errno will be set to EINVAL).
+   */
+  int icrs_to_sys(const double *in, std::size_t n, double *out) const noexcept {
+    if(check(in, out) != 0)
+      return -1;
+
+    for(std::size_t k = 0; k < n; k++)
+      rotate_copy(&in[3 * k], &out[3 * k]);
+
+    return 0;
+  }
+
+  /**
+   * Converts geometric positions to apparent position vectors in the output system, by applying
+   * gravitational deflection and aberration corrections for the observing frame.
+   *
+   * @param pos       [AU] Geometric positions (3 components each) of sources relative to the
+   *                  observer, in ICRS.
+   * @param n         Number of positions
+   * @param[out] app  [AU] Apparent positions (3 components each) in the output system. It may not
+   *                  overlap with the input.
+   * @return          0 if successful, or else -1 if the reduction is invalid or if either array
+   *                  is NULL (errno will be set to EINVAL).
+   *
+   * @sa novas_geom_to_app()
+   */
+  int geom_to_app(const double *pos, std::size_t n, double *app) const noexcept {
+    if(check(pos, app) != 0)
+      return -1;
+
+    for(std::size_t k = 0; k < n; k++)
+      apparent(&pos[3 * k], &app[3 * k]);
+
+    return 0;
+  }
+
+  /**
+   * Converts geometric positions to apparent positions on the sky in the output system, by
+   * applying gravitational deflection and aberration corrections for the observing frame. The
+   * results are the same as those of novas_geom_to_app() for each position, including the
+   * radial velocity being set to NAN.
+   *
+   * @param pos       [AU] Geometric positions (3 components each) of sources relative to the
+   *                  observer, in ICRS.
+   * @param n         Number of positions
+   * @param[out] out  Apparent positions on the sky in the output system.
+   * @return          0 if successful, or else -1 if the reduction is invalid or if either array
+   *                  is NULL (errno will be set to EINVAL).
+   *
+   * @sa novas_geom_to_app()
+   */
+  int geom_to_app(const double *pos, std::size_t n, sky_pos *out) const noexcept {
+    if(check(pos, out) != 0)
+      return -1;
+
+    for(std::size_t k = 0; k < n; k++)
+      sky(&pos[3 * k], &out[k]);
+
+    return 0;
+  }
+
+#ifdef __cpp_lib_span
+  /**
+   * Rotates ICRS / GCRS vectors into the output system. Same as the pointer-based version, but
+   * with spans of 3-vectors.
+   *
+   * @param in        Input vectors in ICRS / GCRS.
+   * @param[out] out  Output vectors in the output system, at least as many as the inputs.
+   * @return          0 if successful, or else -1 if the reduction is invalid or the output is too
+   *                  small (errno will be set to EINVAL).
+   */
+  int icrs_to_sys(std::span<const double[3]> in, std::span<double[3]> out) const noexcept {
+    if(check(in, out) != 0)
+      return -1;
+
+    for(std::size_t k = 0; k < in.size(); k++)
+      rotate_copy(in[k], out[k]);
+
+    return 0;
+  }
+
+  /**
+   * Converts geometric positions to apparent position vectors in the output system. Same as the
+   * pointer-based version, but with spans of 3-vectors.
+   *
+   * @param pos       [AU] Geometric positions of sources relative to the observer, in ICRS.
+   * @param[out] app  [AU] Apparent positions in the output system, at least as many as the inputs.
+   * @return          0 if successful, or else -1 if the reduction is invalid or the output is too
+   *                  small (errno will be set to EINVAL).
+   */
+  int geom_to_app(std::span<const double[3]> pos, std::span<double[3]> app) const noexcept {
+    if(check(pos, app) != 0)
+      return -1;
+
+    for(std::size_t k = 0; k < pos.size(); k++)
+      apparent(pos[k], app[k]);
+
+    return 0;
+  }
+
+  /**
+   * Converts geometric positions to apparent positions on the sky in the output system. Same as
+   * the pointer-based version, but with spans.
+   *
+   * @param pos       [AU] Geometric positions of sources relative to the observer, in ICRS.
+   * @param[out] out  Apparent positions on the sky in the output system, at least as many as the
+   *                  inputs.
+   * @return          0 if successful, or else -1 if the reduction is invalid or the output is too
+   *                  small (errno will be set to EINVAL).
+   */
+  int geom_to_app(std::span<const double[3]> pos, std::span<sky_pos> out) const noexcept {
+    if(check(pos, out) != 0)
+      return -1;
+
+    for(std::size_t k = 0; k < pos.size(); k++)
+      sky(pos[k], &out[k]);
+
+    return 0;
+  }
+#endif
+};
+
+} // namespace supernovas
+
+#endif /* NOVAS_HPP_ */
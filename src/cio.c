@@ -184,6 +184,8 @@ short cio_location(double jd_tdb, enum novas_accuracy accuracy, double *restrict
   if(accuracy != NOVAS_FULL_ACCURACY && accuracy != NOVAS_REDUCED_ACCURACY)
     return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", accuracy);
 
+  PROFILE_CACHE(NOVAS_PROFILE_CIO_LOCATION_CACHE, novas_time_equals(jd_tdb, t_last) && accuracy == acc_last);
+
   // Check if previously computed RA value can be used.
   if(!novas_time_equals(jd_tdb, t_last) || accuracy != acc_last) {
     // Calculate the equation of origins.
@@ -251,6 +253,8 @@ short cio_basis(double jd_tdb, double ra_cio, enum novas_cio_location_type loc_t
   if(accuracy != NOVAS_FULL_ACCURACY && accuracy != NOVAS_REDUCED_ACCURACY)
     return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", accuracy);
 
+  PROFILE_CACHE(NOVAS_PROFILE_CIO_BASIS_CACHE, novas_time_equals(jd_tdb, t_last) && accuracy == acc_last);
+
   // Compute unit vector z toward celestial pole.
   if(!novas_time_equals(jd_tdb, t_last) || (accuracy != acc_last)) {
     const double z0[3] = { 0.0, 0.0, 1.0 };
@@ -0,0 +1,209 @@
+/**
+ * @file
+ *
+ *  Explicit computation contexts, holding multi-entry caches for the context-aware variants
+ *  (`..._ctx()`) of functions, whose regular versions keep a hidden single-entry thread-local
+ *  cache of their last result.
+ *
+ *  The single-entry caches are effective as long as a thread keeps calculating for the same epoch
+ *  and accuracy. However, when a thread interleaves calculations for two or more epochs (or
+ *  accuracies), every call misses, and when calculations are spread over coroutines or fibers
+ *  sharing a thread, the thread-local caches are shared between them also. Contexts make caching
+ *  explicit instead: each context holds a few recent results for every cached quantity, and keeps
+ *  count of cache hits and misses, so that caching can be monitored and tuned by the
+ *  application.
+ *
+ *  ```c
+ *   novas_context ctx = NOVAS_CONTEXT_INIT;
+ *   double gast1, gast2;
+ *   long hits, misses;
+ *
+ *   // Interleaved calculations for two epochs are both cached in the context
+ *   gast1 = novas_gast_ctx(&ctx, jd_ut1, ut1_to_tt, NOVAS_FULL_ACCURACY);
+ *   gast2 = novas_gast_ctx(&ctx, jd_ut1 + 1.0, ut1_to_tt, NOVAS_FULL_ACCURACY);
+ *   ...
+ *
+ *   novas_get_cache_stats(&ctx, NOVAS_GAST_CACHE, &hits, &misses);
+ *  ```
+ *
+ *  cio_location() and cio_basis() have no context-aware variants, since they are deprecated.
+ *  Neither do the Solar-system calculations of `solsys3.c`: sun_eph() keeps no cache, and the
+ *  cache of the barycentric offset in earth_sun_calc() sits behind the planet provider interface,
+ *  which has no means of passing a context.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa nutation.c, equator.c, earth.c
+ */
+
+#include <string.h>
+#include <errno.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/**
+ * Initializes a computation context, clearing all cached values and the cache hit / miss
+ * counters.
+ *
+ * @param[out] ctx    The computation context to initialize.
+ * @return            0 if successful, or else -1 if the context is NULL (errno will be set to
+ *                    EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_get_cache_stats(), novas_reset_cache_stats(), NOVAS_CONTEXT_INIT
+ */
+int novas_init_context(novas_context *ctx) {
+  if(!ctx)
+    return novas_error(-1, EINVAL, "novas_init_context", "NULL context");
+
+  memset(ctx, 0, sizeof(*ctx));
+  return 0;
+}
+
+/**
+ * Returns the number of hits and misses of a cache in a computation context, since the context
+ * was initialized or since the counters were last reset.
+ *
+ * @param ctx           The computation context.
+ * @param cache         The cache for which to return the counters.
+ * @param[out] hits     Number of lookups, which found a cached value. It may be NULL if not
+ *                      required.
+ * @param[out] misses   Number of lookups, which required a new calculation. It may be NULL if
+ *                      not required.
+ * @return              0 if successful, or else -1 if the context is NULL or the cache is invalid
+ *                      (errno will be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_reset_cache_stats(), novas_init_context()
+ */
+int novas_get_cache_stats(const novas_context *ctx, enum novas_context_cache cache, long *hits, long *misses) {
+  static const char *fn = "novas_get_cache_stats";
+
+  if(hits)
+    *hits = 0L;
+  if(misses)
+    *misses = 0L;
+
+  if(!ctx)
+    return novas_error(-1, EINVAL, fn, "NULL context");
+
+  if(cache < 0 || cache >= NOVAS_CONTEXT_CACHES)
+    return novas_error(-1, EINVAL, fn, "invalid cache: %d", cache);
+
+  if(hits)
+    *hits = ctx->cache[cache].hits;
+  if(misses)
+    *misses = ctx->cache[cache].misses;
+
+  return 0;
+}
+
+/**
+ * Resets the hit / miss counters of all caches in a computation context, while keeping the cached
+ * values.
+ *
+ * @param ctx   The computation context.
+ * @return      0 if successful, or else -1 if the context is NULL (errno will be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_get_cache_stats()
+ */
+int novas_reset_cache_stats(novas_context *ctx) {
+  int i;
+
+  if(!ctx)
+    return novas_error(-1, EINVAL, "novas_reset_cache_stats", "NULL context");
+
+  for(i = NOVAS_CONTEXT_CACHES; --i >= 0;)
+    ctx->cache[i].hits = ctx->cache[i].misses = 0L;
+
+  return 0;
+}
+
+/// \cond PRIVATE
+
+/**
+ * Looks up a previously calculated value in a cache of a computation context, and updates the hit
+ * or miss counter of the cache accordingly. Keys must match exactly.
+ *
+ * @param ctx     The computation context. !!! It cannot be NULL !!!
+ * @param cache   The cache to search.
+ * @param key     The input parameters of the calculation.
+ * @param nkey    The number of input parameters [1:3].
+ * @return        Pointer to the cached value(s), or NULL if not found.
+ *
+ * @sa novas_cache_store()
+ */
+double *novas_cache_lookup(novas_context *ctx, enum novas_context_cache cache, const double *key, int nkey) {
+  novas_cache *c = &ctx->cache[cache];
+  int i;
+
+  for(i = 0; i < c->size; i++) {
+    novas_cache_entry *e = &c->entry[i];
+    int k;
+
+    for(k = 0; k < nkey; k++)
+      if(e->key[k] != key[k])
+        break;
+
+    if(k == nkey) {
+      c->hits++;
+      return e->value;
+    }
+  }
+
+  c->misses++;
+  return NULL;
+}
+
+/**
+ * Claims an entry in a cache of a computation context, for storing newly calculated value(s) with
+ * the given input parameters. Entries are reused in round-robin order once the cache is full.
+ *
+ * @param ctx     The computation context. !!! It cannot be NULL !!!
+ * @param cache   The cache in which to store a new value.
+ * @param key     The input parameters of the calculation.
+ * @param nkey    The number of input parameters [1:3].
+ * @return        Pointer to the value(s) of the entry, which the caller should populate.
+ *
+ * @sa novas_cache_lookup()
+ */
+double *novas_cache_store(novas_context *ctx, enum novas_context_cache cache, const double *key, int nkey) {
+  novas_cache *c = &ctx->cache[cache];
+  novas_cache_entry *e = &c->entry[c->next];
+
+  memcpy(e->key, key, nkey * sizeof(double));
+
+  if(c->size < NOVAS_CONTEXT_SLOTS)
+    c->size++;
+
+  c->next = (c->next + 1) % NOVAS_CONTEXT_SLOTS;
+
+  return e->value;
+}
+
+/// \endcond
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
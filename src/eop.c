@@ -0,0 +1,565 @@
+/**
+ * @file
+ *
+ *  Tables of daily Earth Orientation Parameters (EOP), read from IERS data files (such as
+ *  `finals2000A.all` or the EOP C04 series), with interpolation to arbitrary times, and the
+ *  automatic use of these in observing frames. Tables may also be saved in a compact binary form,
+ *  which can be mapped into memory (mmap) and used without parsing, e.g. by many processes that
+ *  need EOP values.
+ *
+ *  The interpolated values are the slowly varying (mean) EOPs only. The diurnal and semi-diurnal
+ *  corrections for libration and the ocean tides are added on top of these when the interpolated
+ *  values are used to define astronomical time (novas_set_split_time()) and observing frames
+ *  (novas_make_frame()), as usual.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa earth.c, frames.c, leap.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+#define EOP_MAGIC         "NOVASEO"     ///< File identifier (with terminating '\0')
+#define EOP_VERSION       1             ///< File format version
+#define EOP_BYTE_ORDER    0x01020304    ///< Byte order marker
+#define MJD0              2400000.5     ///< [day] Julian date at MJD 0
+#define EOP_LINE_LEN      256           ///< Maximum line length in IERS EOP files
+
+/**
+ * Header of binary EOP table files.
+ */
+typedef struct {
+  char magic[8];          ///< EOP_MAGIC
+  uint32_t version;       ///< EOP_VERSION
+  uint32_t byte_order;    ///< EOP_BYTE_ORDER, as written on the platform
+  uint32_t entry_size;    ///< sizeof(novas_eop) on the platform
+  uint32_t reserved1;     ///< (unused)
+  uint64_t n;             ///< Number of daily entries
+  char reserved[32];      ///< (unused)
+} eop_header;
+/// \endcond
+
+/**
+ * Parses a fixed-column field from a line of text.
+ *
+ * @return    the parsed value, or NAN if the field is blank or missing.
+ */
+static double eop_field(const char *line, int len, int from, int width) {
+  char buf[20], *tail;
+  double v;
+
+  if(from + width > len)
+    return NAN;
+
+  memcpy(buf, &line[from], width);
+  buf[width] = '\0';
+
+  v = strtod(buf, &tail);
+  return tail == buf ? NAN : v;
+}
+
+/**
+ * Checks if a file is an IERS data file with nutation offsets (dPsi, dEps) relative to the IAU
+ * 1980 nutation model, instead of the celestial pole offsets (dX, dY), based on its name. These
+ * are the IAU1980 `finals` files (`finals.all`, `finals.data`, `finals.daily`), and the IAU1980
+ * variants of the 14 C04 (or older) series (e.g. `eopc04_14.62-now`), which store dPsi and dEps
+ * in the same columns as the IAU2000 files (e.g. `finals2000A.all` or
+ * `eopc04_14_IAU2000.62-now`) store dX and dY.
+ *
+ * @param filename  Path to the IERS EOP data file.
+ * @return          1 if the file contains IAU1980 nutation offsets, or else 0.
+ */
+static int eop_is_iau1980(const char *filename) {
+  const char *base = filename, *s;
+
+  for(s = filename; *s; s++)
+    if(*s == '/' || *s == '\\')
+      base = s + 1;
+
+  if(strstr(base, "2000"))
+    return 0;
+
+  return strncmp(base, "finals.", 7) == 0 || strncmp(base, "eopc04_", 7) == 0;
+}
+
+/**
+ * Parses a line from an IERS `finals.all` / `finals2000A.all` / `finals2000A.data` file, which have
+ * fixed column formats.
+ *
+ * @return    0 if successful, or else -1 if the line does not contain EOP data in the expected
+ *            format.
+ */
+static int eop_parse_finals(const char *line, novas_eop *e) {
+  const int len = (int) strlen(line);
+
+  if(len < 68 || (line[16] != 'I' && line[16] != 'P'))
+    return -1;
+
+  e->mjd = eop_field(line, len, 7, 8);
+  e->xp = 1000.0 * eop_field(line, len, 18, 9);
+  e->yp = 1000.0 * eop_field(line, len, 37, 9);
+  e->dut1 = eop_field(line, len, 58, 10);
+  e->dx = eop_field(line, len, 97, 9);
+  e->dy = eop_field(line, len, 116, 9);
+
+  return 0;
+}
+
+/**
+ * Parses a line from an IERS EOP C04 file (the 14 C04 or 20 C04 series), which have white-space
+ * separated columns.
+ *
+ * @return    0 if successful, or else -1 if the line does not contain EOP data in the expected
+ *            format.
+ */
+static int eop_parse_c04(const char *line, novas_eop *e) {
+  char *s = (char *) line, *next;
+  double v[10];
+  int k;
+
+  for(k = 0; k < 10; k++) {
+    v[k] = strtod(s, &next);
+    if(next == s)
+      return -1;
+    s = next;
+  }
+
+  // 14 C04: YYYY MM DD MJD x y UT1-UTC LOD dX dY ...
+  // 20 C04: YYYY MM DD HH MJD x y UT1-UTC dX dY ...
+  k = (v[3] > 1000.0) ? 3 : 4;
+
+  e->mjd = v[k];
+  e->xp = 1000.0 * v[k + 1];
+  e->yp = 1000.0 * v[k + 2];
+  e->dut1 = v[k + 3];
+  e->dx = 1000.0 * v[8];
+  e->dy = 1000.0 * v[9];
+
+  return 0;
+}
+
+/**
+ * Reads Earth Orientation Parameters (EOP) from an IERS data file into a table of daily values,
+ * for use with novas_eop_at() or novas_make_eop_frame(). Both the IERS Rapid Service / Prediction
+ * Center files (`finals2000A.all`, `finals2000A.data` etc.), and the EOP C04 series
+ * (`eopc04_14_IAU2000.62-now`, `eopc04.1962-now`) are supported, and the format is detected
+ * automatically for each line. Lines that do not contain EOP data (e.g. headers) are skipped.
+ * For the finals files, reading stops at the first entry without polar motion or UT1-UTC values
+ * (i.e. at the end of the predictions).
+ *
+ * You can obtain IERS EOP files from
+ * <a href="https://www.iers.org/IERS/EN/DataProducts/EarthOrientationData/eop.html">
+ * https://www.iers.org/IERS/EN/DataProducts/EarthOrientationData/eop.html</a>.
+ *
+ * NOTES:
+ * <ol>
+ * <li>Missing celestial pole offsets (dX, dY), e.g. in predictions, are set to zero.</li>
+ * <li>The IAU1980 files (`finals.all`, `finals.data`, `finals.daily`, or the IAU1980 variants of
+ * the 14 C04 or older series, e.g. `eopc04_14.62-now`) store nutation offsets (dPsi, dEps)
+ * relative to the old IAU 1980 nutation model, in the same columns as the IAU2000 files store the
+ * celestial pole offsets (dX, dY). The two cannot be told apart by their content, and so IAU1980
+ * files are recognized by their original IERS names (without "2000" in them), and their
+ * celestial pole offsets are set to zero. Polar motion and UT1 - UTC are read from both. You
+ * should prefer the IAU2000 files (e.g. `finals2000A.all` or `eopc04_14_IAU2000.62-now`) if you
+ * need the celestial pole offsets.</li>
+ * <li>The EOP values are given in the ITRF realization of the data file (e.g. ITRF2020 for
+ * current IERS products). You can use novas_itrf_transform_eop() to convert values to other ITRF
+ * realizations, if necessary.</li>
+ * </ol>
+ *
+ * @param filename    Path to the IERS EOP data file.
+ * @param[out] table  The EOP table to populate. It should be released with
+ *                    novas_close_eop_table() after it is no longer needed.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_eop_at(), novas_make_eop_frame(), novas_write_eop_table(), novas_close_eop_table()
+ */
+int novas_read_eop_table(const char *restrict filename, novas_eop_table *restrict table) {
+  static const char *fn = "novas_read_eop_table";
+
+  novas_eop *eop = NULL;
+  char line[EOP_LINE_LEN];
+  FILE *fp;
+  int n = 0, capacity = 0, iau1980;
+
+  if(!filename || !table)
+    return novas_error(-1, EINVAL, fn, "NULL argument: filename=%p, table=%p", filename, table);
+
+  iau1980 = eop_is_iau1980(filename);
+
+  memset(table, 0, sizeof(*table));
+
+  fp = fopen(filename, "r");
+  if(!fp)
+    return novas_error(-1, errno, fn, "could not open %s: %s", filename, strerror(errno));
+
+  while(fgets(line, sizeof(line), fp)) {
+    novas_eop e;
+
+    if(eop_parse_finals(line, &e) != 0 && eop_parse_c04(line, &e) != 0)
+      continue;
+
+    if(isnan(e.mjd))
+      continue;
+
+    if(isnan(e.xp) || isnan(e.yp) || isnan(e.dut1))
+      break;      // end of predictions
+
+    // dPsi / dEps of IAU1980 files are not celestial pole offsets (dX / dY).
+    if(isnan(e.dx) || iau1980) e.dx = 0.0;
+    if(isnan(e.dy) || iau1980) e.dy = 0.0;
+
+    if(n > 0 && fabs(e.mjd - eop[n - 1].mjd - 1.0) > 1e-6) {
+      fclose(fp);
+      free(eop);
+      return novas_error(-1, EINVAL, fn, "%s: non-consecutive days at MJD %.1f", filename, e.mjd);
+    }
+
+    if(n >= capacity) {
+      novas_eop *old = eop;
+      capacity = capacity ? 2 * capacity : 1024;
+      eop = (novas_eop *) realloc(eop, capacity * sizeof(novas_eop));
+      if(!eop) {
+        fclose(fp);
+        free(old);
+        return novas_error(-1, errno, fn, "alloc error (%d entries): %s", capacity, strerror(errno));
+      }
+    }
+
+    eop[n++] = e;
+  }
+
+  fclose(fp);
+
+  if(n < 2) {
+    free(eop);
+    return novas_error(-1, EINVAL, fn, "not enough EOP data in %s: %d entries", filename, n);
+  }
+
+  table->n = n;
+  table->eop = eop;
+  table->data = eop;
+  table->size = 0;
+
+  return 0;
+}
+
+/**
+ * Writes an EOP table into a compact binary file, which can be opened with
+ * novas_open_eop_table() later, without parsing. The file uses the native binary representation
+ * of the platform, and so it may not be portable to platforms with different byte order or data
+ * layout (which is detected when opening).
+ *
+ * @param filename  Path to the output file. If it exists, it will be overwritten.
+ * @param table     The EOP table, e.g. as read by novas_read_eop_table().
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_open_eop_table(), novas_read_eop_table()
+ */
+int novas_write_eop_table(const char *restrict filename, const novas_eop_table *restrict table) {
+  static const char *fn = "novas_write_eop_table";
+
+  eop_header h;
+  FILE *fp;
+  int ok;
+
+  if(!filename || !table)
+    return novas_error(-1, EINVAL, fn, "NULL argument: filename=%p, table=%p", filename, table);
+
+  if(!filename[0])
+    return novas_error(-1, EINVAL, fn, "empty filename");
+
+  if(table->n < 2 || !table->eop)
+    return novas_error(-1, EINVAL, fn, "invalid EOP table: n=%d, eop=%p", table->n, table->eop);
+
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, EOP_MAGIC, sizeof(EOP_MAGIC));
+  h.version = EOP_VERSION;
+  h.byte_order = EOP_BYTE_ORDER;
+  h.entry_size = sizeof(novas_eop);
+  h.n = table->n;
+
+  fp = fopen(filename, "wb");
+  if(!fp)
+    return novas_error(-1, errno, fn, "could not open %s for writing", filename);
+
+  ok = (fwrite(&h, sizeof(h), 1, fp) == 1);
+  if(ok)
+    ok = (fwrite(table->eop, sizeof(novas_eop), table->n, fp) == (size_t) table->n);
+
+  if(fclose(fp) != 0)
+    ok = 0;
+
+  if(!ok)
+    return novas_error(-1, errno ? errno : EIO, fn, "could not write %s", filename);
+
+  return 0;
+}
+
+/**
+ * Opens a binary EOP table file, written by novas_write_eop_table(). On POSIX platforms, the file
+ * is mapped into memory (read-only), and the EOP values are used from the mapped file directly.
+ * On other platforms the file is read into memory. Either way, the table should be closed with
+ * novas_close_eop_table() after it is no longer needed.
+ *
+ * @param filename    Path to the binary EOP table file.
+ * @param[out] table  The EOP table to populate.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_write_eop_table(), novas_close_eop_table(), novas_eop_at()
+ */
+int novas_open_eop_table(const char *restrict filename, novas_eop_table *restrict table) {
+  static const char *fn = "novas_open_eop_table";
+
+  const eop_header *h;
+  void *data;
+  size_t size;
+
+  if(!filename || !table)
+    return novas_error(-1, EINVAL, fn, "NULL argument: filename=%p, table=%p", filename, table);
+
+  memset(table, 0, sizeof(*table));
+
+  prop_error(fn, novas_map_file(filename, sizeof(eop_header), &data, &size), 0);
+
+  h = (const eop_header *) data;
+
+  if(strncmp(h->magic, EOP_MAGIC, sizeof(h->magic)) != 0) {
+    novas_unmap_file(data, size);
+    return novas_error(-1, EINVAL, fn, "%s is not a binary EOP table", filename);
+  }
+
+  if(h->version != EOP_VERSION) {
+    novas_unmap_file(data, size);
+    return novas_error(-1, EINVAL, fn, "%s has unsupported version %u", filename, (unsigned) h->version);
+  }
+
+  if(h->byte_order != EOP_BYTE_ORDER || h->entry_size != sizeof(novas_eop)) {
+    novas_unmap_file(data, size);
+    return novas_error(-1, EINVAL, fn, "%s was written on an incompatible platform", filename);
+  }
+
+  if(h->n < 2 || h->n > (uint64_t) 0x7fffffff || size != sizeof(eop_header) + h->n * sizeof(novas_eop)) {
+    novas_unmap_file(data, size);
+    return novas_error(-1, EINVAL, fn, "%s has unexpected size: %ld bytes", filename, (long) size);
+  }
+
+  table->n = (int) h->n;
+  table->eop = (const novas_eop *) ((char *) data + sizeof(eop_header));
+  table->data = data;
+  table->size = size;
+
+  return 0;
+}
+
+/**
+ * Closes an EOP table, releasing its memory (or mapping), and resets it to an empty table.
+ *
+ * @param table   The EOP table, previously read by novas_read_eop_table() or opened by
+ *                novas_open_eop_table(). It may be NULL.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_read_eop_table(), novas_open_eop_table()
+ */
+void novas_close_eop_table(novas_eop_table *table) {
+  if(!table)
+    return;
+
+  if(table->size)
+    novas_unmap_file(table->data, table->size);
+  else
+    free(table->data);
+
+  memset(table, 0, sizeof(*table));
+}
+
+/**
+ * Returns the interpolated Earth Orientation Parameters (EOP) for a UTC-based date, using
+ * 4-point Lagrange (cubic) interpolation of the daily values, as recommended by the IERS. UT1 -
+ * UTC is interpolated as UT1 - TAI, using the leap seconds from novas_leap_seconds(), so it is
+ * interpolated correctly across leap seconds also.
+ *
+ * NOTES:
+ * <ol>
+ * <li>The returned values do not include the diurnal and semi-diurnal variations due to
+ * libration and the ocean tides. These are added automatically by novas_set_time() and
+ * novas_make_frame() (or novas_make_eop_frame()). Or, else you can calculate them via
+ * novas_diurnal_eop_at_time().</li>
+ * </ol>
+ *
+ * @param table     The EOP table.
+ * @param jd_utc    [day] UTC-based Julian date.
+ * @param[out] eop  The interpolated EOP values.
+ * @return          0 if successful, or else -1 if there was an error (errno will be set to
+ *                  EINVAL if the arguments are invalid, or ERANGE if the date is outside of the
+ *                  range of the table).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_eop_frame(), novas_read_eop_table(), novas_open_eop_table(),
+ *     novas_diurnal_eop_at_time()
+ */
+int novas_eop_at(const novas_eop_table *restrict table, double jd_utc, novas_eop *restrict eop) {
+  static const char *fn = "novas_eop_at";
+
+  const novas_eop *e;
+  double mjd, u, w[4], tai[4];
+  int i, k, m;
+
+  if(!table || !eop)
+    return novas_error(-1, EINVAL, fn, "NULL argument: table=%p, eop=%p", table, eop);
+
+  if(table->n < 2 || !table->eop)
+    return novas_error(-1, EINVAL, fn, "invalid EOP table: n=%d, eop=%p", table->n, table->eop);
+
+  mjd = jd_utc - MJD0;
+  u = mjd - table->eop[0].mjd;
+
+  if(!(u >= 0.0 && u <= table->n - 1))
+    return novas_error(-1, ERANGE, fn, "date MJD %.3f outside of EOP table range [%.1f:%.1f]", mjd,
+            table->eop[0].mjd, table->eop[table->n - 1].mjd);
+
+  i = (int) floor(u);
+
+  if(table->n < 4) {
+    // Linear interpolation
+    m = 2;
+    k = (i < table->n - 1) ? i : table->n - 2;
+    u -= k;
+    w[0] = 1.0 - u;
+    w[1] = u;
+  }
+  else {
+    // 4-point Lagrange interpolation, on nodes -1, 0, 1, 2 relative to k + 1.
+    m = 4;
+    k = i - 1;
+    if(k < 0)
+      k = 0;
+    else if(k > table->n - 4)
+      k = table->n - 4;
+    u -= k + 1;
+    w[0] = -u * (u - 1.0) * (u - 2.0) / 6.0;
+    w[1] = (u + 1.0) * (u - 1.0) * (u - 2.0) / 2.0;
+    w[2] = -(u + 1.0) * u * (u - 2.0) / 2.0;
+    w[3] = (u + 1.0) * u * (u - 1.0) / 6.0;
+  }
+
+  e = &table->eop[k];
+
+  for(i = 0; i < m; i++)
+    tai[i] = e[i].dut1 - novas_leap_seconds(e[i].mjd + MJD0);
+
+  memset(eop, 0, sizeof(*eop));
+  eop->mjd = mjd;
+
+  for(i = 0; i < m; i++) {
+    eop->xp += w[i] * e[i].xp;
+    eop->yp += w[i] * e[i].yp;
+    eop->dut1 += w[i] * tai[i];
+    eop->dx += w[i] * e[i].dx;
+    eop->dy += w[i] * e[i].dy;
+  }
+
+  eop->dut1 += novas_leap_seconds(jd_utc);
+
+  return 0;
+}
+
+/**
+ * Sets up an observing frame, like novas_make_frame(), but with the Earth Orientation Parameters
+ * (EOP) interpolated from an EOP table for the time of observation, and leap seconds from
+ * novas_leap_seconds(). The diurnal and semi-diurnal corrections for libration and the ocean
+ * tides are added to the interpolated values also, as usual.
+ *
+ * NOTES:
+ * <ol>
+ * <li>Only the Terrestrial Time (TT) of the input time specification is used. The UT1 - TT time
+ * difference of the frame is calculated from the interpolated UT1 - UTC and the leap seconds for
+ * the date, and so it may differ from that of the input time. The time of the frame can be
+ * retrieved from its `time` field.</li>
+ * <li>The celestial pole offsets (dX, dY) are not applied to the frame, in line with
+ * novas_make_frame(). These are below the milliarcsecond level at all times.</li>
+ * </ol>
+ *
+ * @param accuracy    Accuracy requirement, NOVAS_FULL_ACCURACY (0) for the utmost precision or
+ *                    NOVAS_REDUCED_ACCURACY (1) if ~1 mas accuracy is sufficient.
+ * @param obs         Observer location
+ * @param time        Time of observation. Only its TT-based date is used.
+ * @param table       The EOP table, which covers the time of observation.
+ * @param[out] frame  Pointer to the observing frame to configure.
+ * @return            0 if successful,
+ *                    10--40: error is 10 + the error from ephemeris(),
+ *                    40--50: error is 40 + the error from geo_posvel(),
+ *                    or else -1 if there was an error (errno will indicate the type of error,
+ *                    e.g. ERANGE if the time is not covered by the EOP table).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_frame(), novas_eop_at(), novas_leap_seconds(), novas_read_eop_table(),
+ *     novas_open_eop_table()
+ */
+int novas_make_eop_frame(enum novas_accuracy accuracy, const observer *obs, const novas_timespec *time,
+        const novas_eop_table *table, novas_frame *frame) {
+  static const char *fn = "novas_make_eop_frame";
+
+  novas_timespec t = NOVAS_TIMESPEC_INIT;
+  novas_eop eop;
+  double jd_utc;
+  int leap;
+
+  if(!time || !table)
+    return novas_error(-1, EINVAL, fn, "NULL argument: time=%p, table=%p", time, table);
+
+  // UTC date, with the leap seconds for that date (refined once, to be exact around leap seconds).
+  jd_utc = time->ijd_tt + time->fjd_tt - (novas_leap_seconds(time->ijd_tt + time->fjd_tt) + NOVAS_TAI_TO_TT) / DAY;
+  leap = novas_leap_seconds(jd_utc);
+  jd_utc = time->ijd_tt + (time->fjd_tt - (leap + NOVAS_TAI_TO_TT) / DAY);
+
+  prop_error(fn, novas_eop_at(table, jd_utc, &eop), 0);
+  prop_error(fn, novas_set_split_time(NOVAS_TT, time->ijd_tt, time->fjd_tt, leap, eop.dut1, &t), 0);
+  prop_error(fn, novas_make_frame(accuracy, obs, &t, eop.xp, eop.yp, frame), 0);
+
+  return 0;
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
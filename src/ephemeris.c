@@ -293,22 +293,27 @@ short ephemeris(const double *restrict jd_tdb, const object *restrict body, enum
   // type of object
   switch(body->type) {
 
-    case NOVAS_PLANET:
+    case NOVAS_PLANET: {
       // Get the position and velocity of a major planet, Pluto, Sun, or Moon.
       // When high accuracy is specified, use function 'solarsystem_hp' rather
       // than 'solarsystem'.
+      PROFILE_START(t0);
 
       if(accuracy == NOVAS_FULL_ACCURACY)
         error = planet_call_hp(jd_tdb, (enum novas_planet) body->number, (enum novas_origin) origin, pos, vel);
       else
         error = planet_call(jd_tdb[0] + jd_tdb[1], (enum novas_planet) body->number, (enum novas_origin) origin, pos, vel);
 
+      PROFILE_STOP(NOVAS_PROFILE_EPHEMERIS, t0, 1);
+
       prop_error("ephemeris:planet", error, 10);
       break;
+    }
 
     case NOVAS_EPHEM_OBJECT: {
       enum novas_origin eph_origin = NOVAS_HELIOCENTER;
       novas_ephem_provider ephem_call = get_ephem_provider();
+      PROFILE_START(t0);
 
       if(ephem_call) {
         // If there is a newstyle epehemeris access routine set, we will prefer it.
@@ -331,6 +336,8 @@ short ephemeris(const double *restrict jd_tdb, const object *restrict body, enum
 #  endif
       }
 
+      PROFILE_STOP(NOVAS_PROFILE_EPHEMERIS, t0, 1);
+
       prop_error("ephemeris:ephem_object", error, 20);
 
       // Check and adjust the origins as necessary.
@@ -338,8 +345,12 @@ short ephemeris(const double *restrict jd_tdb, const object *restrict body, enum
         double pos0[3] = {0}, vel0[3] = {0};
         enum novas_planet refnum = (origin == NOVAS_BARYCENTER) ? NOVAS_SSB : NOVAS_SUN;
         int i;
+        PROFILE_START(t1);
+
+        error = planet_call(jd_tdb[0] + jd_tdb[1], refnum, eph_origin, pos0, vel0);
+        PROFILE_STOP(NOVAS_PROFILE_EPHEMERIS, t1, 1);
 
-        prop_error("ephemeris:origin", planet_call(jd_tdb[0] + jd_tdb[1], refnum, eph_origin, pos0, vel0), 10);
+        prop_error("ephemeris:origin", error, 10);
 
         for(i = 3; --i >= 0;) {
           posvel[i] -= pos[i];
@@ -215,6 +215,145 @@ int polar_dxdy_to_dpsideps(double jd_tt, double dx, double dy, double *restrict
 }
 /// \endcond
 
+/**
+ * Calculates the complementary terms of the equation of the equinoxes, without caching.
+ *
+ * @param jd_tt_high  [day] High-order part of TT based Julian date.
+ * @param jd_tt_low   [day] Low-order part of TT based Julian date.
+ * @param accuracy    NOVAS_FULL_ACCURACY (0) or NOVAS_REDUCED_ACCURACY (1)
+ * @return            [rad] Complementary terms, in radians.
+ *
+ * @sa ee_ct()
+ */
+static double calc_ee_ct(double jd_tt_high, double jd_tt_low, enum novas_accuracy accuracy) {
+  // @formatter:off
+
+  // Argument multiples and coefficients for time-independent terms.
+  typedef struct {
+    float A;        // Sine coefficient
+    float B;        // Cosie coefficient
+    int8_t n[14];   // argument multiples
+    int8_t from;    // index of first non-zero multiple
+    int8_t to;      // index after last non-zero multiple
+  } ee_terms;
+
+  static const ee_terms terms[33] =  { //
+          //          A         B     0   1   2   3   4   5   6   7  #8  #9 #10 #11 #12  13   frm  to
+          {  2640.96e-6, -0.39e-6, {  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  4,  5 }, //
+          {    63.52e-6, -0.02e-6, {  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  4,  5 }, //
+          {    11.75e-6,  0.01e-6, {  0,  0,  2, -2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {    11.21e-6,  0.01e-6, {  0,  0,  2, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {    -4.55e-6,  0.0    , {  0,  0,  2, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {     2.02e-6,  0.0    , {  0,  0,  2,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {     1.98e-6,  0.0    , {  0,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {    -1.72e-6,  0.0    , {  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  4,  5 }, //
+          {    -1.41e-6, -0.01e-6, {  0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
+          {    -1.26e-6, -0.01e-6, {  0,  1,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
+          {    -0.63e-6,  0.0    , {  1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
+          {    -0.63e-6,  0.0    , {  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
+          {     0.46e-6,  0.0    , {  0,  1,  2, -2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
+          {     0.45e-6,  0.0    , {  0,  1,  2, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
+          {     0.36e-6,  0.0    , {  0,  0,  4, -4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {    -0.24e-6, -0.12e-6, {  0,  0,  1, -1,  1,  0, -8, 12,  0,  0,  0,  0,  0,  0 },  2,  8 }, //
+          {     0.32e-6,  0.0    , {  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  3 }, //
+          {     0.28e-6,  0.0    , {  0,  0,  2,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {     0.27e-6,  0.0    , {  1,  0,  2,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
+          {     0.26e-6,  0.0    , {  1,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
+          {    -0.21e-6,  0.0    , {  0,  0,  2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  4 }, //
+          {     0.19e-6,  0.0    , {  0,  1, -2,  2, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
+          {     0.18e-6,  0.0    , {  0,  1, -2,  2, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
+          {    -0.10e-6,  0.05e-6, {  0,  0,  0,  0,  0,  0,  8,-13,  0,  0,  0,  0,  0, -1 },  6, 14 }, //
+          {     0.15e-6,  0.0    , {  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  3,  4 }, //
+          {    -0.14e-6,  0.0    , {  2,  0, -2,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
+          {     0.14e-6,  0.0    , {  1,  0,  0, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
+          {    -0.14e-6,  0.0    , {  0,  1,  2, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
+          {     0.14e-6,  0.0    , {  1,  0,  0, -2, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
+          {     0.13e-6,  0.0    , {  0,  0,  4, -2,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {    -0.11e-6,  0.0    , {  0,  0,  2, -2,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
+          {     0.11e-6,  0.0    , {  1,  0, -2,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
+          {     0.11e-6,  0.0    , {  1,  0, -2,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }  //
+  };
+
+  // @formatter:on
+
+  const double t = ((jd_tt_high - JD_J2000) + jd_tt_low) / JULIAN_CENTURY_DAYS;
+  double a[14] = {0.0};
+  double sum = 0.0;
+  int i, Nt = 33; // Number of terms to sum...
+
+  // Fill the 5 Earth-Sun-Moon fundamental args
+  fund_args(t, (novas_delaunay_args*) a);
+
+  // Add planet longitudes
+  for(i = NOVAS_MERCURY; i <= NOVAS_EARTH; i++)  // NOTE: Coeffs beyond Earth are zero.
+    a[4 + i] = planet_lon(t, (enum novas_planet) i);
+
+  // General accumulated precession longitude
+  a[13] = accum_prec(t);
+
+  if(accuracy != NOVAS_FULL_ACCURACY) Nt = 8;
+
+  // Evaluate the complementary terms.
+  for(i = Nt; --i >= 0;) {
+    const ee_terms *T = &terms[i];
+    double arg = 0.0;
+    int j;
+
+    for(j = T->from; j < T->to; j++)
+      arg += T->n[j] * a[j];
+
+    sum += T->A * sin(arg);
+    if(T->B)
+      sum += T->B * cos(arg);
+  }
+
+  return (sum - 0.87e-6 * sin(a[4]) * t) * ARCSEC;
+}
+
+/**
+ * Sets the outputs of e_tilt() or e_tilt_ctx() from the nutation angles and the complementary
+ * terms of the equation of the equinoxes.
+ *
+ * @param jd_tdb        [day] Barycentric Dynamical Time (TDB) based Julian date.
+ * @param d_psi         [arcsec] Nutation in longitude, without celestial pole offsets.
+ * @param d_eps         [arcsec] Nutation in obliquity, without celestial pole offsets.
+ * @param ct            [rad] Complementary terms of the equation of the equinoxes.
+ * @param[out] mobl     [deg] Mean obliquity of the ecliptic. It may be NULL if not required.
+ * @param[out] tobl     [deg] True obliquity of the ecliptic. It may be NULL if not required.
+ * @param[out] ee       [s] Equation of the equinoxes in seconds of time. It may be NULL if not
+ *                      required.
+ * @param[out] dpsi     [arcsec] Nutation in longitude. It may be NULL if not required.
+ * @param[out] deps     [arcsec] Nutation in obliquity. It may be NULL if not required.
+ *
+ * @sa e_tilt(), e_tilt_ctx()
+ */
+static void set_e_tilt(double jd_tdb, double d_psi, double d_eps, double ct, double *restrict mobl, double *restrict tobl,
+        double *restrict ee, double *restrict dpsi, double *restrict deps) {
+  double mean_ob;
+
+  d_psi += PSI_COR;
+  d_eps += EPS_COR;
+
+  // Compute mean obliquity of the ecliptic in degrees.
+  mean_ob = mean_obliq(jd_tdb) / 3600.0;
+
+  // Set output values.
+  if(dpsi)
+    *dpsi = d_psi;
+  if(deps)
+    *deps = d_eps;
+  if(ee) {
+    // Obtain complementary terms for equation of the equinoxes in seconds of time.
+    *ee = (d_psi * cos(mean_ob * DEGREE) + ct / ARCSEC) / 15.0;
+  }
+  if(mobl)
+    *mobl = mean_ob;
+  if(tobl) {
+    // Compute true obliquity of the ecliptic in degrees.
+    *tobl = mean_ob + d_eps / 3600.0;
+  }
+}
+
 /**
  * (<i>primarily for internal use</i>) Computes quantities related to the orientation of the
  * Earth's rotation axis at the specified Julian date.
@@ -244,40 +383,62 @@ int polar_dxdy_to_dpsideps(double jd_tt, double dx, double dy, double *restrict
  */
 int e_tilt(double jd_tdb, enum novas_accuracy accuracy, double *restrict mobl, double *restrict tobl,
         double *restrict ee, double *restrict dpsi, double *restrict deps) {
-  double t, d_psi = NAN, d_eps = NAN, mean_ob, true_ob, eqeq;
+  double d_psi = NAN, d_eps = NAN;
 
   if(accuracy != NOVAS_FULL_ACCURACY && accuracy != NOVAS_REDUCED_ACCURACY)
     return novas_error(-1, EINVAL, "e_tilt", "invalid accuracy: %d", accuracy);
 
   // Compute time in Julian centuries from epoch J2000.0.
-  t = (jd_tdb - JD_J2000) / JULIAN_CENTURY_DAYS;
+  nutation_angles((jd_tdb - JD_J2000) / JULIAN_CENTURY_DAYS, accuracy, &d_psi, &d_eps);
 
-  nutation_angles(t, accuracy, &d_psi, &d_eps);
+  set_e_tilt(jd_tdb, d_psi, d_eps, ee_ct(jd_tdb, 0.0, accuracy), mobl, tobl, ee, dpsi, deps);
+  return 0;
+}
 
-  d_psi += PSI_COR;
-  d_eps += EPS_COR;
+/**
+ * Computes quantities related to the orientation of the Earth's rotation axis at the specified
+ * Julian date, like e_tilt(), but using the multi-entry caches of an explicit computation
+ * context for the nutation angles and the complementary terms of the equation of the equinoxes,
+ * instead of the single-entry thread-local caches used by e_tilt().
+ *
+ * @param ctx           The computation context.
+ * @param jd_tdb        [day] Barycentric Dynamical Time (TDB) based Julian date.
+ * @param accuracy      NOVAS_FULL_ACCURACY (0) or NOVAS_REDUCED_ACCURACY (1)
+ * @param[out] mobl     [deg] Mean obliquity of the ecliptic. It may be NULL if not required.
+ * @param[out] tobl     [deg] True obliquity of the ecliptic. It may be NULL if not required.
+ * @param[out] ee       [s] Equation of the equinoxes in seconds of time. It may be NULL if not
+ *                      required.
+ * @param[out] dpsi     [arcsec] Nutation in longitude. It may be NULL if not required.
+ * @param[out] deps     [arcsec] Nutation in obliquity. It may be NULL if not required.
+ * @return              0 if successful, or -1 if the context is NULL or the accuracy argument is
+ *                      invalid (errno will be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa e_tilt(), novas_gast_ctx(), novas_init_context(), NOVAS_EE_CT_CACHE
+ */
+int e_tilt_ctx(novas_context *ctx, double jd_tdb, enum novas_accuracy accuracy, double *restrict mobl,
+        double *restrict tobl, double *restrict ee, double *restrict dpsi, double *restrict deps) {
+  static const char *fn = "e_tilt_ctx";
+  const double key[2] = { jd_tdb, (double) accuracy };
+  double d_psi = NAN, d_eps = NAN, *ct;
 
-  // Compute mean obliquity of the ecliptic in degrees.
-  mean_ob = mean_obliq(jd_tdb) / 3600.0;
+  if(!ctx)
+    return novas_error(-1, EINVAL, fn, "NULL context");
 
-  // Obtain complementary terms for equation of the equinoxes in seconds of time.
-  eqeq = (d_psi * cos(mean_ob * DEGREE) + ee_ct(jd_tdb, 0.0, accuracy) / ARCSEC) / 15.0;
+  if(accuracy != NOVAS_FULL_ACCURACY && accuracy != NOVAS_REDUCED_ACCURACY)
+    return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", accuracy);
 
-  // Compute true obliquity of the ecliptic in degrees.
-  true_ob = mean_ob + d_eps / 3600.0;
+  prop_error(fn, nutation_angles_ctx(ctx, (jd_tdb - JD_J2000) / JULIAN_CENTURY_DAYS, accuracy, &d_psi, &d_eps), 0);
 
-  // Set output values.
-  if(dpsi)
-    *dpsi = d_psi;
-  if(deps)
-    *deps = d_eps;
-  if(ee)
-    *ee = eqeq;
-  if(mobl)
-    *mobl = mean_ob;
-  if(tobl)
-    *tobl = true_ob;
+  ct = novas_cache_lookup(ctx, NOVAS_EE_CT_CACHE, key, 2);
+  if(!ct) {
+    ct = novas_cache_store(ctx, NOVAS_EE_CT_CACHE, key, 2);
+    *ct = calc_ee_ct(jd_tdb, 0.0, accuracy);
+  }
 
+  set_e_tilt(jd_tdb, d_psi, d_eps, *ct, mobl, tobl, ee, dpsi, deps);
   return 0;
 }
 
@@ -446,93 +607,12 @@ double ee_ct(double jd_tt_high, double jd_tt_low, enum novas_accuracy accuracy)
   static THREAD_LOCAL double last_tt = NAN, last_ee;
   static THREAD_LOCAL enum novas_accuracy last_acc = (enum novas_accuracy) -1;
 
-  // @formatter:off
-
-  // Argument multiples and coefficients for time-independent terms.
-  typedef struct {
-    float A;        // Sine coefficient
-    float B;        // Cosie coefficient
-    int8_t n[14];   // argument multiples
-    int8_t from;    // index of first non-zero multiple
-    int8_t to;      // index after last non-zero multiple
-  } ee_terms;
-
-  static const ee_terms terms[33] =  { //
-          //          A         B     0   1   2   3   4   5   6   7  #8  #9 #10 #11 #12  13   frm  to
-          {  2640.96e-6, -0.39e-6, {  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  4,  5 }, //
-          {    63.52e-6, -0.02e-6, {  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  4,  5 }, //
-          {    11.75e-6,  0.01e-6, {  0,  0,  2, -2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {    11.21e-6,  0.01e-6, {  0,  0,  2, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {    -4.55e-6,  0.0    , {  0,  0,  2, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {     2.02e-6,  0.0    , {  0,  0,  2,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {     1.98e-6,  0.0    , {  0,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {    -1.72e-6,  0.0    , {  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  4,  5 }, //
-          {    -1.41e-6, -0.01e-6, {  0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
-          {    -1.26e-6, -0.01e-6, {  0,  1,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
-          {    -0.63e-6,  0.0    , {  1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
-          {    -0.63e-6,  0.0    , {  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
-          {     0.46e-6,  0.0    , {  0,  1,  2, -2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
-          {     0.45e-6,  0.0    , {  0,  1,  2, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
-          {     0.36e-6,  0.0    , {  0,  0,  4, -4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {    -0.24e-6, -0.12e-6, {  0,  0,  1, -1,  1,  0, -8, 12,  0,  0,  0,  0,  0,  0 },  2,  8 }, //
-          {     0.32e-6,  0.0    , {  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  3 }, //
-          {     0.28e-6,  0.0    , {  0,  0,  2,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {     0.27e-6,  0.0    , {  1,  0,  2,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
-          {     0.26e-6,  0.0    , {  1,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
-          {    -0.21e-6,  0.0    , {  0,  0,  2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  4 }, //
-          {     0.19e-6,  0.0    , {  0,  1, -2,  2, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
-          {     0.18e-6,  0.0    , {  0,  1, -2,  2, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
-          {    -0.10e-6,  0.05e-6, {  0,  0,  0,  0,  0,  0,  8,-13,  0,  0,  0,  0,  0, -1 },  6, 14 }, //
-          {     0.15e-6,  0.0    , {  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  3,  4 }, //
-          {    -0.14e-6,  0.0    , {  2,  0, -2,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
-          {     0.14e-6,  0.0    , {  1,  0,  0, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
-          {    -0.14e-6,  0.0    , {  0,  1,  2, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  1,  5 }, //
-          {     0.14e-6,  0.0    , {  1,  0,  0, -2, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
-          {     0.13e-6,  0.0    , {  0,  0,  4, -2,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {    -0.11e-6,  0.0    , {  0,  0,  2, -2,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  2,  5 }, //
-          {     0.11e-6,  0.0    , {  1,  0, -2,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }, //
-          {     0.11e-6,  0.0    , {  1,  0, -2,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },  0,  5 }  //
-  };
-
-  // @formatter:on
-
   if(accuracy != NOVAS_FULL_ACCURACY)
     accuracy = NOVAS_REDUCED_ACCURACY;
 
   // Recalc values only if parameters changed.
   if(!novas_time_equals(jd_tt_high + jd_tt_low, last_tt) || accuracy != last_acc) {
-    const double t = ((jd_tt_high - JD_J2000) + jd_tt_low) / JULIAN_CENTURY_DAYS;
-    double a[14] = {0.0};
-    double sum = 0.0;
-    int i, Nt = 33; // Number of terms to sum...
-
-    // Fill the 5 Earth-Sun-Moon fundamental args
-    fund_args(t, (novas_delaunay_args*) a);
-
-    // Add planet longitudes
-    for(i = NOVAS_MERCURY; i <= NOVAS_EARTH; i++)  // NOTE: Coeffs beyond Earth are zero.
-      a[4 + i] = planet_lon(t, (enum novas_planet) i);
-
-    // General accumulated precession longitude
-    a[13] = accum_prec(t);
-
-    if(accuracy != NOVAS_FULL_ACCURACY) Nt = 8;
-
-    // Evaluate the complementary terms.
-    for(i = Nt; --i >= 0;) {
-      const ee_terms *T = &terms[i];
-      double arg = 0.0;
-      int j;
-
-      for(j = T->from; j < T->to; j++)
-        arg += T->n[j] * a[j];
-
-      sum += T->A * sin(arg);
-      if(T->B)
-        sum += T->B * cos(arg);
-    }
-
-    last_ee = (sum - 0.87e-6 * sin(a[4]) * t) * ARCSEC;
+    last_ee = calc_ee_ct(jd_tt_high, jd_tt_low, accuracy);
     last_tt = jd_tt_high + jd_tt_low;
     last_acc = accuracy;
   }
@@ -586,6 +666,107 @@ int fund_args(double t, novas_delaunay_args *restrict a) {
   return 0;
 }
 
+/**
+ * Calculates the IAU2006 (P03) precession rotation matrix elements for a given time since J2000.
+ *
+ * @param t       [day] TDB-based time since J2000
+ * @param[out] M  The 9 matrix elements in the order xx, yx, zx, xy, yy, zy, xz, yz, zz.
+ *
+ * @sa precession(), precession_ctx()
+ */
+static void precession_matrix(double t, double *restrict M) {
+  double psia, omegaa, chia, sa, ca, sb, cb, sc, cc, sd, cd, t1, t2;
+  double eps0 = 84381.406;
+
+  // Now change t to Julian centuries
+  t /= JULIAN_CENTURY_DAYS;
+
+  // Numerical coefficients of psi_a, omega_a, and chi_a, along with
+  // epsilon_0, the obliquity at J2000.0, are 4-angle formulation from
+  // Capitaine et al. (2003), eqs. (4), (37), & (39).
+  // This is the standard IAU2006 precession a.k.a. P03 model.
+  psia = ((((-0.0000000951 * t + 0.000132851) * t - 0.00114045) * t - 1.0790069) * t + 5038.481507) * t;
+  omegaa = ((((+0.0000003337 * t - 0.000000467) * t - 0.00772503) * t + 0.0512623) * t - 0.025754) * t + eps0;
+  chia = ((((-0.0000000560 * t + 0.000170663) * t - 0.00121197) * t - 2.3814292) * t + 10.556403) * t;
+
+  // P03rev2 / Capitaine at al. (2005) eqs. (11)
+  // It is a slight improvement on P03 with extended VLBI data.
+  //psia = t * (5038.482090 + t * (-1.0789921 + t * (-0.00114040 + t * (0.000132851 - t * 0.0000000951))));
+  //omegaa = eps0 + t * (-0.025675 + t * (0.0512622 + t * (-0.00772501 + t * (-0.000000467 + t * 0.0000003337))));
+
+  // Liu & Capitaine (2017)
+  // This model incorporates new VLBI data to improve contraints on the eate of change of Earth flattening
+  //chia = t * (10.556240 + t * (-2.3813876 + t * (-0.00121311 + t * (0.000160286 + t * 0.000000086))));
+  //psia = t * (5038.481270 + t * (-1.0732468 + t * (0.01573403 + t * (0.000127135 - t * 0.0000001020))));
+  //omegaa = eps0 + t * (-0.024725 + t * (0.0512626 + t * (-0.0077249 + t * (-0.000000267 + t * 0.000000267))));
+
+  // Liu, Capitaine, & Cheng (2019)
+  // Another update on LC17 with new VLBI data
+  //chia = t * (10.556240 + t * (-2.3813876 + t * (-0.00121311 + t * (0.000160286 + t * 0.000000086))));
+  //psia = t * (5038.482041 + t * (-1.072687 + t * (0.0278555 + t * (0.00012342 - t * 0.0000001096))));
+  //omegaa = eps0 + t * (-0.025754 + t * (0.0512626 + t * (-0.0077249 + t * (-0.000000086 + t * 0.000000221))));
+
+  eps0 *= ARCSEC;
+  psia *= ARCSEC;
+  omegaa *= ARCSEC;
+  chia *= ARCSEC;
+
+  sa = sin(eps0);
+  ca = cos(eps0);
+  sb = sin(-psia);
+  cb = cos(-psia);
+  sc = sin(-omegaa);
+  cc = cos(-omegaa);
+  sd = sin(chia);
+  cd = cos(chia);
+
+  // Compute elements of precession rotation matrix equivalent to
+  // R3(chi_a) R1(-omega_a) R3(-psi_a) R1(epsilon_0).
+  t1 = cd * sb + sd * cc * cb;
+  t2 = sd * sc;
+  M[0] = cd * cb - sb * sd * cc;
+  M[1] = ca * t1 - sa * t2;
+  M[2] = sa * t1 + ca * t2;
+
+  t1 = cd * cc * cb - sd * sb;
+  t2 = cd * sc;
+  M[3] = -sd * cb - sb * cd * cc;
+  M[4] = ca * t1 - sa * t2;
+  M[5] = sa * t1 + ca * t2;
+
+  M[6] = sb * sc;
+  M[7] = -sc * cb * ca - sa * cc;
+  M[8] = -sc * cb * sa + cc * ca;
+}
+
+/**
+ * Rotates a vector by a precession matrix, either forward from J2000 to the epoch of the matrix,
+ * or backward from the epoch of the matrix to J2000.
+ *
+ * @param M         The 9 precession matrix elements, as returned by precession_matrix().
+ * @param to_j2000  Whether to rotate to J2000 (true), or from J2000 (false).
+ * @param in        Input 3-vector
+ * @param[out] out  Output 3-vector. It can be the same as the input.
+ *
+ * @sa precession_matrix()
+ */
+static void precession_rotate(const double *restrict M, int to_j2000, const double *in, double *out) {
+  const double x = in[0], y = in[1], z = in[2];
+
+  if(to_j2000) {
+    // Perform rotation from epoch to J2000.0.
+    out[0] = M[0] * x + M[3] * y + M[6] * z;
+    out[1] = M[1] * x + M[4] * y + M[7] * z;
+    out[2] = M[2] * x + M[5] * y + M[8] * z;
+  }
+  else {
+    // Perform rotation from J2000.0 to epoch.
+    out[0] = M[0] * x + M[1] * y + M[2] * z;
+    out[1] = M[3] * x + M[4] * y + M[5] * z;
+    out[2] = M[6] * x + M[7] * y + M[8] * z;
+  }
+}
+
 /**
  * Precesses equatorial rectangular coordinates from one epoch to another using the IAU2006 (P03)
  * precession model of Capitaine et al. 2003.
@@ -628,7 +809,7 @@ int fund_args(double t, novas_delaunay_args *restrict a) {
  */
 short precession(double jd_tdb_in, const double *in, double jd_tdb_out, double *out) {
   static THREAD_LOCAL double djd_last[2] = { NAN, NAN };
-  static THREAD_LOCAL double xx[2], yx[2], zx[2], xy[2], yy[2], zy[2], xz[2], yz[2], zz[2];
+  static THREAD_LOCAL double M[2][9];
 
   double t;
   int i = 0;
@@ -650,7 +831,7 @@ short precession(double jd_tdb_in, const double *in, double jd_tdb_out, double *
     return 0;
   }
 
-  // 't' is time in TDB centuries between the two epochs.
+  // 't' is time in TDB days between the two epochs.
   t = (jd_tdb_out - jd_tdb_in);
   if(jd_tdb_out == JD_J2000) {
     t = -t;
@@ -658,87 +839,76 @@ short precession(double jd_tdb_in, const double *in, double jd_tdb_out, double *
   }
 
   if(!novas_time_equals(t, djd_last[i])) {
-    double psia, omegaa, chia, sa, ca, sb, cb, sc, cc, sd, cd, t1, t2;
-    double eps0 = 84381.406;
-
+    precession_matrix(t, M[i]);
     djd_last[i] = t;
+  }
+
+  precession_rotate(M[i], jd_tdb_out == JD_J2000, in, out);
 
-    // Now change t to Julian centuries
-    t /= JULIAN_CENTURY_DAYS;
-
-    // Numerical coefficients of psi_a, omega_a, and chi_a, along with
-    // epsilon_0, the obliquity at J2000.0, are 4-angle formulation from
-    // Capitaine et al. (2003), eqs. (4), (37), & (39).
-    // This is the standard IAU2006 precession a.k.a. P03 model.
-    psia = ((((-0.0000000951 * t + 0.000132851) * t - 0.00114045) * t - 1.0790069) * t + 5038.481507) * t;
-    omegaa = ((((+0.0000003337 * t - 0.000000467) * t - 0.00772503) * t + 0.0512623) * t - 0.025754) * t + eps0;
-    chia = ((((-0.0000000560 * t + 0.000170663) * t - 0.00121197) * t - 2.3814292) * t + 10.556403) * t;
-
-    // P03rev2 / Capitaine at al. (2005) eqs. (11)
-    // It is a slight improvement on P03 with extended VLBI data.
-    //psia = t * (5038.482090 + t * (-1.0789921 + t * (-0.00114040 + t * (0.000132851 - t * 0.0000000951))));
-    //omegaa = eps0 + t * (-0.025675 + t * (0.0512622 + t * (-0.00772501 + t * (-0.000000467 + t * 0.0000003337))));
-
-    // Liu & Capitaine (2017)
-    // This model incorporates new VLBI data to improve contraints on the eate of change of Earth flattening
-    //chia = t * (10.556240 + t * (-2.3813876 + t * (-0.00121311 + t * (0.000160286 + t * 0.000000086))));
-    //psia = t * (5038.481270 + t * (-1.0732468 + t * (0.01573403 + t * (0.000127135 - t * 0.0000001020))));
-    //omegaa = eps0 + t * (-0.024725 + t * (0.0512626 + t * (-0.0077249 + t * (-0.000000267 + t * 0.000000267))));
-
-    // Liu, Capitaine, & Cheng (2019)
-    // Another update on LC17 with new VLBI data
-    //chia = t * (10.556240 + t * (-2.3813876 + t * (-0.00121311 + t * (0.000160286 + t * 0.000000086))));
-    //psia = t * (5038.482041 + t * (-1.072687 + t * (0.0278555 + t * (0.00012342 - t * 0.0000001096))));
-    //omegaa = eps0 + t * (-0.025754 + t * (0.0512626 + t * (-0.0077249 + t * (-0.000000086 + t * 0.000000221))));
-
-    eps0 *= ARCSEC;
-    psia *= ARCSEC;
-    omegaa *= ARCSEC;
-    chia *= ARCSEC;
-
-    sa = sin(eps0);
-    ca = cos(eps0);
-    sb = sin(-psia);
-    cb = cos(-psia);
-    sc = sin(-omegaa);
-    cc = cos(-omegaa);
-    sd = sin(chia);
-    cd = cos(chia);
-
-    // Compute elements of precession rotation matrix equivalent to
-    // R3(chi_a) R1(-omega_a) R3(-psi_a) R1(epsilon_0).
-    t1 = cd * sb + sd * cc * cb;
-    t2 = sd * sc;
-    xx[i] = cd * cb - sb * sd * cc;
-    yx[i] = ca * t1 - sa * t2;
-    zx[i] = sa * t1 + ca * t2;
-
-    t1 = cd * cc * cb - sd * sb;
-    t2 = cd * sc;
-    xy[i] = -sd * cb - sb * cd * cc;
-    yy[i] = ca * t1 - sa * t2;
-    zy[i] = sa * t1 + ca * t2;
-
-    xz[i] = sb * sc;
-    yz[i] = -sc * cb * ca - sa * cc;
-    zz[i] = -sc * cb * sa + cc * ca;
+  return 0;
+}
+
+/**
+ * Precesses equatorial rectangular coordinates from one epoch to another using the IAU2006 (P03)
+ * precession model, like precession(), but using the multi-entry cache of an explicit
+ * computation context for the precession matrices, instead of the thread-local cache of
+ * precession(), which holds just one matrix for each direction of the precession.
+ *
+ * @param ctx         The computation context.
+ * @param jd_tdb_in   [day] Barycentric Dynamic Time (TDB) based Julian date of the input
+ *                    epoch
+ * @param in          Position 3-vector, geocentric equatorial rectangular coordinates,
+ *                    referred to mean dynamical equator and equinox of the initial epoch.
+ * @param jd_tdb_out  [day] Barycentric Dynamic Time (TDB) based Julian date of the output
+ *                    epoch
+ * @param[out] out    Position 3-vector, geocentric equatorial rectangular coordinates,
+ *                    referred to mean dynamical equator and equinox of the final epoch.
+ *                    It can be the same vector as the input.
+ * @return            0 if successful, or -1 if the context or either of the position vectors is
+ *                    NULL (errno will be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa precession(), novas_init_context(), NOVAS_PRECESSION_CACHE
+ */
+int precession_ctx(novas_context *ctx, double jd_tdb_in, const double *in, double jd_tdb_out, double *out) {
+  static const char *fn = "precession_ctx";
+  double key[1], *M;
+  int to_j2000;
+
+  if(!ctx)
+    return novas_error(-1, EINVAL, fn, "NULL context");
+
+  if(!in || !out)
+    return novas_error(-1, EINVAL, fn, "NULL input or output 3-vector: in=%p, out=%p", in, out);
+
+  if(jd_tdb_in == jd_tdb_out) {
+    if(out != in)
+      memcpy(out, in, XYZ_VECTOR_SIZE);
+    return 0;
   }
 
-  if(jd_tdb_out == JD_J2000) {
-    const double x = in[0], y = in[1], z = in[2];
-    // Perform rotation from epoch to J2000.0.
-    out[0] = xx[1] * x + xy[1] * y + xz[1] * z;
-    out[1] = yx[1] * x + yy[1] * y + yz[1] * z;
-    out[2] = zx[1] * x + zy[1] * y + zz[1] * z;
+  if(!novas_time_equals(jd_tdb_in, JD_J2000) && !novas_time_equals(jd_tdb_out, JD_J2000)) {
+    // Do the precession in two steps...
+    precession_ctx(ctx, jd_tdb_in, in, JD_J2000, out);
+    precession_ctx(ctx, JD_J2000, out, jd_tdb_out, out);
+    return 0;
   }
-  else {
-    const double x = in[0], y = in[1], z = in[2];
-    // Perform rotation from J2000.0 to epoch.
-    out[0] = xx[0] * x + yx[0] * y + zx[0] * z;
-    out[1] = xy[0] * x + yy[0] * y + zy[0] * z;
-    out[2] = xz[0] * x + yz[0] * y + zz[0] * z;
+
+  // The matrix is keyed by the time of the non-J2000 epoch relative to J2000, so the same matrix
+  // serves both directions.
+  to_j2000 = (jd_tdb_out == JD_J2000);
+  key[0] = to_j2000 ? jd_tdb_in - JD_J2000 : jd_tdb_out - jd_tdb_in;
+
+  M = novas_cache_lookup(ctx, NOVAS_PRECESSION_CACHE, key, 1);
+  if(!M) {
+    M = novas_cache_store(ctx, NOVAS_PRECESSION_CACHE, key, 1);
+    precession_matrix(key[0], M);
   }
 
+  precession_rotate(M, to_j2000, in, out);
+
   return 0;
 }
 
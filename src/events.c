@@ -0,0 +1,689 @@
+/**
+ * @file
+ *
+ *  A generic time-domain event finder for observables that can be calculated for an observing
+ *  frame, such as the elevation of a source, its angular distance from the Sun or Moon, the
+ *  separation between two sources, the phase of the Moon, or any other user-defined quantity.
+ *
+ *  The event finder samples the observable over a time interval, at a user-defined step, and
+ *  then refines the bracketed crossings of a given level via the Illinois variant of the
+ *  _regula falsi_ method, and the bracketed extrema via Brent's method. As such, it needs only a
+ *  handful of observing frames to locate each event to the requested precision, which is much
+ *  faster than fine-grained sampling. The most recently constructed frames (up to 4) are
+ *  memoized during a search, so they are reused, rather than recalculated, when the same instants
+ *  are evaluated again while the bracketing points of the search remain within the memo.
+ *
+ *  For example, to find astronomical twilight (the Sun crossing -18 degrees elevation) during
+ *  the 24 hours after the time of a frame:
+ *
+ * ```c
+ *   novas_frame frame = ...;      // observing frame for the start of the search.
+ *   object sun = NOVAS_SUN_INIT;  // We'll track the Sun's elevation
+ *   novas_event_finder finder = NOVAS_EVENT_FINDER_INIT;
+ *   novas_event events[4];
+ *   int i, n;
+ *
+ *   finder.func = novas_event_elevation;
+ *   finder.arg = &sun;
+ *   finder.level = -18.0;                   // [deg]
+ *   finder.types = NOVAS_EVENT_CROSSING;    // both rising and falling crossings
+ *
+ *   n = novas_find_events(&finder, &frame, 1.0, events, 4);
+ *
+ *   for(i = 0; i < n && i < 4; i++) {
+ *     double jd_utc = novas_get_time(&events[i].time, NOVAS_UTC);
+ *     ...
+ *   }
+ * ```
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa frames.c, planets.c
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+#define EVENT_FRAME_CACHE     4             ///< Number of frames memoized during an event search
+#define EVENT_DEFAULT_TOL     1e-3          ///< [s] Default time tolerance for event refinement
+#define GOLDEN_RATIO_C        0.3819660112501051  ///< (3 - sqrt(5)) / 2 for golden section search
+
+/**
+ * The state of an event search, with the memoized frames.
+ */
+typedef struct {
+  const novas_event_finder *finder;         ///< The search parameters
+  const novas_frame *frame0;                ///< The frame for the start of the search interval
+  double xp;                                ///< [mas] x pole offset, without diurnal corrections
+  double yp;                                ///< [mas] y pole offset, without diurnal corrections
+  novas_frame frames[EVENT_FRAME_CACHE];    ///< Memoized frames
+  double dt[EVENT_FRAME_CACHE];             ///< [day] Time offsets of memoized frames
+  int n_cached;                             ///< Number of valid memoized frames
+  int next;                                 ///< Index of next memoized frame to replace
+} event_search;
+/// \endcond
+
+/**
+ * Returns the observing frame for the specified time offset from the start of the search,
+ * either from the memoized frames, or else by constructing a new frame (and memoizing it).
+ *
+ * @param s       Search state
+ * @param dt      [day] Time offset from start of search
+ * @return        Pointer to the frame for the given time, or NULL if it could not be
+ *                constructed.
+ */
+static const novas_frame *event_frame(event_search *s, double dt) {
+  static const char *fn = "event_frame";
+  const novas_frame *f0 = s->frame0;
+  novas_timespec t;
+  novas_frame *f;
+  int i;
+
+  if(dt == 0.0)
+    return f0;
+
+  for(i = 0; i < s->n_cached; i++)
+    if(s->dt[i] == dt)
+      return &s->frames[i];
+
+  f = &s->frames[s->next];
+
+  novas_offset_time(&f0->time, dt * DAY, &t);
+  if(novas_make_frame(f0->accuracy, &f0->observer, &t, s->xp, s->yp, f) != 0) {
+    novas_trace_nan(fn);
+    return NULL;
+  }
+
+  s->dt[s->next] = dt;
+  if(s->n_cached < EVENT_FRAME_CACHE)
+    s->n_cached++;
+  s->next = (s->next + 1) % EVENT_FRAME_CACHE;
+
+  return f;
+}
+
+/**
+ * Evaluates the observable at the specified time offset from the start of the search.
+ *
+ * @param s       Search state
+ * @param dt      [day] Time offset from start of search
+ * @return        The value of the observable at the given time, or NAN if the observable
+ *                could not be evaluated.
+ */
+static double event_eval(event_search *s, double dt) {
+  static const char *fn = "event_eval";
+  const novas_frame *f = event_frame(s, dt);
+  double value;
+
+  if(!f)
+    return novas_trace_nan(fn);
+
+  value = s->finder->func(f, s->finder->arg);
+  if(isnan(value))
+    return novas_trace_nan(fn);
+
+  return value;
+}
+
+/**
+ * Returns the difference between two values of the observable, wrapped to [-P/2:P/2) for
+ * periodic observables with period P.
+ */
+static double event_diff(const event_search *s, double a, double b) {
+  double d = a - b;
+  if(s->finder->period > 0.0)
+    d = remainder(d, s->finder->period);
+  return d;
+}
+
+/**
+ * Locates the time at which the observable crosses the search level inside a bracketing
+ * interval, using the Illinois variant of the _regula falsi_ method.
+ *
+ * @param s         Search state
+ * @param a         [day] Start of the bracketing interval, relative to start of search
+ * @param ga        Observable minus level at the start of the bracketing interval
+ * @param b         [day] End of the bracketing interval, relative to start of search
+ * @param gb        Observable minus level at the end of the bracketing interval
+ * @param tol       [day] Time tolerance
+ * @param[out] t    [day] The time offset of the crossing, relative to start of search
+ * @return          0 if successful, or else -1 if the observable could not be evaluated, or
+ *                  the solution failed to converge (errno set to ECANCELED).
+ */
+static int event_root(event_search *s, double a, double ga, double b, double gb, double tol, double *t) {
+  static const char *fn = "event_root";
+  double c = a;
+  int i, side = 0;
+
+  for(i = 0; i < novas_inv_max_iter; i++) {
+    double last = c, gc;
+
+    c = (a * gb - b * ga) / (gb - ga);
+
+    if(fabs(c - last) < tol || fabs(b - a) < tol) {
+      *t = c;
+      return 0;
+    }
+
+    gc = event_eval(s, c);
+    if(isnan(gc))
+      return novas_trace(fn, -1, 0);
+
+    gc = event_diff(s, gc, s->finder->level);
+
+    if(gc * gb > 0.0) {
+      b = c;
+      gb = gc;
+      if(side == -1)
+        ga *= 0.5;
+      side = -1;
+    }
+    else if(gc * ga > 0.0) {
+      a = c;
+      ga = gc;
+      if(side == 1)
+        gb *= 0.5;
+      side = 1;
+    }
+    else {
+      *t = c;
+      return 0;
+    }
+  }
+
+  return novas_error(-1, ECANCELED, fn, "failed to converge");
+}
+
+/**
+ * Locates an extremum of the observable inside a bracketing interval, using Brent's method
+ * (parabolic interpolation, with golden section steps as a fallback).
+ *
+ * REFERENCES:
+ * <ol>
+ * <li>Brent, R. P. 1973, Algorithms for Minimization without Derivatives, Prentice-Hall,
+ * Chapter 5.</li>
+ * </ol>
+ *
+ * @param s         Search state
+ * @param a         [day] Start of the bracketing interval, relative to start of search
+ * @param b         [day] End of the bracketing interval, relative to start of search
+ * @param x0        [day] A point inside the bracket, where the observable is more extreme than
+ *                  at either end.
+ * @param f0        The observable at x0
+ * @param sign      1 for minimum or -1 for maximum.
+ * @param tol       [day] Time tolerance
+ * @param[out] t    [day] Time offset of the extremum, relative to start of search
+ * @param[out] value  Observable value at the extremum
+ * @return          0 if successful, or else -1 if the observable could not be evaluated, or
+ *                  the solution failed to converge (errno set to ECANCELED).
+ */
+static int event_extremum(event_search *s, double a, double b, double x0, double f0, int sign, double tol,
+        double *t, double *value) {
+  static const char *fn = "event_extremum";
+
+  // Observables are measured relative to f0 (and wrapped for periodic observables) to keep
+  // them continuous inside the bracket.
+  double x = x0, w = x0, v = x0;
+  double fx = 0.0, fw = 0.0, fv = 0.0;
+  double d = 0.0, e = 0.0;
+  int i;
+
+  for(i = 0; i < novas_inv_max_iter; i++) {
+    double m = 0.5 * (a + b), u, fu;
+
+    if(fabs(x - m) <= 2.0 * tol - 0.5 * (b - a)) {
+      *t = x;
+      *value = f0 + sign * fx;
+      return 0;
+    }
+
+    if(fabs(e) > tol) {
+      // Try parabolic step
+      double r = (x - w) * (fx - fv);
+      double q = (x - v) * (fx - fw);
+      double p = (x - v) * q - (x - w) * r;
+
+      q = 2.0 * (q - r);
+      if(q > 0.0)
+        p = -p;
+      else
+        q = -q;
+
+      r = e;
+      e = d;
+
+      if(fabs(p) < fabs(0.5 * q * r) && p > q * (a - x) && p < q * (b - x)) {
+        d = p / q;
+        u = x + d;
+        if((u - a) < 2.0 * tol || (b - u) < 2.0 * tol)
+          d = (x < m) ? tol : -tol;
+      }
+      else {
+        e = (x < m) ? b - x : a - x;
+        d = GOLDEN_RATIO_C * e;
+      }
+    }
+    else {
+      // Golden section step
+      e = (x < m) ? b - x : a - x;
+      d = GOLDEN_RATIO_C * e;
+    }
+
+    u = x + (fabs(d) >= tol ? d : (d > 0.0 ? tol : -tol));
+
+    fu = event_eval(s, u);
+    if(isnan(fu))
+      return novas_trace(fn, -1, 0);
+
+    fu = sign * event_diff(s, fu, f0);
+
+    if(fu <= fx) {
+      if(u < x)
+        b = x;
+      else
+        a = x;
+
+      v = w;
+      fv = fw;
+      w = x;
+      fw = fx;
+      x = u;
+      fx = fu;
+    }
+    else {
+      if(u < x)
+        a = u;
+      else
+        b = u;
+
+      if(fu <= fw || w == x) {
+        v = w;
+        fv = fw;
+        w = u;
+        fw = fu;
+      }
+      else if(fu <= fv || v == x || v == w) {
+        v = u;
+        fv = fu;
+      }
+    }
+  }
+
+  return novas_error(-1, ECANCELED, fn, "failed to converge");
+}
+
+/**
+ * Adds an event to the time-ordered list of events, keeping only the earliest events if the
+ * list is full.
+ *
+ * @param s           Search state
+ * @param type        The type of event
+ * @param dt          [day] Time offset of the event, relative to start of search
+ * @param value       Observable value at the event.
+ * @param events      List of events found so far, ordered by time.
+ * @param n           Number of events found so far (may exceed n_max).
+ * @param n_max       Capacity of the list of events.
+ */
+static void event_add(const event_search *s, enum novas_event_type type, double dt, double value, novas_event *events,
+        int n, int n_max) {
+  novas_event ev = NOVAS_EVENT_INIT;
+  int i;
+
+  if(n >= n_max) {
+    if(n_max <= 0 || dt >= events[n_max - 1].dt)
+      return;
+    n = n_max - 1;
+  }
+
+  ev.type = type;
+  ev.dt = dt;
+  ev.value = value;
+  novas_offset_time(&s->frame0->time, dt * DAY, &ev.time);
+
+  for(i = n; i > 0 && events[i - 1].dt > dt; i--)
+    events[i] = events[i - 1];
+
+  events[i] = ev;
+}
+
+/**
+ * Finds all events of the requested types, in which an observable crosses a level, and / or
+ * reaches a local extremum, within the specified time interval. The observable is first sampled
+ * at the finder's time step over the search interval, and bracketed events are then refined
+ * to the requested precision via the Illinois variant of _regula falsi_ (for crossings) or
+ * Brent's method (for extrema).
+ *
+ * The sampling step must be short enough to resolve all events of interest. Crossings that are
+ * closer together than the sampling step (e.g. a source that barely rises above the level and
+ * sets again within one step), or extrema less than a step apart, may be missed.
+ *
+ * Observing frames for the sampled times are constructed with the same accuracy, observer
+ * location, and Earth orientation parameters as the input frame. The last few (4) of them are
+ * memoized during the search, so the bracketing points of a refinement are not recalculated while
+ * they remain in the memo.
+ *
+ * NOTES:
+ * <ol>
+ * <li>Extrema are located only in the interior of the search interval, i.e. the boundaries of
+ * the interval are never reported as extrema.</li>
+ * <li>For full accuracy frames, the polar offsets of the input frame include the diurnal
+ * corrections for libration and ocean tides at the time of the input frame. These are removed
+ * from the polar offsets that are used for the frames constructed during the search, which then
+ * include the diurnal corrections for their own times instead.</li>
+ * </ol>
+ *
+ * @param finder      The event search parameters, including the observable.
+ * @param frame       Observing frame, which defines the observer location, the accuracy, and the
+ *                    start time of the search interval.
+ * @param span        [day] The duration of the search interval (&gt; 0).
+ * @param[out] events Array to populate with the events found, in chronological order. It may be
+ *                    NULL if `n_max` is 0.
+ * @param n_max       The maximum number of events to return, i.e. the number of elements
+ *                    available in the `events` array. If more events are found, only the
+ *                    earliest `n_max` are returned.
+ * @return            The total number of events found in the interval (which may be larger than
+ *                    `n_max`), or else -1 if there was an error (errno will indicate the type
+ *                    of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa NOVAS_EVENT_FINDER_INIT, novas_event_elevation(), novas_event_sun_angle(),
+ *     novas_event_moon_angle(), novas_event_separation(), novas_event_moon_phase(),
+ *     novas_event_solar_illum()
+ * @sa novas_rises_above(), novas_sets_below(), novas_transit_time(), novas_next_moon_phase()
+ */
+int novas_find_events(const novas_event_finder *restrict finder, const novas_frame *restrict frame, double span,
+        novas_event *restrict events, int n_max) {
+  static const char *fn = "novas_find_events";
+
+  event_search s;
+  double step, tol, f[3] = {0.0}, t[3] = {0.0};
+  int i, k, N, n = 0;
+
+  if(!finder || !frame)
+    return novas_error(-1, EINVAL, fn, "NULL argument: finder=%p, frame=%p", finder, frame);
+
+  if(!finder->func)
+    return novas_error(-1, EINVAL, fn, "NULL observable function");
+
+  if(!novas_frame_is_initialized(frame))
+    return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
+
+  if(!(span > 0.0))
+    return novas_error(-1, EINVAL, fn, "invalid search interval: %g days", span);
+
+  if(!(finder->step > 0.0))
+    return novas_error(-1, EINVAL, fn, "invalid sampling step: %g days", finder->step);
+
+  if(finder->period < 0.0)
+    return novas_error(-1, EINVAL, fn, "invalid period: %g", finder->period);
+
+  if(finder->tol < 0.0)
+    return novas_error(-1, EINVAL, fn, "invalid time tolerance: %g s", finder->tol);
+
+  if(n_max < 0 || (n_max > 0 && !events))
+    return novas_error(-1, EINVAL, fn, "invalid output events: %p [%d]", events, n_max);
+
+  if(!(finder->types & NOVAS_EVENT_ANY))
+    return novas_error(-1, EINVAL, fn, "no event types selected: 0x%x", finder->types);
+
+  memset(&s, 0, sizeof(s));
+  s.finder = finder;
+  s.frame0 = frame;
+
+  // The polar offsets of full accuracy frames include the diurnal corrections for the time of the
+  // frame. Remove them, so frames at other times get the diurnal corrections for their own time.
+  novas_frame_require(frame, FRAME_DIURNAL_EOP);
+  s.xp = frame->dx;
+  s.yp = frame->dy;
+
+  if(frame->accuracy == NOVAS_FULL_ACCURACY) {
+    double dxp = 0.0, dyp = 0.0;
+    novas_diurnal_eop_at_time(&frame->time, &dxp, &dyp, NULL);
+    s.xp -= 0.001 * dxp;
+    s.yp -= 0.001 * dyp;
+  }
+
+  N = (int) ceil(span / finder->step);
+  step = span / N;
+  tol = (finder->tol > 0.0 ? finder->tol : EVENT_DEFAULT_TOL) / DAY;
+
+  // t[], f[] are the last three samples (previous, current, next)
+  t[2] = 0.0;
+  f[2] = event_eval(&s, 0.0);
+  if(isnan(f[2]))
+    return novas_trace(fn, -1, 0);
+
+  for(i = 1; i <= N; i++) {
+    for(k = 0; k < 2; k++) {
+      t[k] = t[k + 1];
+      f[k] = f[k + 1];
+    }
+
+    t[2] = (i == N) ? span : i * step;
+    f[2] = event_eval(&s, t[2]);
+    if(isnan(f[2]))
+      return novas_trace(fn, -1, 0);
+
+    // Extremum around t[1]?
+    if(i > 1 && (finder->types & NOVAS_EVENT_EXTREMUM)) {
+      double d1 = event_diff(&s, f[1], f[0]);
+      double d2 = event_diff(&s, f[2], f[1]);
+      int sign = 0;
+
+      if(d1 > 0.0 && d2 <= 0.0 && (finder->types & NOVAS_EVENT_MAXIMUM))
+        sign = -1;
+      else if(d1 < 0.0 && d2 >= 0.0 && (finder->types & NOVAS_EVENT_MINIMUM))
+        sign = 1;
+
+      if(sign) {
+        double te = 0.0, fe = 0.0;
+        prop_error(fn, event_extremum(&s, t[0], t[2], t[1], f[1], sign, tol, &te, &fe), 0);
+        event_add(&s, sign < 0 ? NOVAS_EVENT_MAXIMUM : NOVAS_EVENT_MINIMUM, te, fe, events, n++, n_max);
+      }
+    }
+
+    // Crossing between t[1] and t[2]?
+    if(finder->types & NOVAS_EVENT_CROSSING) {
+      double g1 = event_diff(&s, f[1], finder->level);
+      double g2 = event_diff(&s, f[2], finder->level);
+      enum novas_event_type type = (g2 > g1) ? NOVAS_EVENT_RISING : NOVAS_EVENT_FALLING;
+
+      // Skip wraps of periodic observables (jump by ~period in one step).
+      if(finder->period > 0.0 && fabs(g2 - g1) > 0.5 * finder->period)
+        continue;
+
+      if(((g1 < 0.0 && g2 >= 0.0) || (g1 > 0.0 && g2 <= 0.0)) && (finder->types & type)) {
+        double tc = 0.0;
+
+        if(g2 == 0.0)
+          tc = t[2];
+        else
+          prop_error(fn, event_root(&s, t[1], g1, t[2], g2, tol, &tc), 0);
+
+        event_add(&s, type, tc, finder->level, events, n++, n_max);
+      }
+    }
+  }
+
+  return n;
+}
+
+/**
+ * Observable for novas_find_events(): the unrefracted (astrometric) elevation angle of a source,
+ * for an observer located on or above Earth's surface.
+ *
+ * @param frame     Observing frame, with an Earth-bound observer.
+ * @param arg       Pointer to the observed source (`const object *`).
+ * @return          [deg] The unrefracted elevation angle of the source, or else NAN if there was
+ *                  an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_find_events(), novas_app_to_hor()
+ */
+double novas_event_elevation(const novas_frame *restrict frame, const void *restrict arg) {
+  static const char *fn = "novas_event_elevation";
+  sky_pos pos = SKY_POS_INIT;
+  double el = NAN;
+
+  if(!arg) {
+    novas_set_errno(EINVAL, fn, "input source is NULL");
+    return NAN;
+  }
+
+  if(novas_sky_pos((const object *) arg, frame, NOVAS_TOD, &pos) != 0)
+    return novas_trace_nan(fn);
+
+  if(novas_app_to_hor(frame, NOVAS_TOD, pos.ra, pos.dec, NULL, NULL, &el) != 0)
+    return novas_trace_nan(fn);
+
+  return el;
+}
+
+/**
+ * Observable for novas_find_events(): the apparent angular distance of a source from the Sun.
+ *
+ * @param frame     Observing frame.
+ * @param arg       Pointer to the observed source (`const object *`).
+ * @return          [deg] The apparent angular distance of the source from the Sun, or else NAN
+ *                  if there was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_find_events(), novas_sun_angle()
+ */
+double novas_event_sun_angle(const novas_frame *restrict frame, const void *restrict arg) {
+  double d = novas_sun_angle((const object *) arg, frame);
+  if(isnan(d))
+    return novas_trace_nan("novas_event_sun_angle");
+  return d;
+}
+
+/**
+ * Observable for novas_find_events(): the apparent angular distance of a source from the Moon.
+ *
+ * @param frame     Observing frame.
+ * @param arg       Pointer to the observed source (`const object *`).
+ * @return          [deg] The apparent angular distance of the source from the Moon, or else NAN
+ *                  if there was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_find_events(), novas_moon_angle()
+ */
+double novas_event_moon_angle(const novas_frame *restrict frame, const void *restrict arg) {
+  double d = novas_moon_angle((const object *) arg, frame);
+  if(isnan(d))
+    return novas_trace_nan("novas_event_moon_angle");
+  return d;
+}
+
+/**
+ * Observable for novas_find_events(): the apparent angular separation between two sources, e.g.
+ * for finding conjunctions (as minima).
+ *
+ * @param frame     Observing frame.
+ * @param arg       Pointer to an array of two sources (`const object[2]`).
+ * @return          [deg] The apparent angular separation of the two sources, or else NAN if
+ *                  there was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_find_events(), novas_object_sep()
+ */
+double novas_event_separation(const novas_frame *restrict frame, const void *restrict arg) {
+  static const char *fn = "novas_event_separation";
+  const object *pair = (const object *) arg;
+  double d;
+
+  if(!pair) {
+    novas_set_errno(EINVAL, fn, "input sources are NULL");
+    return NAN;
+  }
+
+  d = novas_object_sep(&pair[0], &pair[1], frame);
+  if(isnan(d))
+    return novas_trace_nan(fn);
+  return d;
+}
+
+/**
+ * Observable for novas_find_events(): the phase of the Moon, as defined by novas_moon_phase().
+ * Since the phase is an angle, you should set the period of the event finder to 360.0 when
+ * using this observable.
+ *
+ * @param frame     Observing frame.
+ * @param arg       (unused)
+ * @return          [deg] The phase of the Moon [-180:180], or else NAN if there was an error
+ *                  (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_find_events(), novas_moon_phase(), novas_next_moon_phase()
+ */
+double novas_event_moon_phase(const novas_frame *restrict frame, const void *restrict arg) {
+  static const char *fn = "novas_event_moon_phase";
+  double phase;
+
+  (void) arg;
+
+  if(!frame) {
+    novas_set_errno(EINVAL, fn, "input frame is NULL");
+    return NAN;
+  }
+
+  phase = novas_moon_phase(novas_get_time(&frame->time, NOVAS_TDB));
+  if(isnan(phase))
+    return novas_trace_nan(fn);
+  return phase;
+}
+
+/**
+ * Observable for novas_find_events(): the solar illumination fraction of a source, as defined
+ * by novas_solar_illum().
+ *
+ * @param frame     Observing frame.
+ * @param arg       Pointer to the observed source (`const object *`).
+ * @return          The solar illumination fraction [0.0:1.0] of the source, or else NAN if there
+ *                  was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_find_events(), novas_solar_illum()
+ */
+double novas_event_solar_illum(const novas_frame *restrict frame, const void *restrict arg) {
+  double f = novas_solar_illum((const object *) arg, frame);
+  if(isnan(f))
+    return novas_trace_nan("novas_event_solar_illum");
+  return f;
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
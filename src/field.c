@@ -0,0 +1,584 @@
+/**
+ * @file
+ *
+ *  Field-local transforms, for placing many distant sources inside a small field of view (e.g.
+ *  all catalog stars in a telescope pointing) with a few multiply-adds each.
+ *
+ *  Within a small field, aberration, gravitational deflection, and the chain of rotations from
+ *  ICRS to the output system all vary smoothly with position. Thus, in gnomonic (tangent-plane)
+ *  projection about the field center, the mapping from ICRS to apparent (or horizontal)
+ *  coordinates is well approximated by a quadratic polynomial in the tangent-plane offsets. The
+ *  polynomial is fitted to the exact transform on a regular grid covering the field, and then
+ *  checked against the exact transform on a denser grid, which provides the error bound of the
+ *  approximation within the field.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa frames.c, grid.c
+ */
+
+#include <errno.h>
+#include <math.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+#define FIELD_GRID_HALF   6       ///< Verification grid points on each side of the field center
+#define FIELD_GRID_SIZE   (2 * FIELD_GRID_HALF + 1)  ///< Verification grid points along each axis
+#define FIELD_TERMS       6       ///< Number of terms in the quadratic polynomial
+/// \endcond
+
+/**
+ * Calculates the local basis vectors of the tangent plane at a position on the sphere.
+ *
+ * @param lon     [rad] longitude of the tangent point
+ * @param lat     [rad] latitude of the tangent point
+ * @param[out] b  Basis vectors: b[0] towards increasing longitude, b[1] towards increasing
+ *                latitude, and b[2] the unit vector of the tangent point itself.
+ */
+static void field_basis(double lon, double lat, double b[3][3]) {
+  const double cl = cos(lon), sl = sin(lon), cb = cos(lat), sb = sin(lat);
+
+  b[0][0] = -sl;
+  b[0][1] = cl;
+  b[0][2] = 0.0;
+
+  b[1][0] = -sb * cl;
+  b[1][1] = -sb * sl;
+  b[1][2] = cb;
+
+  b[2][0] = cb * cl;
+  b[2][1] = cb * sl;
+  b[2][2] = sb;
+}
+
+/**
+ * Gnomonic (tangent-plane) projection of a position on the sphere.
+ *
+ * @param b       Tangent-plane basis, from field_basis().
+ * @param lon     [rad] longitude of the position to project
+ * @param lat     [rad] latitude of the position to project
+ * @param[out] x  [rad] projected offset towards increasing longitude.
+ * @param[out] y  [rad] projected offset towards increasing latitude.
+ * @return        0 if successful, or else -1 if the position is in the hemisphere opposite the
+ *                tangent point.
+ */
+static int field_project(const double b[3][3], double lon, double lat, double *x, double *y) {
+  const double cb = cos(lat);
+  const double p[3] = { cb * cos(lon), cb * sin(lon), sin(lat) };
+  const double D = p[0] * b[2][0] + p[1] * b[2][1] + p[2] * b[2][2];
+
+  if(D <= 0.0)
+    return -1;
+
+  *x = (p[0] * b[0][0] + p[1] * b[0][1]) / D;
+  *y = (p[0] * b[1][0] + p[1] * b[1][1] + p[2] * b[1][2]) / D;
+  return 0;
+}
+
+/**
+ * Inverse gnomonic projection, from tangent-plane offsets to a position on the sphere.
+ *
+ * @param b         Tangent-plane basis, from field_basis().
+ * @param x         [rad] projected offset towards increasing longitude.
+ * @param y         [rad] projected offset towards increasing latitude.
+ * @param[out] lon  [rad] longitude of the position, in the -&pi; to &pi; range.
+ * @param[out] lat  [rad] latitude of the position.
+ */
+static void field_deproject(const double b[3][3], double x, double y, double *lon, double *lat) {
+  double p[3];
+  int k;
+
+  for(k = 3; --k >= 0;)
+    p[k] = b[2][k] + x * b[0][k] + y * b[1][k];
+
+  *lon = atan2(p[1], p[0]);
+  *lat = atan2(p[2], sqrt(p[0] * p[0] + p[1] * p[1]));
+}
+
+/**
+ * Evaluates the quadratic field polynomial for one output coordinate.
+ */
+SIMD_INLINE double field_poly(const double *c, double x, double y) {
+  return c[0] + x * (c[1] + c[3] * x + c[4] * y) + y * (c[2] + c[5] * y);
+}
+
+/**
+ * Evaluates the field polynomials for an array of tangent-plane offsets. It is inlined into the
+ * SIMD variants below.
+ */
+SIMD_INLINE void field_offsets(const novas_field_transform *restrict field, int n, const double *x, const double *y,
+        double *out_x, double *out_y) {
+  const double *cx = field->coeff[0], *cy = field->coeff[1];
+  int i;
+
+  for(i = 0; i < n; i++) {
+    const double xi = x[i], yi = y[i];
+
+    out_x[i] = field_poly(cx, xi, yi);
+    out_y[i] = field_poly(cy, xi, yi);
+  }
+}
+
+/// \cond PRIVATE
+#define FIELD_OFFSETS_VARIANT(name, attr) \
+  attr static void name(const novas_field_transform *restrict field, int n, const double *x, const double *y, \
+          double *out_x, double *out_y) { \
+    field_offsets(field, n, x, y, out_x, out_y); \
+  }
+
+FIELD_OFFSETS_VARIANT(field_offsets_scalar, SIMD_SCALAR)
+#if SIMD_X86
+FIELD_OFFSETS_VARIANT(field_offsets_sse2, SIMD_SSE2)
+FIELD_OFFSETS_VARIANT(field_offsets_avx2, SIMD_AVX2)
+FIELD_OFFSETS_VARIANT(field_offsets_avx512, SIMD_AVX512)
+#endif
+/// \endcond
+
+/**
+ * Calculates the exact output position for a distant source in the field.
+ *
+ * @param frame       Observer frame
+ * @param field       Field transform, with the output system (or horizontal) set.
+ * @param ref_model   Refraction model for horizontal outputs, or NULL.
+ * @param ra          [rad] ICRS right ascension
+ * @param dec         [rad] ICRS declination
+ * @param[out] lon    [rad] output longitude (R.A. or azimuth)
+ * @param[out] lat    [rad] output latitude (declination or elevation)
+ * @return            0 if successful, or else -1 if there was an error.
+ */
+static int field_exact(const novas_frame *frame, const novas_field_transform *field, RefractionModel ref_model,
+        double ra, double dec, double *lon, double *lat) {
+  static const char *fn = "field_exact";
+  double pos[3];
+  sky_pos app;
+
+  radec2vector(ra / HOURANGLE, dec / DEGREE, NOVAS_DEFAULT_DISTANCE, pos);
+
+  if(field->horizontal) {
+    double az, el;
+
+    prop_error(fn, novas_geom_to_app(frame, pos, NOVAS_CIRS, &app), 0);
+    prop_error(fn, novas_app_to_hor(frame, NOVAS_CIRS, app.ra, app.dec, ref_model, &az, &el), 0);
+
+    *lon = az * DEGREE;
+    *lat = el * DEGREE;
+  }
+  else {
+    prop_error(fn, novas_geom_to_app(frame, pos, field->sys, &app), 0);
+
+    *lon = app.ra * HOURANGLE;
+    *lat = app.dec * DEGREE;
+  }
+
+  return 0;
+}
+
+/**
+ * Solves a symmetric positive definite linear system (the normal equations of the fit) with
+ * two right-hand sides, by Gaussian elimination with partial pivoting.
+ *
+ * @param A     Normal matrix (destroyed)
+ * @param[in, out] c  The two right-hand side vectors, replaced by the solutions.
+ * @return      0 if successful, or else -1 if the matrix is singular.
+ */
+static int field_solve(double A[FIELD_TERMS][FIELD_TERMS], double c[2][FIELD_TERMS]) {
+  int i, j, k;
+
+  for(i = 0; i < FIELD_TERMS; i++) {
+    int p = i;
+
+    for(j = i + 1; j < FIELD_TERMS; j++)
+      if(fabs(A[j][i]) > fabs(A[p][i]))
+        p = j;
+
+    if(A[p][i] == 0.0)
+      return -1;
+
+    if(p != i) {
+      for(k = 0; k < FIELD_TERMS; k++) {
+        double t = A[i][k];
+        A[i][k] = A[p][k];
+        A[p][k] = t;
+      }
+      for(k = 0; k < 2; k++) {
+        double t = c[k][i];
+        c[k][i] = c[k][p];
+        c[k][p] = t;
+      }
+    }
+
+    for(j = i + 1; j < FIELD_TERMS; j++) {
+      const double f = A[j][i] / A[i][i];
+
+      for(k = i; k < FIELD_TERMS; k++)
+        A[j][k] -= f * A[i][k];
+      for(k = 0; k < 2; k++)
+        c[k][j] -= f * c[k][i];
+    }
+  }
+
+  for(i = FIELD_TERMS; --i >= 0;) {
+    for(k = 0; k < 2; k++) {
+      for(j = i + 1; j < FIELD_TERMS; j++)
+        c[k][i] -= A[i][j] * c[k][j];
+      c[k][i] /= A[i][i];
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Fits the field polynomials to the exact transform, and determines the maximum deviation of the
+ * fit from the exact transform over the field.
+ *
+ * @param frame       Observer frame
+ * @param ref_model   Refraction model for horizontal outputs, or NULL.
+ * @param[in, out] field  Field transform, with the center, radius, and output type set.
+ * @return            0 if successful, or else -1 if there was an error.
+ */
+static int field_fit(const novas_frame *frame, RefractionModel ref_model, novas_field_transform *field) {
+  static const char *fn = "field_fit";
+
+  double xo[FIELD_GRID_SIZE][FIELD_GRID_SIZE], yo[FIELD_GRID_SIZE][FIELD_GRID_SIZE];
+  double A[FIELD_TERMS][FIELD_TERMS] = {{0.0}}, c[2][FIELD_TERMS] = {{0.0}};
+  double bin[3][3], bout[3][3];
+  double lon0, lat0, h, err2 = 0.0;
+  int i, j, k, l;
+
+  // Exact output position of the field center
+  prop_error(fn, field_exact(frame, field, ref_model, field->ra * HOURANGLE, field->dec * DEGREE, &lon0, &lat0), 0);
+
+  field->lon = lon0 / (field->horizontal ? DEGREE : HOURANGLE);
+  if(field->lon < 0.0)
+    field->lon += field->horizontal ? DEG360 : DAY_HOURS;
+  field->lat = lat0 / DEGREE;
+
+  field_basis(field->ra * HOURANGLE, field->dec * DEGREE, bin);
+  field_basis(lon0, lat0, bout);
+
+  // Half-width of the field in the input tangent plane.
+  h = tan(field->radius * DEGREE);
+
+  // Exact transform on the verification grid, spanning the square enclosing the field.
+  for(i = 0; i < FIELD_GRID_SIZE; i++) {
+    for(j = 0; j < FIELD_GRID_SIZE; j++) {
+      const double u = (double) (i - FIELD_GRID_HALF) / FIELD_GRID_HALF;
+      const double v = (double) (j - FIELD_GRID_HALF) / FIELD_GRID_HALF;
+      double ra, dec, lon, lat;
+
+      field_deproject(bin, h * u, h * v, &ra, &dec);
+      prop_error(fn, field_exact(frame, field, ref_model, ra, dec, &lon, &lat), 0);
+
+      if(field_project(bout, lon, lat, &xo[i][j], &yo[i][j]) != 0)
+        return novas_error(-1, EINVAL, fn, "field too large: radius=%g deg", field->radius);
+
+      // Fit on every other grid point (normalized offsets)
+      if(!(i & 1) && !(j & 1)) {
+        const double f[FIELD_TERMS] = { 1.0, u, v, u * u, u * v, v * v };
+
+        for(k = 0; k < FIELD_TERMS; k++) {
+          for(l = 0; l < FIELD_TERMS; l++)
+            A[k][l] += f[k] * f[l];
+          c[0][k] += f[k] * xo[i][j];
+          c[1][k] += f[k] * yo[i][j];
+        }
+      }
+    }
+  }
+
+  if(field_solve(A, c) != 0)
+    return novas_error(-1, EINVAL, fn, "singular fit");
+
+  // Convert coefficients from normalized to tangent-plane offsets.
+  for(k = 0; k < 2; k++) {
+    field->coeff[k][0] = c[k][0];
+    field->coeff[k][1] = c[k][1] / h;
+    field->coeff[k][2] = c[k][2] / h;
+    field->coeff[k][3] = c[k][3] / (h * h);
+    field->coeff[k][4] = c[k][4] / (h * h);
+    field->coeff[k][5] = c[k][5] / (h * h);
+  }
+
+  // Maximum deviation from the exact transform on the full grid, including the points not used
+  // in the fit.
+  for(i = 0; i < FIELD_GRID_SIZE; i++) {
+    for(j = 0; j < FIELD_GRID_SIZE; j++) {
+      const double x = h * (i - FIELD_GRID_HALF) / FIELD_GRID_HALF;
+      const double y = h * (j - FIELD_GRID_HALF) / FIELD_GRID_HALF;
+      const double dx = field_poly(field->coeff[0], x, y) - xo[i][j];
+      const double dy = field_poly(field->coeff[1], x, y) - yo[i][j];
+      const double d2 = dx * dx + dy * dy;
+
+      if(d2 > err2)
+        err2 = d2;
+    }
+  }
+
+  field->error = sqrt(err2) / ARCSEC;
+
+  return 0;
+}
+
+/**
+ * Checks the common inputs for constructing a field transform.
+ */
+static int field_check(const char *fn, const novas_frame *frame, double ra, double dec, double radius,
+        novas_field_transform *field) {
+  if(!frame)
+    return novas_error(-1, EINVAL, fn, "NULL observing frame");
+
+  if(!field)
+    return novas_error(-1, EINVAL, fn, "NULL output field transform");
+
+  if(!novas_frame_is_initialized(frame))
+    return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
+
+  if(!isfinite(ra) || !(fabs(dec) <= 90.0))
+    return novas_error(-1, EINVAL, fn, "invalid field center: ra=%g h, dec=%g deg", ra, dec);
+
+  if(!(radius > 0.0) || radius > NOVAS_FIELD_MAX_RADIUS)
+    return novas_error(-1, EINVAL, fn, "invalid field radius: %g deg", radius);
+
+  field->ra = remainder(ra, DAY_HOURS);
+  if(field->ra < 0.0)
+    field->ra += DAY_HOURS;
+  field->dec = dec;
+  field->radius = radius;
+
+  return 0;
+}
+
+/**
+ * Creates a field-local transform, which approximates the apparent places of distant sources
+ * (such as stars), within a small field of view around a given ICRS position, in the output
+ * coordinate system of choice, with a quadratic polynomial in tangent-plane (gnomonic)
+ * projection. The polynomial is fitted to the exact transform, the same as by
+ * novas_geom_to_app() for sources at infinite distance, including aberration and gravitational
+ * deflection. Once created, the transform can place any number of sources in the field with
+ * novas_field_apply(), or novas_field_apply_offsets(), at a small fraction of the cost of
+ * novas_sky_pos() for each.
+ *
+ * The fit is verified against the exact transform over the square enclosing the field, and the
+ * maximum deviation is stored in the `error` field of the transform. For fields of 1 degree
+ * radius it is typically a few tens of &mu;as (up to ~60 &mu;as), and it grows with roughly the
+ * cube of the field radius.
+ *
+ * NOTES:
+ * <ol>
+ * <li>The input positions are geometric ICRS directions at the time of observation, i.e. with
+ * proper motion applied, but with parallax neglected. The error bound does not include
+ * errors due to the parallax of nearby stars.</li>
+ * </ol>
+ *
+ * @param frame     Observer frame, defining the time and place of observation.
+ * @param sys       Coordinate system in which to calculate the apparent positions.
+ * @param ra        [h] ICRS right ascension of the field center.
+ * @param dec       [deg] ICRS declination of the field center.
+ * @param radius    [deg] Field radius, up to NOVAS_FIELD_MAX_RADIUS.
+ * @param[out] field  The field transform to populate.
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_hor_field_transform(), novas_field_apply(), novas_field_apply_offsets()
+ * @sa novas_geom_to_app(), novas_sky_pos()
+ */
+int novas_make_field_transform(const novas_frame *restrict frame, enum novas_reference_system sys, double ra,
+        double dec, double radius, novas_field_transform *restrict field) {
+  static const char *fn = "novas_make_field_transform";
+
+  prop_error(fn, field_check(fn, frame, ra, dec, radius, field), 0);
+
+  if(sys < 0 || sys >= NOVAS_REFERENCE_SYSTEMS)
+    return novas_error(-1, EINVAL, fn, "invalid reference system: %d", sys);
+
+  field->sys = sys;
+  field->horizontal = 0;
+
+  prop_error(fn, field_fit(frame, NULL, field), 0);
+  return 0;
+}
+
+/**
+ * Creates a field-local transform, which approximates the observed horizontal (azimuth and
+ * elevation) positions of distant sources (such as stars), within a small field of view around a
+ * given ICRS position, with a quadratic polynomial in tangent-plane (gnomonic) projection. The
+ * polynomial is fitted to the exact transform, the same as by novas_geom_to_app() followed by
+ * novas_app_to_hor() for sources at infinite distance. Once created, the transform can place any
+ * number of sources in the field with novas_field_apply(), or novas_field_apply_offsets(), at a
+ * small fraction of the cost of the full calculation for each.
+ *
+ * The fit is verified against the exact transform over the square enclosing the field, and the
+ * maximum deviation is stored in the `error` field of the transform. With refraction, the error
+ * increases at low elevations, where the refraction correction varies faster, so it is
+ * important to check the error bound for fields near the horizon.
+ *
+ * @param frame       Observer frame, defining the time and place of observation (on Earth).
+ * @param ref_model   An appropriate refraction model, or NULL to calculate unrefracted elevations.
+ * @param ra          [h] ICRS right ascension of the field center.
+ * @param dec         [deg] ICRS declination of the field center.
+ * @param radius      [deg] Field radius, up to NOVAS_FIELD_MAX_RADIUS.
+ * @param[out] field  The field transform to populate.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_field_transform(), novas_field_apply(), novas_field_apply_offsets()
+ * @sa novas_app_to_hor(), novas_hor_grid()
+ */
+int novas_make_hor_field_transform(const novas_frame *restrict frame, RefractionModel ref_model, double ra,
+        double dec, double radius, novas_field_transform *restrict field) {
+  static const char *fn = "novas_make_hor_field_transform";
+
+  prop_error(fn, field_check(fn, frame, ra, dec, radius, field), 0);
+
+  if(frame->observer.where != NOVAS_OBSERVER_ON_EARTH && frame->observer.where != NOVAS_AIRBORNE_OBSERVER)
+    return novas_error(-1, EINVAL, fn, "observer not on Earth: where=%d", frame->observer.where);
+
+  field->sys = NOVAS_CIRS;
+  field->horizontal = 1;
+
+  prop_error(fn, field_fit(frame, ref_model, field), 0);
+  return 0;
+}
+
+/**
+ * Applies a field-local transform to tangent-plane (gnomonic) offsets from the field center.
+ * This is the fastest way to use a field transform, with just a few multiply-adds per position,
+ * e.g. for catalogs that are already stored as projected offsets from a pointing center. The
+ * offsets are in radians, towards increasing longitude (R.A. or azimuth) and latitude
+ * (declination or elevation), both in the input (ICRS) and in the output tangent plane. The
+ * output tangent plane is centered on the output position of the field center (`lon` and `lat`
+ * of the transform). The inputs and outputs may be the same arrays.
+ *
+ * @param field     Field transform
+ * @param n         Number of positions
+ * @param x         [rad] ICRS tangent-plane offsets towards increasing R.A.
+ * @param y         [rad] ICRS tangent-plane offsets towards increasing declination.
+ * @param[out] out_x  [rad] Output tangent-plane offsets towards increasing R.A. or azimuth. It may
+ *                  be the same as either input array.
+ * @param[out] out_y  [rad] Output tangent-plane offsets towards increasing declination or
+ *                  elevation. It may be the same as either input array.
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_field_apply(), novas_make_field_transform(), novas_make_hor_field_transform()
+ */
+int novas_field_apply_offsets(const novas_field_transform *restrict field, int n, const double *x, const double *y,
+        double *out_x, double *out_y) {
+  static const char *fn = "novas_field_apply_offsets";
+
+  if(!field || !x || !y || !out_x || !out_y)
+    return novas_error(-1, EINVAL, fn, "NULL argument: field=%p, x=%p, y=%p, out_x=%p, out_y=%p", field, x, y,
+            out_x, out_y);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  switch(novas_get_simd()) {
+#if SIMD_X86
+    case NOVAS_SIMD_AVX512: field_offsets_avx512(field, n, x, y, out_x, out_y); break;
+    case NOVAS_SIMD_AVX2: field_offsets_avx2(field, n, x, y, out_x, out_y); break;
+    case NOVAS_SIMD_SSE2: field_offsets_sse2(field, n, x, y, out_x, out_y); break;
+#endif
+    default: field_offsets_scalar(field, n, x, y, out_x, out_y);
+  }
+
+  return 0;
+}
+
+/**
+ * Applies a field-local transform to ICRS positions of distant sources, returning apparent R.A.
+ * and declination in the output system of the transform, or else azimuth and elevation for
+ * horizontal field transforms. Positions that are in the hemisphere opposite the field center
+ * are set to NAN. Note, that the accuracy of the results is guaranteed only for positions within
+ * the field radius of the transform.
+ *
+ * @param field     Field transform
+ * @param n         Number of positions
+ * @param ra        [h] Array of ICRS right ascension coordinates.
+ * @param dec       [deg] Array of ICRS declination coordinates.
+ * @param[out] lon  Array to populate with the apparent R.A. [h] in the output system, or else
+ *                  with azimuth [deg] for horizontal field transforms. It may be NULL if not
+ *                  required, or else the same as either input array.
+ * @param[out] lat  [deg] Array to populate with the apparent declinations, or else with
+ *                  elevations for horizontal field transforms. It may be NULL if not required,
+ *                  or else the same as either input array.
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_field_apply_offsets(), novas_make_field_transform(), novas_make_hor_field_transform()
+ */
+int novas_field_apply(const novas_field_transform *restrict field, int n, const double *ra, const double *dec,
+        double *lon, double *lat) {
+  static const char *fn = "novas_field_apply";
+  const double unit = field && field->horizontal ? DEGREE : HOURANGLE;
+  const double range = field && field->horizontal ? DEG360 : DAY_HOURS;
+  double bin[3][3], bout[3][3];
+  int i;
+
+  if(!field || !ra || !dec)
+    return novas_error(-1, EINVAL, fn, "NULL argument: field=%p, ra=%p, dec=%p", field, ra, dec);
+
+  if(!lon && !lat)
+    return novas_error(-1, EINVAL, fn, "Both output arrays (lon, lat) are NULL");
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  field_basis(field->ra * HOURANGLE, field->dec * DEGREE, bin);
+  field_basis(field->lon * unit, field->lat * DEGREE, bout);
+
+  for(i = 0; i < n; i++) {
+    double x, y, L, B;
+
+    if(field_project(bin, ra[i] * HOURANGLE, dec[i] * DEGREE, &x, &y) != 0) {
+      if(lon)
+        lon[i] = NAN;
+      if(lat)
+        lat[i] = NAN;
+      continue;
+    }
+
+    field_deproject(bout, field_poly(field->coeff[0], x, y), field_poly(field->coeff[1], x, y), &L, &B);
+
+    if(lon) {
+      L /= unit;
+      lon[i] = L < 0.0 ? L + range : L;
+    }
+    if(lat)
+      lat[i] = B / DEGREE;
+  }
+
+  return 0;
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
@@ -103,6 +103,10 @@
 #include <errno.h>
 #include <math.h>
 
+#ifdef SUPERNOVAS_USE_PTHREAD
+#  include <pthread.h>
+#endif
+
 /// \cond PRIVATE
 #define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
 /// \endcond
@@ -122,11 +126,36 @@ namespace novas {
 
 #define FRAME_DEFAULT       0                   ///< frame.state value we set to indicate the frame is not configured
 #define FRAME_INITIALIZED   0xdeadbeadcafeba5e  ///< frame.state for a properly initialized frame.
+#define FRAME_LAZY_STATE    0xdeadbeadcafeba50  ///< frame.state for a lazy frame, OR'd with the pending components
 #define GEOM_TO_APP         1                   ///< Geometric to apparent conversion
 #define APP_TO_GEOM         (-1)                ///< Apparent to geometric conversion
 
 #define NOVAS_TRACK_DELTA   30.0                ///< [s] Time step for evaluation horizontal tracking derivatives.
 #define SIDEREAL_RATE       1.002737891         ///< rate at which sidereal time advances faster than UTC
+#define APP_GEOM_TILE       256                 ///< Number of positions processed together in batch app-to-geom
+#define WARM_START_COS      0.99984769515639    ///< cos(1 deg), max. separation of neighbours for warm start
+
+#define FRAME_PENDING       (FRAME_ORIENTATION | FRAME_DIURNAL_EOP | FRAME_PLANETS) ///< All lazy components
+
+#if defined(__GNUC__)
+#  define lazy_get(frame)     __atomic_load_n(&(frame)->state, __ATOMIC_ACQUIRE)
+#  define lazy_set(frame, v)  __atomic_store_n(&(frame)->state, v, __ATOMIC_RELEASE)
+#else
+#  define lazy_get(frame)     ((frame)->state)
+#  define lazy_set(frame, v)  ((frame)->state = (v))
+#endif
+
+/// Checks if a frame state value is that of a lazy frame
+#define is_lazy_state(state)  (((state) & ~((uint64_t) FRAME_PENDING)) == FRAME_LAZY_STATE)
+
+#ifdef SUPERNOVAS_USE_PTHREAD
+static pthread_mutex_t lazy_mutex = PTHREAD_MUTEX_INITIALIZER;  ///< Serializes lazy frame evaluations
+#  define lazy_lock()         pthread_mutex_lock(&lazy_mutex)
+#  define lazy_unlock()       pthread_mutex_unlock(&lazy_mutex)
+#else
+#  define lazy_lock()
+#  define lazy_unlock()
+#endif
 /// \endcond
 
 
@@ -173,6 +202,73 @@ static int matrix_inv_rotate(const double *in, const novas_matrix *matrix, doubl
   return 0;
 }
 
+/**
+ * Applies a 3x3 matrix to a (strided) array of 3-vectors. The matrix elements are held in local
+ * variables, and the loop body is free of branches and function calls, so that compilers can
+ * vectorize it. It is inlined into the SIMD variants below. Input and output may be the same
+ * (with the same stride).
+ *
+ * @param matrix      The transformation matrix
+ * @param n           Number of vectors
+ * @param in          Input vectors
+ * @param in_stride   Distance between consecutive input vectors (&gt;= 3)
+ * @param[out] out    Output vectors
+ * @param out_stride  Distance between consecutive output vectors (&gt;= 3)
+ */
+SIMD_INLINE void matrix_transform_strided(const novas_matrix *matrix, int n, const double *in, int in_stride,
+        double *out, int out_stride) {
+  const double m00 = matrix->M[0][0], m01 = matrix->M[0][1], m02 = matrix->M[0][2];
+  const double m10 = matrix->M[1][0], m11 = matrix->M[1][1], m12 = matrix->M[1][2];
+  const double m20 = matrix->M[2][0], m21 = matrix->M[2][1], m22 = matrix->M[2][2];
+  int i;
+
+  for(i = 0; i < n; i++, in += in_stride, out += out_stride) {
+    const double x = in[0], y = in[1], z = in[2];
+
+    out[0] = m00 * x + m01 * y + m02 * z;
+    out[1] = m10 * x + m11 * y + m12 * z;
+    out[2] = m20 * x + m21 * y + m22 * z;
+  }
+}
+
+/// \cond PRIVATE
+#define MATRIX_TRANSFORM_VARIANT(name, attr) \
+  attr static void name(const novas_matrix *matrix, int n, const double *in, int in_stride, double *out, \
+          int out_stride) { \
+    matrix_transform_strided(matrix, n, in, in_stride, out, out_stride); \
+  }
+
+MATRIX_TRANSFORM_VARIANT(matrix_transform_scalar, SIMD_SCALAR)
+#if SIMD_X86
+MATRIX_TRANSFORM_VARIANT(matrix_transform_sse2, SIMD_SSE2)
+MATRIX_TRANSFORM_VARIANT(matrix_transform_avx2, SIMD_AVX2)
+MATRIX_TRANSFORM_VARIANT(matrix_transform_avx512, SIMD_AVX512)
+#endif
+/// \endcond
+
+/**
+ * Applies a 3x3 matrix to a (strided) array of 3-vectors, using the SIMD variant of the kernel
+ * that is selected by novas_get_simd().
+ *
+ * @param matrix      The transformation matrix
+ * @param n           Number of vectors
+ * @param in          Input vectors
+ * @param in_stride   Distance between consecutive input vectors (&gt;= 3)
+ * @param[out] out    Output vectors
+ * @param out_stride  Distance between consecutive output vectors (&gt;= 3)
+ */
+static void matrix_transform_array(const novas_matrix *matrix, int n, const double *in, int in_stride, double *out,
+        int out_stride) {
+  switch(novas_get_simd()) {
+#if SIMD_X86
+    case NOVAS_SIMD_AVX512: matrix_transform_avx512(matrix, n, in, in_stride, out, out_stride); break;
+    case NOVAS_SIMD_AVX2: matrix_transform_avx2(matrix, n, in, in_stride, out, out_stride); break;
+    case NOVAS_SIMD_SSE2: matrix_transform_sse2(matrix, n, in, in_stride, out, out_stride); break;
+#endif
+    default: matrix_transform_scalar(matrix, n, in, in_stride, out, out_stride);
+  }
+}
+
 static int invert_matrix(const novas_matrix *A, novas_matrix *I) {
   double idet;
   int i;
@@ -399,9 +495,57 @@ static int set_wobble_matrix(const novas_frame *frame, novas_matrix *T) {
   return 0;
 }
 
+/**
+ * Returns the accuracy to use for the lower-level calls of a frame, which support the full and
+ * reduced accuracy modes only.
+ */
+static enum novas_accuracy frame_base_accuracy(const novas_frame *frame) {
+  return frame->accuracy == NOVAS_FULL_ACCURACY ? NOVAS_FULL_ACCURACY : NOVAS_REDUCED_ACCURACY;
+}
+
+static int set_fast_earth_obs_posvel(novas_frame *frame) {
+  const observer *obs = &frame->observer;
+  double pos[3], vel[3];
+  int i;
+
+  novas_frame_require(frame, FRAME_ORIENTATION);
+
+  // Geocentric position / velocity w.r.t. the true equator and equinox of date, using the frame's
+  // own sidereal time, rather than recomputing nutation and sidereal time from scratch.
+  terra(&obs->on_surf, frame->gst, pos, vel);
+
+  // TOD -> GCRS with the frame's rotation matrices
+  matrix_inv_rotate(pos, &frame->nutation, pos);
+  matrix_inv_rotate(pos, &frame->precession, pos);
+  matrix_inv_rotate(pos, &frame->icrs_to_j2000, pos);
+
+  matrix_inv_rotate(vel, &frame->nutation, vel);
+  matrix_inv_rotate(vel, &frame->precession, vel);
+  matrix_inv_rotate(vel, &frame->icrs_to_j2000, vel);
+
+  // Add in the aircraft motion, same as geo_posvel()
+  if(obs->where == NOVAS_AIRBORNE_OBSERVER) {
+    for(i = 3; --i >= 0;)
+      vel[i] = novas_add_vel(vel[i], obs->near_earth.sc_vel[i] * DAY / AU_KM);
+  }
+
+  for(i = 3; --i >= 0;) {
+    frame->obs_pos[i] = frame->earth_pos[i] + pos[i];
+    frame->obs_vel[i] = novas_add_vel(frame->earth_vel[i], vel[i]);
+  }
+
+  return 0;
+}
+
 static int set_obs_posvel(novas_frame *frame) {
-  int res = obs_posvel(novas_get_time(&frame->time, NOVAS_TDB), frame->time.ut1_to_tt, frame->accuracy, &frame->observer,
-          frame->earth_pos, frame->earth_vel, frame->obs_pos, frame->obs_vel);
+  int res = 0;
+
+  if(frame->accuracy == NOVAS_FAST_ACCURACY && (frame->observer.where == NOVAS_OBSERVER_ON_EARTH
+          || frame->observer.where == NOVAS_AIRBORNE_OBSERVER))
+    set_fast_earth_obs_posvel(frame);
+  else
+    res = obs_posvel(novas_get_time(&frame->time, NOVAS_TDB), frame->time.ut1_to_tt, frame_base_accuracy(frame),
+            &frame->observer, frame->earth_pos, frame->earth_vel, frame->obs_pos, frame->obs_vel);
 
   frame->v_obs = novas_vlen(frame->obs_vel);
   frame->beta = frame->v_obs / C_AUDAY;
@@ -422,6 +566,15 @@ static int frame_aberration(const novas_frame *frame, int dir, double *pos) {
   if(d == 0.0)
     return 0;
 
+  if(frame->accuracy == NOVAS_FAST_ACCURACY) {
+    // First-order (classical) aberration, to ~1 mas
+    const double f = dir * d / C_AUDAY;
+
+    for(i = 3; --i >= 0;)
+      pos[i] += f * frame->obs_vel[i];
+    return 0;
+  }
+
   // Iterate as necessary (for inverse only)
   for(i = 0; i < novas_inv_max_iter; i++) {
     const double p = frame->beta * novas_vdot(pos, frame->obs_vel) / (d * frame->v_obs);
@@ -452,6 +605,130 @@ static int frame_aberration(const novas_frame *frame, int dir, double *pos) {
   return novas_error(-1, ECANCELED, "frame_aberration", "failed to converge");
 }
 
+/**
+ * Evaluates the Earth orientation quantities of a frame: nutation angles, obliquities, equation
+ * of the equinoxes, Earth Rotation Angle, sidereal time, and the frame tie, precession, nutation,
+ * and GCRS to CIRS matrices.
+ */
+static int set_frame_orientation(novas_frame *frame) {
+  const novas_timespec *time = &frame->time;
+  const double jd_tdb = time->ijd_tt + (time->fjd_tt + time->tt2tdb / DAY);
+  double dpsi, deps;
+  long ijd_ut1;
+  double fjd_ut1;
+
+  nutation_angles((jd_tdb - NOVAS_JD_J2000) / JULIAN_CENTURY_DAYS, frame->accuracy, &dpsi, &deps);
+
+  // dpsi0 / dpes0 w/o the global pole offsets set via cel_pole()
+  frame->dpsi0 = dpsi * ARCSEC;
+  frame->deps0 = deps * ARCSEC;
+
+  // Compute mean obliquity of the ecliptic in degrees.
+  frame->mobl = mean_obliq(jd_tdb) * ARCSEC;
+
+  // Obtain complementary terms for equation of the equinoxes in radians (below 3 mas, so skipped
+  // in fast mode).
+  frame->ee = dpsi * ARCSEC * cos(frame->mobl);
+  if(frame->accuracy != NOVAS_FAST_ACCURACY)
+    frame->ee += ee_ct(time->ijd_tt, time->fjd_tt, frame->accuracy);
+
+  // Compute true obliquity of the ecliptic in degrees.
+  frame->tobl = frame->mobl + deps * ARCSEC;
+
+  fjd_ut1 = novas_get_split_time(time, NOVAS_UT1, &ijd_ut1);
+  frame->era = era(ijd_ut1, fjd_ut1);
+
+  //frame->gst = novas_gast(ijd_ut1 + fjd_ut1, time->ut1_to_tt, accuracy); // Use faster calc with available quantities.
+  frame->gst = (frame->era + novas_gmst_prec(jd_tdb) / 3600.0) / 15.0 + frame->ee / HOURANGLE;
+  frame->gst = remainder(frame->gst, DAY_HOURS);
+  if(frame->gst < 0) frame->gst += DAY_HOURS;
+
+  set_frame_tie(frame);
+  set_precession(frame);
+  set_nutation(frame);
+  set_gcrs_to_cirs(frame);
+
+  return 0;
+}
+
+/**
+ * Adds the diurnal (libration and ocean tide) corrections to the polar offsets of a full accuracy
+ * frame.
+ */
+static int set_frame_diurnal_eop(novas_frame *frame) {
+  double dxp = 0.0, dyp = 0.0;
+
+  novas_diurnal_eop_at_time(&frame->time, &dxp, &dyp, NULL);
+  frame->dx += 0.001 * dxp;
+  frame->dy += 0.001 * dyp;
+
+  return 0;
+}
+
+/**
+ * Calculates the apparent positions of the gravitating bodies, for the observer of the frame, for
+ * the gravitational deflection calculations.
+ */
+static int set_frame_planets(novas_frame *frame) {
+  int pl_mask;
+
+  if(frame->accuracy == NOVAS_FAST_ACCURACY)
+    pl_mask = (1 << NOVAS_SUN);   // Deflection by the Sun only
+  else
+    pl_mask = (frame->accuracy == NOVAS_FULL_ACCURACY) ? grav_bodies_full_accuracy : grav_bodies_reduced_accuracy;
+
+  prop_error("set_frame_planets", obs_planets(novas_get_time(&frame->time, NOVAS_TDB), frame_base_accuracy(frame),
+          frame->obs_pos, pl_mask, &frame->planets), 0);
+  return 0;
+}
+
+static int make_frame(const char *restrict fn, enum novas_accuracy accuracy, const observer *obs,
+        const novas_timespec *time, double xp, double yp, int lazy, novas_frame *frame) {
+  static const object earth = NOVAS_EARTH_INIT;
+  static const object sun = NOVAS_SUN_INIT;
+
+  double tdb2[2];
+
+  if(accuracy < 0 || accuracy > NOVAS_FAST_ACCURACY)
+    return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", accuracy);
+
+  if(!obs || !time)
+    return novas_error(-1, EINVAL, fn, "NULL input parameter: obs=%p, time=%p", obs, time);
+
+  if(!frame)
+    return novas_error(-1, EINVAL, fn, "NULL output frame");
+
+  if(obs->where < 0 || obs->where >= NOVAS_OBSERVER_PLACES)
+    return novas_error(-1, EINVAL, fn, "invalid observer location: %d", obs->where);
+
+  frame->accuracy = accuracy;
+  frame->time = *time;
+  frame->dx = xp;
+  frame->dy = yp;
+
+  if(!lazy) {
+    set_frame_orientation(frame);
+    if(accuracy == NOVAS_FULL_ACCURACY)
+      set_frame_diurnal_eop(frame);
+  }
+
+  tdb2[0] = time->ijd_tt;
+  tdb2[1] = time->fjd_tt + time->tt2tdb / DAY;
+
+  // Barycentric Earth and Sun positions and velocities
+  prop_error(fn, ephemeris(tdb2, &sun, NOVAS_BARYCENTER, frame_base_accuracy(frame), frame->sun_pos, frame->sun_vel), 10);
+  prop_error(fn, ephemeris(tdb2, &earth, NOVAS_BARYCENTER, frame_base_accuracy(frame), frame->earth_pos, frame->earth_vel), 10);
+
+  if(lazy)
+    frame->state = FRAME_LAZY_STATE | FRAME_ORIENTATION | (accuracy == NOVAS_FULL_ACCURACY ? FRAME_DIURNAL_EOP : 0);
+  else
+    frame->state = FRAME_INITIALIZED;
+
+  prop_error(fn, novas_change_observer(frame, obs, frame), 40);
+
+  return 0;
+}
+
 /// \cond PRIVATE
 /**
  * Checks if a frame has been initialized either via a call to `make_frame()`.
@@ -464,7 +741,8 @@ static int frame_aberration(const novas_frame *frame, int dir, double *pos) {
  */
 int novas_frame_is_initialized(const novas_frame *frame) {
   //if(!frame) return 0;
-  return frame->state == FRAME_INITIALIZED;
+  const uint64_t state = lazy_get(frame);
+  return state == FRAME_INITIALIZED || is_lazy_state(state);
 }
 /// \endcond
 
@@ -491,8 +769,9 @@ int novas_frame_is_initialized(const novas_frame *frame) {
  * convert the EOP values as necessary.</li>
  * </ol>
  *
- * @param accuracy    Accuracy requirement, NOVAS_FULL_ACCURACY (0) for the utmost precision or
- *                    NOVAS_REDUCED_ACCURACY (1) if ~1 mas accuracy is sufficient.
+ * @param accuracy    Accuracy requirement, NOVAS_FULL_ACCURACY (0) for the utmost precision,
+ *                    NOVAS_REDUCED_ACCURACY (1) if ~1 mas accuracy is sufficient, or
+ *                    NOVAS_FAST_ACCURACY (2) if ~1 arcsec accuracy is sufficient.
  * @param obs         Observer location
  * @param time        Time of observation
  * @param xp          [mas] Earth orientation parameter, mean polar offset in _x_, e.g. from the
@@ -514,82 +793,156 @@ int novas_frame_is_initialized(const novas_frame *frame) {
  *
  * @sa novas_change_observer(), novas_sky_pos(), novas_geom_posvel(), novas_make_transform()
  * @sa set_planet_provider(), set_planet_provider_hp(), set_nutation_lp_provider(),
- *     novas_itrf_transform_eop()
+ *     novas_itrf_transform_eop(), novas_make_lazy_frame()
  */
 int novas_make_frame(enum novas_accuracy accuracy, const observer *obs, const novas_timespec *time, double xp, double yp,
         novas_frame *frame) {
-  static const char *fn = "novas_make_frame";
-  static const object earth = NOVAS_EARTH_INIT;
-  static const object sun = NOVAS_SUN_INIT;
+  int status;
 
-  double tdb2[2];
-  double dpsi, deps;
-  long ijd_ut1;
-  double fjd_ut1;
+  PROFILE_START(t0);
+  status = make_frame("novas_make_frame", accuracy, obs, time, xp, yp, 0, frame);
+  PROFILE_STOP(NOVAS_PROFILE_FRAME, t0, 1);
 
-  if(accuracy < 0 || accuracy > NOVAS_REDUCED_ACCURACY)
-    return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", accuracy);
+  prop_error("novas_make_frame", status, 0);
+  return 0;
+}
 
-  if(!obs || !time)
-    return novas_error(-1, EINVAL, fn, "NULL input parameter: obs=%p, time=%p", obs, time);
+/**
+ * Sets up a lazy observing frame for a specific observer location, time of observation, and
+ * accuracy requirement. It is the same as novas_make_frame(), except that the Earth orientation
+ * (nutation, sidereal time, and the associated rotation matrices), the diurnal Earth orientation
+ * corrections (in full accuracy mode), and the positions of the gravitating planets (for
+ * deflection) are not computed up front. Instead, each of these is calculated when it is first
+ * needed, e.g. by novas_sky_pos(), novas_app_to_hor(), or novas_make_transform(), and the result
+ * is stored in the frame for subsequent use. Thus, the cost of setting up a frame scales with
+ * what is actually calculated with it. For example, geometric ICRS positions of stars via
+ * novas_geom_posvel() never evaluate the planet positions, nor Earth orientation (except in fast
+ * accuracy mode for Earth-bound observers, whose positions are then calculated from it).
+ *
+ * The results are the same as with novas_make_frame() in all cases.
+ *
+ * Note, that the deferred components are written into the frame by the functions that use them,
+ * even though these take the frame as a `const novas_frame *` argument. Therefore, you should
+ * not place lazy frames in read-only storage, unless you call novas_frame_evaluate() on them
+ * first, after which they are no longer modified.
+ *
+ * Lazy frames may be shared among threads, provided that the library was built with POSIX
+ * threads support (`SUPERNOVAS_USE_PTHREAD`), in which case the on-demand evaluations are
+ * serialized. Without it, concurrent first uses of the same frame are a data race, and so you
+ * should call novas_frame_evaluate() on the frame before sharing it with other threads.
+ *
+ * @param accuracy    Accuracy requirement, NOVAS_FULL_ACCURACY (0) for the utmost precision,
+ *                    NOVAS_REDUCED_ACCURACY (1) if ~1 mas accuracy is sufficient, or
+ *                    NOVAS_FAST_ACCURACY (2) if ~1 arcsec accuracy is sufficient.
+ * @param obs         Observer location
+ * @param time        Time of observation
+ * @param xp          [mas] Earth orientation parameter, mean polar offset in _x_, e.g. from the
+ *                    IERS Bulletins, without diurnal libration and ocean tides. You can use 0.0
+ *                    if sub-arcsecond accuracy is not required.
+ * @param yp          [mas] Earth orientation parameter, mean polar offset in _y_, e.g. from the
+ *                    IERS Bulletins, without diurnal libration and ocean tides. You can use 0.0
+ *                    if sub-arcsecond accuracy is not required.
+ * @param[out] frame  Pointer to the observing frame to configure.
+ * @return            0 if successful,
+ *                    10--40: error is 10 + the error from ephemeris(),
+ *                    40--50: error is 40 + the error from geo_posvel(),
+ *                    or else -1 if there was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_frame(), novas_frame_evaluate()
+ */
+int novas_make_lazy_frame(enum novas_accuracy accuracy, const observer *obs, const novas_timespec *time, double xp,
+        double yp, novas_frame *frame) {
+  int status;
 
-  if(!frame)
-    return novas_error(-1, EINVAL, fn, "NULL output frame");
+  PROFILE_START(t0);
+  status = make_frame("novas_make_lazy_frame", accuracy, obs, time, xp, yp, 1, frame);
+  PROFILE_STOP(NOVAS_PROFILE_FRAME, t0, 1);
 
-  if(obs->where < 0 || obs->where >= NOVAS_OBSERVER_PLACES)
-    return novas_error(-1, EINVAL, fn, "invalid observer location: %d", obs->where);
+  prop_error("novas_make_lazy_frame", status, 0);
+  return 0;
+}
 
-  frame->accuracy = accuracy;
-  frame->time = *time;
+/// \cond PRIVATE
+/**
+ * Makes sure that the specified lazy components of a frame have been evaluated, evaluating them
+ * as necessary. Frames created by novas_make_frame() have all components evaluated already, so
+ * this call returns immediately for them.
+ *
+ * @param frame       The observing frame. Although declared constant, lazily evaluated components
+ *                    are stored in it (see novas_make_lazy_frame()). !!! It cannot be NULL !!!
+ * @param components  Bitwise OR of FRAME_ORIENTATION, FRAME_DIURNAL_EOP, and / or FRAME_PLANETS.
+ * @return            0 if successful, or else an error code from obs_planets().
+ *
+ * @sa novas_make_lazy_frame()
+ */
+int novas_frame_require(const novas_frame *frame, int components) {
+  novas_frame *f = (novas_frame *) frame;
+  uint64_t state = lazy_get(frame);
+  int pending, status = 0;
 
-  tdb2[0] = time->ijd_tt;
-  tdb2[1] = time->fjd_tt + time->tt2tdb / DAY;
+  if(!is_lazy_state(state) || !(state & components))
+    return 0;
 
-  nutation_angles((tdb2[0] + tdb2[1] - NOVAS_JD_J2000) / JULIAN_CENTURY_DAYS, accuracy, &dpsi, &deps);
+  lazy_lock();
 
-  // dpsi0 / dpes0 w/o the global pole offsets set via cel_pole()
-  frame->dpsi0 = dpsi * ARCSEC;
-  frame->deps0 = deps * ARCSEC;
-  frame->dx = xp;
-  frame->dy = yp;
+  PROFILE_START(t0);
 
-  // Compute mean obliquity of the ecliptic in degrees.
-  frame->mobl = mean_obliq(tdb2[0] + tdb2[1]) * ARCSEC;
+  // Another thread might have evaluated some of the same components in the meantime...
+  state = frame->state;
+  pending = (int) (state & components);
 
-  // Obtain complementary terms for equation of the equinoxes in radians.
-  frame->ee = dpsi * ARCSEC * cos(frame->mobl) + ee_ct(time->ijd_tt, time->fjd_tt, accuracy);
+  if(pending & FRAME_ORIENTATION)
+    set_frame_orientation(f);
 
-  // Compute true obliquity of the ecliptic in degrees.
-  frame->tobl = frame->mobl + deps * ARCSEC;
+  if(pending & FRAME_DIURNAL_EOP)
+    set_frame_diurnal_eop(f);
 
-  fjd_ut1 = novas_get_split_time(time, NOVAS_UT1, &ijd_ut1);
-  frame->era = era(ijd_ut1, fjd_ut1);
+  if(pending & FRAME_PLANETS) {
+    status = set_frame_planets(f);
+    if(status)
+      pending &= ~FRAME_PLANETS;
+  }
 
-  //frame->gst = novas_gast(ijd_ut1 + fjd_ut1, time->ut1_to_tt, accuracy); // Use faster calc with available quantities.
-  frame->gst = (frame->era + novas_gmst_prec(tdb2[0] + tdb2[1]) / 3600.0) / 15.0 + frame->ee / HOURANGLE;
-  frame->gst = remainder(frame->gst, DAY_HOURS);
-  if(frame->gst < 0) frame->gst += DAY_HOURS;
+  lazy_set(f, state & ~((uint64_t) pending));
 
-  if(accuracy == NOVAS_FULL_ACCURACY) {
-    double dxp = 0.0, dyp = 0.0;
-    novas_diurnal_eop_at_time(&frame->time, &dxp, &dyp, NULL);
-    frame->dx += 0.001 * dxp;
-    frame->dy += 0.001 * dyp;
-  }
+  PROFILE_STOP(NOVAS_PROFILE_FRAME, t0, 0);
 
-  set_frame_tie(frame);
-  set_precession(frame);
-  set_nutation(frame);
-  set_gcrs_to_cirs(frame);
+  lazy_unlock();
 
-  // Barycentric Earth and Sun positions and velocities
-  prop_error(fn, ephemeris(tdb2, &sun, NOVAS_BARYCENTER, accuracy, frame->sun_pos, frame->sun_vel), 10);
-  prop_error(fn, ephemeris(tdb2, &earth, NOVAS_BARYCENTER, accuracy, frame->earth_pos, frame->earth_vel), 10);
+  prop_error("novas_frame_require", status, 0);
+  return 0;
+}
+/// \endcond
 
-  frame->state = FRAME_INITIALIZED;
+/**
+ * Evaluates all pending components of a lazy observing frame, created with
+ * novas_make_lazy_frame(), such that it may be subsequently used without further on-demand
+ * evaluations. E.g. you might call it before sharing a lazy frame with other threads, if the
+ * library was built without POSIX threads support. For frames created with novas_make_frame(),
+ * this call does nothing.
+ *
+ * @param frame   The observing frame.
+ * @return        0 if successful, or else -1 if the frame is NULL or not initialized (errno will be
+ *                set to EINVAL), or else an error code from obs_planets().
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_lazy_frame()
+ */
+int novas_frame_evaluate(novas_frame *frame) {
+  static const char *fn = "novas_frame_evaluate";
 
-  prop_error(fn, novas_change_observer(frame, obs, frame), 40);
+  if(!frame)
+    return novas_error(-1, EINVAL, fn, "NULL frame");
+
+  if(!novas_frame_is_initialized(frame))
+    return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
 
+  prop_error(fn, novas_frame_require(frame, FRAME_PENDING), 0);
   return 0;
 }
 
@@ -610,8 +963,7 @@ int novas_make_frame(enum novas_accuracy accuracy, const observer *obs, const no
  */
 int novas_change_observer(const novas_frame *orig, const observer *obs, novas_frame *out) {
   static const char *fn = "novas_change_observer";
-  double jd_tdb;
-  int pl_mask;
+  int lazy, status;
 
   if(!orig || !obs || !out)
     return novas_error(-1, EINVAL, fn, "NULL parameter: orig=%p, obs=%p, out=%p", orig, obs, out);
@@ -622,20 +974,35 @@ int novas_change_observer(const novas_frame *orig, const observer *obs, novas_fr
   if(out != orig)
     *out = *orig;
 
-  out->state = FRAME_DEFAULT;
+  // A lazy frame stays valid while we update it, since the observer position may require the
+  // frame's orientation.
+  lazy = is_lazy_state(out->state);
+  if(!lazy)
+    out->state = FRAME_DEFAULT;
+
   out->observer = *obs;
 
-  prop_error(fn, set_obs_posvel(out), 0);
+  status = set_obs_posvel(out);
+  if(status) {
+    out->state = FRAME_DEFAULT;
+    prop_error(fn, status, 0);
+  }
 
-  jd_tdb = novas_get_time(&out->time, NOVAS_TDB);
-  pl_mask = (out->accuracy == NOVAS_FULL_ACCURACY) ? grav_bodies_full_accuracy : grav_bodies_reduced_accuracy;
-  prop_error(fn, obs_planets(jd_tdb, out->accuracy, out->obs_pos, pl_mask, &out->planets), 0);
+  // Planet positions are relative to the observer, so these need to be (re)calculated.
+  if(lazy)
+    out->state |= FRAME_PLANETS;
+  else {
+    prop_error(fn, set_frame_planets(out), 0);
+    out->state = FRAME_INITIALIZED;
+  }
 
-  out->state = FRAME_INITIALIZED;
   return 0;
 }
 
 static int icrs_to_sys(const novas_frame *restrict frame, double *restrict pos, enum novas_reference_system sys) {
+  if(sys != NOVAS_ICRS && sys != NOVAS_GCRS)
+    novas_frame_require(frame, sys == NOVAS_ITRS ? FRAME_ORIENTATION | FRAME_DIURNAL_EOP : FRAME_ORIENTATION);
+
   switch(sys) {
     case NOVAS_ICRS:
     case NOVAS_GCRS:
@@ -650,7 +1017,7 @@ static int icrs_to_sys(const novas_frame *restrict frame, double *restrict pos,
       spin(frame->era, pos, pos);
       if(sys == NOVAS_TIRS) return 0;
 
-      wobble(frame->time.ijd_tt + frame->time.fjd_tt, WOBBLE_TIRS_TO_ITRS, frame->dx, frame->dy, pos, pos);
+      wobble(frame->time.ijd_tt + frame->time.fjd_tt, WOBBLE_TIRS_TO_ITRS, 1e-3 * frame->dx, 1e-3 * frame->dy, pos, pos);
       return 0;
 
     case NOVAS_J2000:
@@ -730,7 +1097,7 @@ int novas_geom_posvel(const object *restrict source, const novas_frame *restrict
   if(!novas_frame_is_initialized(frame))
     return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
 
-  if(frame->accuracy != NOVAS_FULL_ACCURACY && frame->accuracy != NOVAS_REDUCED_ACCURACY)
+  if(frame->accuracy < NOVAS_FULL_ACCURACY || frame->accuracy > NOVAS_FAST_ACCURACY)
     return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", frame->accuracy);
 
   // Compute 'jd_tdb', the TDB Julian date corresponding to 'jd_tt'.
@@ -757,7 +1124,7 @@ int novas_geom_posvel(const object *restrict source, const novas_frame *restrict
     int got = 0;
 
     // If we readily have the requested planet data in the frame, use it.
-    if(source->type == NOVAS_PLANET)
+    if(source->type == NOVAS_PLANET && novas_frame_require(frame, FRAME_PLANETS) == 0)
       if(frame->planets.mask & (1 << source->number)) {
         memcpy(pos1, &frame->planets.pos[source->number][0], sizeof(pos1));
         memcpy(vel1, &frame->planets.vel[source->number][0], sizeof(vel1));
@@ -765,7 +1132,18 @@ int novas_geom_posvel(const object *restrict source, const novas_frame *restrict
       }
 
     // Otherwise, get the position of body wrt observer, antedated for light-time.
-    if(!got) {
+    if(!got && frame->accuracy == NOVAS_FAST_ACCURACY) {
+      // Single pass: antedate linearly, using the velocity at the time of observation.
+      const double jd[2] = { jd_tdb, 0.0 };
+      int k;
+
+      prop_error(fn, ephemeris(jd, source, NOVAS_BARYCENTER, NOVAS_REDUCED_ACCURACY, pos1, vel1), 50);
+      bary2obs(pos1, frame->obs_pos, pos1, &t_light);
+
+      for(k = 3; --k >= 0;)
+        pos1[k] -= t_light * vel1[k];
+    }
+    else if(!got) {
       prop_error(fn, light_time2(jd_tdb, source, frame->obs_pos, 0.0, frame->accuracy, pos1, vel1, &t_light), 50);
     }
   }
@@ -847,7 +1225,7 @@ int novas_sky_pos(const object *restrict object, const novas_frame *restrict fra
   if(!novas_frame_is_initialized(frame))
     return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
 
-  if(frame->accuracy != NOVAS_FULL_ACCURACY && frame->accuracy != NOVAS_REDUCED_ACCURACY)
+  if(frame->accuracy < NOVAS_FULL_ACCURACY || frame->accuracy > NOVAS_FAST_ACCURACY)
     return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", frame->accuracy);
 
   prop_error(fn, novas_geom_posvel(object, frame, NOVAS_ICRS, pos, vel), 0);
@@ -872,6 +1250,8 @@ int novas_sky_pos(const object *restrict object, const novas_frame *restrict fra
     d_sb = sqrt(d_sb);
   }
 
+  prop_error(fn, novas_frame_require(frame, FRAME_PLANETS), 70);
+
   // ---------------------------------------------------------------------
   // Compute direction in which light is emitted from the source
   // ---------------------------------------------------------------------
@@ -945,10 +1325,11 @@ int novas_geom_to_app(const novas_frame *restrict frame, const double *restrict
   if(!novas_frame_is_initialized(frame))
     return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
 
-  if(frame->accuracy < NOVAS_FULL_ACCURACY || frame->accuracy > NOVAS_REDUCED_ACCURACY)
+  if(frame->accuracy < NOVAS_FULL_ACCURACY || frame->accuracy > NOVAS_FAST_ACCURACY)
     return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", frame->accuracy);
 
   // Compute gravitational deflection and aberration.
+  prop_error(fn, novas_frame_require(frame, FRAME_PLANETS), 0);
   prop_error(fn, grav_planets(pos, frame->obs_pos, &frame->planets, pos1), 0);
 
   // Aberration correction
@@ -1018,6 +1399,7 @@ int novas_app_to_hor(const novas_frame *restrict frame, enum novas_reference_sys
   }
 
   time = (novas_timespec *) &frame->time;
+  novas_frame_require(frame, FRAME_ORIENTATION | FRAME_DIURNAL_EOP);
 
   radec2vector(ra, dec, 1.0, pos);
 
@@ -1052,8 +1434,11 @@ int novas_app_to_hor(const novas_frame *restrict frame, enum novas_reference_sys
 
   itrs_to_hor(&frame->observer.on_surf, pos, &az0, &za0);
 
-  if(ref_model)
+  if(ref_model) {
+    PROFILE_START(t0);
     za0 -= ref_model(time->ijd_tt + time->fjd_tt, &frame->observer.on_surf, NOVAS_REFRACT_ASTROMETRIC, 90.0 - za0);
+    PROFILE_STOP(NOVAS_PROFILE_REFRACTION, t0, 1);
+  }
 
   if(az)
     *az = az0;
@@ -1112,9 +1497,13 @@ int novas_hor_to_app(const novas_frame *restrict frame, double az, double el, Re
   }
 
   time = (novas_timespec *) &frame->time;
+  novas_frame_require(frame, FRAME_ORIENTATION | FRAME_DIURNAL_EOP);
 
-  if(ref_model)
+  if(ref_model) {
+    PROFILE_START(t0);
     el -= ref_model(time->ijd_tt + time->fjd_tt, &frame->observer.on_surf, NOVAS_REFRACT_OBSERVED, el);
+    PROFILE_STOP(NOVAS_PROFILE_REFRACTION, t0, 1);
+  }
 
   // az, el to ITRS pos
   hor_to_itrs(&frame->observer.on_surf, az, 90.0 - el, pos);
@@ -1197,6 +1586,8 @@ int novas_app_to_geom(const novas_frame *restrict frame, enum novas_reference_sy
 
   if(dist <= 0.0) dist = 1e15;
 
+  novas_frame_require(frame, FRAME_ORIENTATION | FRAME_DIURNAL_EOP);
+
   // 3D apparent position
   radec2vector(ra, dec, dist, app_pos);
 
@@ -1204,7 +1595,7 @@ int novas_app_to_geom(const novas_frame *restrict frame, enum novas_reference_sy
   switch(sys) {
     case NOVAS_ITRS:
       // ITRS -> TIRS
-      wobble(frame->time.ijd_tt + frame->time.fjd_tt, WOBBLE_ITRS_TO_TIRS, frame->dx, frame->dy, app_pos, app_pos); // @suppress("No break at end of case")
+      wobble(frame->time.ijd_tt + frame->time.fjd_tt, WOBBLE_ITRS_TO_TIRS, 1e-3 * frame->dx, 1e-3 * frame->dy, app_pos, app_pos); // @suppress("No break at end of case")
       /* fallthrough */
     case NOVAS_TIRS:
       // TIRS -> CIRS
@@ -1232,11 +1623,184 @@ int novas_app_to_geom(const novas_frame *restrict frame, enum novas_reference_sy
   frame_aberration(frame, APP_TO_GEOM, app_pos);
 
   // Undo gravitational deflection and aberration.
+  prop_error(fn, novas_frame_require(frame, FRAME_PLANETS), 0);
   prop_error(fn, grav_undo_planets(app_pos, frame->obs_pos, &frame->planets, geom_icrs), 0);
 
   return 0;
 }
 
+/**
+ * Undoes the aberration correction for a set of apparent directions, in closed form. Relativistic
+ * aberration with the observer velocity reversed is the exact inverse of the aberration applied
+ * by frame_aberration(), so no iteration is necessary. For NOVAS_FAST_ACCURACY frames, the
+ * first-order aberration is undone instead, like in frame_aberration(). The loops are free of
+ * branches and calls, so compilers can vectorize them.
+ *
+ * @param frame     Observer frame
+ * @param n         Number of directions
+ * @param x         [AU] x components of the apparent positions, replaced by the unaberrated ones
+ * @param y         [AU] y components of the apparent positions, replaced by the unaberrated ones
+ * @param z         [AU] z components of the apparent positions, replaced by the unaberrated ones
+ * @param d         [AU] distances of the positions (lengths of the vectors).
+ */
+static void frame_unaberrate_array(const novas_frame *frame, int n, double *restrict x, double *restrict y,
+        double *restrict z, const double *restrict d) {
+  const double bx = -frame->obs_vel[0] / C_AUDAY, by = -frame->obs_vel[1] / C_AUDAY, bz = -frame->obs_vel[2] / C_AUDAY;
+  const double gam = frame->gamma;
+  int i;
+
+  if(frame->v_obs == 0.0)
+    return;
+
+  if(frame->accuracy == NOVAS_FAST_ACCURACY) {
+    // First-order (classical) aberration, the same as frame_aberration()
+    for(i = 0; i < n; i++) {
+      x[i] += d[i] * bx;
+      y[i] += d[i] * by;
+      z[i] += d[i] * bz;
+    }
+    return;
+  }
+
+  for(i = 0; i < n; i++) {
+    const double p = (x[i] * bx + y[i] * by + z[i] * bz) / d[i];
+    const double q = (1.0 + p / (1.0 + gam)) * d[i];
+    const double r = 1.0 / (1.0 + p);
+
+    x[i] = (gam * x[i] + q * bx) * r;
+    y[i] = (gam * y[i] + q * by) * r;
+    z[i] = (gam * z[i] + q * bz) * r;
+  }
+}
+
+/**
+ * Converts an array of observed apparent sky positions to ICRS geometric positions, by undoing
+ * the gravitational deflection and aberration corrections, e.g. for the astrometric calibration
+ * of large lists of measured positions. It is equivalent to calling novas_app_to_geom() on each
+ * position, but faster.
+ *
+ * The coordinate transformation to ICRS is a single matrix for all positions, and the
+ * aberration correction is undone in closed form (by aberration with the reversed observer
+ * velocity), for tiles of positions at once. The gravitational deflection is undone iteratively,
+ * like in novas_app_to_geom(), except that each inversion is warm-started from the deflection
+ * correction found for the previous position in the array, provided it is within 1 degree on the
+ * sky and at about the same distance. Otherwise, the deflection is undone from scratch, which
+ * normally takes two evaluations of the deflection. For dense lists (e.g. sorted detections from
+ * the same image), in which neighbours are typically within a few arcseconds, the warm start
+ * often converges with a single evaluation. The number of evaluations may be returned for each
+ * position, e.g. for profiling.
+ *
+ * @param frame           The observer frame, defining the location and time of observation
+ * @param sys             The reference system in which the observed positions are specified.
+ * @param n               Number of positions
+ * @param ra              [h] Array of observed right-ascension coordinates of the sources
+ * @param dec             [deg] Array of observed declination coordinates of the sources
+ * @param dist            [AU] Array of observed distances from observer, or NULL to use
+ *                        10<sup>15</sup> AU (around 5 Gpc) for all. Values &lt;=0 will
+ *                        translate to 10<sup>15</sup> AU also.
+ * @param[out] geom_icrs  [AU] The corresponding geometric positions for the sources, in ICRS,
+ *                        as consecutive (x, y, z) triplets (3 &times; n values).
+ * @param[out] iter       Optional array to populate with the number of deflection evaluations
+ *                        that were used for each position, or NULL if not required.
+ * @return                0 if successful, or else -1 if there was an error (errno will
+ *                        indicate the type of error, e.g. ECANCELED if the inversion did not
+ *                        converge for some positions, for which the outputs are set to NAN).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_app_to_geom(), novas_hor_to_app_array(), novas_transform_vectors()
+ */
+int novas_app_to_geom_array(const novas_frame *restrict frame, enum novas_reference_system sys, int n,
+        const double *restrict ra, const double *restrict dec, const double *restrict dist, double *restrict geom_icrs,
+        int *restrict iter) {
+  static const char *fn = "novas_app_to_geom_array";
+  static const double tol = 1e-13;
+
+  double x[APP_GEOM_TILE], y[APP_GEOM_TILE], z[APP_GEOM_TILE], d[APP_GEOM_TILE];
+  double app0[3] = { 0.0 }, corr[3] = { 0.0 }, d0 = 0.0;
+  novas_transform T;
+  int i0, status = 0;
+
+  if(!frame || !ra || !dec || !geom_icrs)
+    return novas_error(-1, EINVAL, fn, "NULL argument: frame=%p, ra=%p, dec=%p, geom_icrs=%p", frame, ra, dec, geom_icrs);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  prop_error(fn, novas_make_transform(frame, sys, NOVAS_ICRS, &T), 0);
+  prop_error(fn, novas_frame_require(frame, FRAME_PLANETS), 0);
+
+  for(i0 = 0; i0 < n; i0 += APP_GEOM_TILE) {
+    const int ns = (n - i0 < APP_GEOM_TILE) ? n - i0 : APP_GEOM_TILE;
+    int i;
+
+    // Apparent positions in ICRS, in separate component arrays.
+    for(i = 0; i < ns; i++) {
+      const double *M0 = T.matrix.M[0], *M1 = T.matrix.M[1], *M2 = T.matrix.M[2];
+      double v[3];
+
+      d[i] = (dist && dist[i0 + i] > 0.0) ? dist[i0 + i] : 1e15;
+      radec2vector(ra[i0 + i], dec[i0 + i], d[i], v);
+
+      x[i] = M0[0] * v[0] + M0[1] * v[1] + M0[2] * v[2];
+      y[i] = M1[0] * v[0] + M1[1] * v[1] + M1[2] * v[2];
+      z[i] = M2[0] * v[0] + M2[1] * v[1] + M2[2] * v[2];
+    }
+
+    frame_unaberrate_array(frame, ns, x, y, z, d);
+
+    // Undo gravitational deflection, warm-starting from the previous correction
+    for(i = 0; i < ns; i++) {
+      const double app[3] = { x[i], y[i], z[i] };
+      double *geom = &geom_icrs[3 * (i0 + i)];
+      int k, m;
+
+      // Warm start only from a neighbour within 1 degree and at about the same distance.
+      if(fabs(d[i] - d0) < 1e-3 * d[i] && novas_vdot(app, app0) > WARM_START_COS * d[i] * d0) {
+        for(k = 3; --k >= 0;)
+          geom[k] = app[k] + corr[k];
+      }
+      else
+        memcpy(geom, app, sizeof(app));
+
+      for(m = 1; m <= novas_inv_max_iter; m++) {
+        double def[3];
+
+        prop_error(fn, grav_planets(geom, frame->obs_pos, &frame->planets, def), 0);
+
+        if(novas_vdist(def, app) < tol * d[i])
+          break;
+
+        for(k = 3; --k >= 0;)
+          geom[k] -= def[k] - app[k];
+      }
+
+      if(iter)
+        iter[i0 + i] = m;
+
+      if(m > novas_inv_max_iter) {
+        for(k = 3; --k >= 0;)
+          geom[k] = NAN;
+        d0 = 0.0;
+        status = -1;
+        continue;
+      }
+
+      for(k = 3; --k >= 0;) {
+        app0[k] = app[k];
+        corr[k] = geom[k] - app[k];
+      }
+      d0 = d[i];
+    }
+  }
+
+  if(status)
+    return novas_error(-1, ECANCELED, fn, "failed to converge for some positions");
+
+  return 0;
+}
+
 /**
  * Calculates a transformation matrix that can be used to convert positions and velocities from
  * one coordinate reference system to another.
@@ -1268,6 +1832,8 @@ int novas_make_transform(const novas_frame *frame, enum novas_reference_system f
   if(to_system < 0 || to_system >= NOVAS_REFERENCE_SYSTEMS)
     return novas_error(-1, EINVAL, fn, "invalid reference system (to): %d\n", to_system);
 
+  novas_frame_require(frame, FRAME_ORIENTATION | FRAME_DIURNAL_EOP);
+
   transform->frame = *frame;
   transform->from_system = from_system;
   transform->to_system = to_system;
@@ -1469,6 +2035,92 @@ int novas_transform_sky_pos(const sky_pos *in, const novas_transform *restrict t
   return 0;
 }
 
+/**
+ * Transforms an array of position or velocity 3-vectors from one coordinate reference system to
+ * another, e.g. the direction vectors for all pixels of an image. It is equivalent to calling
+ * novas_transform_vector() on each vector, but much faster for large arrays. The vectors may be
+ * contiguous (with a stride of 3) or embedded in larger records (with a stride larger than 3),
+ * and the transformation may be performed in place.
+ *
+ * @param in          Input array of 3-vectors in the original coordinate reference system.
+ * @param in_stride   Distance (in doubles) between consecutive input vectors, e.g. 3 for a
+ *                    contiguous array of 3-vectors (&gt;= 3).
+ * @param n           Number of vectors to transform.
+ * @param transform   Pointer to a coordinate transformation matrix
+ * @param[out] out    Output array of 3-vectors in the new coordinate reference system. It may be
+ *                    the same as the input (with the same stride) for in-place transformation,
+ *                    but it may not overlap with the input otherwise.
+ * @param out_stride  Distance (in doubles) between consecutive output vectors (&gt;= 3).
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_transform_vector(), novas_transform_sky_positions(), novas_make_transform()
+ */
+int novas_transform_vectors(const double *in, int in_stride, int n, const novas_transform *restrict transform,
+        double *out, int out_stride) {
+  static const char *fn = "novas_transform_vectors";
+
+  if(!transform || !in || !out)
+    return novas_error(-1, EINVAL, fn, "NULL parameter: in=%p, transform=%p, out=%p", in, transform, out);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  if(in_stride < 3 || out_stride < 3)
+    return novas_error(-1, EINVAL, fn, "invalid stride: in_stride=%d, out_stride=%d", in_stride, out_stride);
+
+  if(in == out && in_stride != out_stride)
+    return novas_error(-1, EINVAL, fn, "in-place transform with different strides: %d, %d", in_stride, out_stride);
+
+  matrix_transform_array(&transform->matrix, n, in, in_stride, out, out_stride);
+  return 0;
+}
+
+/**
+ * Transforms an array of apparent positions on sky from one coordinate reference system to
+ * another. It is equivalent to calling novas_transform_sky_pos() on each element, but faster for
+ * large arrays. The distance and radial velocity fields are carried over to the output
+ * unchanged.
+ *
+ * @param in          Input array of apparent positions on sky in the original coordinate
+ *                    reference system.
+ * @param n           Number of positions to transform.
+ * @param transform   Pointer to a coordinate transformation matrix
+ * @param[out] out    Output array of apparent positions on sky in the new coordinate reference
+ *                    system. It may be the same as the input.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_transform_sky_pos(), novas_transform_vectors(), novas_make_transform()
+ */
+int novas_transform_sky_positions(const sky_pos *in, int n, const novas_transform *restrict transform, sky_pos *out) {
+  static const char *fn = "novas_transform_sky_positions";
+  int i;
+
+  if(!transform || !in || !out)
+    return novas_error(-1, EINVAL, fn, "NULL parameter: in=%p, transform=%p, out=%p", in, transform, out);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  if(out != in)
+    memmove(out, in, n * sizeof(sky_pos));
+
+  matrix_transform_array(&transform->matrix, n, out[0].r_hat, sizeof(sky_pos) / sizeof(double), out[0].r_hat,
+          sizeof(sky_pos) / sizeof(double));
+
+  for(i = 0; i < n; i++)
+    vector2radec(out[i].r_hat, &out[i].ra, &out[i].dec);
+
+  return 0;
+}
+
 /**
  * Returns the Local (apparent) Sidereal Time for an observing frame of an Earth-bound observer.
  *
@@ -1500,6 +2152,8 @@ double novas_frame_lst(const novas_frame *restrict frame) {
     return NAN;
   }
 
+  novas_frame_require(frame, FRAME_ORIENTATION);
+
   lst = remainder(frame->gst + frame->observer.on_surf.longitude / 15.0, DAY_HOURS);
   if(lst < 0.0)
     lst += DAY_HOURS;
@@ -1572,6 +2226,8 @@ static double novas_cross_el_date(double el, int sign, const object *source, con
     return novas_trace_nan(fn);
 
   el *= DEGREE;                     // convert to degrees.
+  novas_frame_require(frame, FRAME_DIURNAL_EOP);
+
   frame1 = *frame;                  // Time shifted frame
   jd0_tt = novas_get_time(&frame->time, NOVAS_TT);
   loc = (on_surface *) &frame->observer.on_surf;   // Earth-bound location
@@ -1583,9 +2239,12 @@ static double novas_cross_el_date(double el, int sign, const object *source, con
 
     prop_error(fn, novas_sky_pos(source, &frame1, NOVAS_TOD, &pos), 0);
 
-    if(ref_model)
+    if(ref_model) {
       // Apply (possibly time-specific) refraction correction
+      PROFILE_START(t0);
       ref = ref_model(novas_get_time(&t, NOVAS_TT), &frame->observer.on_surf, NOVAS_REFRACT_OBSERVED, el) * DEGREE;
+      PROFILE_STOP(NOVAS_PROFILE_REFRACTION, t0, 1);
+    }
 
     // Hourangle when source crosses nominal elevation
     lha = sign ? calc_lha(el - ref, pos.dec * NOVAS_DEGREE, loc->latitude * NOVAS_DEGREE) : 0.0;
@@ -1940,6 +2599,8 @@ int novas_equ_track(const object *restrict source, const novas_frame *restrict f
   track->pos.dist = pos0.dis;
   track->pos.z = pos0.rv;
 
+  novas_frame_require(frame, FRAME_DIURNAL_EOP);
+
   time1 = frame->time;
   time1.fjd_tt -= dt / DAY;
   prop_error(fn, novas_make_frame(frame->accuracy, &frame->observer, &time1, frame->dx, frame->dy, &frame1), 0);
@@ -2018,7 +2679,7 @@ int novas_hor_track(const object *restrict source, const novas_frame *restrict f
     return novas_error(-1, EINVAL, fn, "output track is NULL");
 
   track->time = frame->time;
-  ra_cio = -ira_equinox(frame->time.ijd_tt + frame->time.fjd_tt, NOVAS_TRUE_EQUINOX, frame->accuracy);
+  ra_cio = -ira_equinox(frame->time.ijd_tt + frame->time.fjd_tt, NOVAS_TRUE_EQUINOX, frame_base_accuracy(frame));
 
   prop_error(fn, novas_sky_pos(source, frame, NOVAS_CIRS, &pos), 0);
   prop_error(fn, novas_app_to_hor(frame, NOVAS_TOD, pos.ra + ra_cio, pos.dec, ref_model, &az0, &el0), 0);
@@ -2027,6 +2688,8 @@ int novas_hor_track(const object *restrict source, const novas_frame *restrict f
   track->pos.dist = pos.dis;
   track->pos.z = novas_v2z(pos.rv);
 
+  novas_frame_require(frame, FRAME_DIURNAL_EOP);
+
   time1 = frame->time;
   time1.fjd_tt -= NOVAS_TRACK_DELTA / DAY;
   prop_error(fn, novas_make_frame(frame->accuracy, &frame->observer, &time1, frame->dx, frame->dy, &frame1), 0);
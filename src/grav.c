@@ -248,6 +248,8 @@ int grav_undo_planets(const double *pos_app, const double *pos_obs, const novas_
   for(i = 0; i < novas_inv_max_iter; i++) {
     int j;
 
+    PROFILE_ITERATION(NOVAS_GRAV_UNDO_ITERATIONS);
+
     prop_error(fn, grav_planets(pos0, pos_obs, planets, pos_def), 0);
 
     if(novas_vdist(pos_def, pos_app) / l < tol) {
@@ -370,6 +372,8 @@ int grav_planets(const double *pos_src, const double *pos_obs, const novas_plane
   if(!planets)
     return novas_error(-1, EINVAL, fn, "NULL input planet data");
 
+  PROFILE_START(t0);
+
   // Initialize output vector of observed object to equal input vector.
   if(out != pos_src)
     memcpy(out, pos_src, XYZ_VECTOR_SIZE);
@@ -414,6 +418,8 @@ int grav_planets(const double *pos_src, const double *pos_obs, const novas_plane
     grav_vec(out, pos_obs, p1, rmass[i], out);
   }
 
+  PROFILE_STOP(NOVAS_PROFILE_DEFLECTION, t0, 1);
+
   return 0;
 }
 
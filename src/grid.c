@@ -0,0 +1,747 @@
+/**
+ * @file
+ *
+ *  Horizontal (azimuth / elevation) visibility grids for many distant sources over many times of
+ *  observation, e.g. for observability planning.
+ *
+ *  For distant sources (outside of the Solar system) the calculation is separable: a single 3x3
+ *  matrix per time of observation rotates ICRS directions into the local East-North-Up system
+ *  of the observer, which is applied to the ICRS unit vectors of all sources. This is
+ *  effectively a small matrix product, which is evaluated in cache-sized tiles, using loops
+ *  over contiguous arrays of vector components that compilers can readily vectorize. Optionally,
+ *  aberration (due to the observer's motion) and atmospheric refraction corrections may be
+ *  included in the results also.
+ *
+ *  The reverse, de-projecting large arrays of observed horizontal positions (e.g. the pixels of
+ *  all-sky images) to equatorial coordinates, uses the same approach, with a single matrix from
+ *  the local horizontal system to the output coordinate system, and tabulated refraction.
+ *
+ *  For visualization-grade placement of very many stars (e.g. planetarium-style rendering),
+ *  there is also a single-precision variant of the forward calculation, operating on separate
+ *  arrays of vector components (structure of arrays), which uses twice as many SIMD lanes as the
+ *  double-precision kernels.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa frames.c, refract.c
+ */
+
+#include <errno.h>
+#include <math.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+#define GRID_SRC_TILE     256     ///< Number of sources processed together (fits L1 cache with outputs)
+#define GRID_TIME_TILE    16      ///< Number of times of observation processed together
+#define REFRACT_TABLE_MIN   (-1.0)  ///< [deg] Lowest observed elevation in refraction tables
+#define REFRACT_TABLE_STEP  0.05    ///< [deg] Observed elevation step in refraction tables
+#define REFRACT_TABLE_SIZE  1821    ///< Number of entries in refraction tables, up to 90 degrees
+/// \endcond
+
+/**
+ * Per-time rotation into the local horizontal system, and aberration parameters.
+ */
+typedef struct {
+  double M[3][3];         ///< GCRS to East-North-Up rotation matrix
+  double beta[3];         ///< observer velocity / c, in East-North-Up
+  double gamma;           ///< sqrt(1 - beta^2)
+  double jd_tt;           ///< [day] TT-based Julian date (for refraction models)
+  const on_surface *loc;  ///< observer location
+} grid_time;
+
+/**
+ * Calculates the per-time rotation matrix, from GCRS to the local East-North-Up system of the
+ * observer, and the corresponding observer velocity in units of the speed of light.
+ *
+ * @param frame       Observing frame, with an Earth-bound observer.
+ * @param[out] g      Per-time grid parameters to populate
+ * @return            0 if successful, or else -1 if there was an error.
+ */
+static int grid_set_time(const novas_frame *frame, grid_time *g) {
+  static const char *fn = "grid_set_time";
+  const on_surface *loc;
+  novas_transform T;
+  double v[3];
+  int k;
+
+  if(frame->observer.where != NOVAS_OBSERVER_ON_EARTH && frame->observer.where != NOVAS_AIRBORNE_OBSERVER)
+    return novas_error(-1, EINVAL, fn, "observer not on Earth: where=%d", frame->observer.where);
+
+  prop_error(fn, novas_make_transform(frame, NOVAS_GCRS, NOVAS_ITRS, &T), 0);
+
+  loc = &frame->observer.on_surf;
+
+  // Apply ITRS -> ENU to each column of the GCRS -> ITRS matrix
+  for(k = 3; --k >= 0;) {
+    double col[3] = { T.matrix.M[0][k], T.matrix.M[1][k], T.matrix.M[2][k] }, enu[3];
+    novas_itrs_to_enu(col, loc->longitude, loc->latitude, enu);
+    g->M[0][k] = enu[0];
+    g->M[1][k] = enu[1];
+    g->M[2][k] = enu[2];
+  }
+
+  for(k = 3; --k >= 0;)
+    v[k] = frame->obs_vel[k] / C_AUDAY;
+
+  for(k = 3; --k >= 0;)
+    g->beta[k] = g->M[k][0] * v[0] + g->M[k][1] * v[1] + g->M[k][2] * v[2];
+
+  g->gamma = frame->gamma;
+  g->jd_tt = frame->time.ijd_tt + frame->time.fjd_tt;
+  g->loc = loc;
+
+  return 0;
+}
+
+/**
+ * Rotates a tile of source directions into the local horizontal system for one time of
+ * observation, optionally with an aberration correction, and returns the East-North-Up
+ * components. It is inlined into the SIMD variants below.
+ */
+SIMD_INLINE void grid_kernel(const grid_time *restrict g, int aberration, int n, const double *restrict x,
+        const double *restrict y, const double *restrict z, double *restrict e, double *restrict nn,
+        double *restrict u) {
+  const double m00 = g->M[0][0], m01 = g->M[0][1], m02 = g->M[0][2];
+  const double m10 = g->M[1][0], m11 = g->M[1][1], m12 = g->M[1][2];
+  const double m20 = g->M[2][0], m21 = g->M[2][1], m22 = g->M[2][2];
+  int i;
+
+  for(i = 0; i < n; i++) {
+    e[i] = m00 * x[i] + m01 * y[i] + m02 * z[i];
+    nn[i] = m10 * x[i] + m11 * y[i] + m12 * z[i];
+    u[i] = m20 * x[i] + m21 * y[i] + m22 * z[i];
+  }
+
+  if(aberration) {
+    const double be = g->beta[0], bn = g->beta[1], bu = g->beta[2], gam = g->gamma;
+
+    for(i = 0; i < n; i++) {
+      // Same as frame_aberration() for unit vectors.
+      const double p = e[i] * be + nn[i] * bn + u[i] * bu;
+      const double q = 1.0 + p / (1.0 + gam);
+      const double r = 1.0 / (1.0 + p);
+
+      e[i] = (gam * e[i] + q * be) * r;
+      nn[i] = (gam * nn[i] + q * bn) * r;
+      u[i] = (gam * u[i] + q * bu) * r;
+    }
+  }
+}
+
+/// \cond PRIVATE
+typedef void (*grid_kernel_func)(const grid_time *restrict g, int aberration, int n, const double *restrict x,
+        const double *restrict y, const double *restrict z, double *restrict e, double *restrict nn,
+        double *restrict u);
+
+#define GRID_KERNEL_VARIANT(name, attr) \
+  attr static void name(const grid_time *restrict g, int aberration, int n, const double *restrict x, \
+          const double *restrict y, const double *restrict z, double *restrict e, double *restrict nn, \
+          double *restrict u) { \
+    grid_kernel(g, aberration, n, x, y, z, e, nn, u); \
+  }
+
+GRID_KERNEL_VARIANT(grid_kernel_scalar, SIMD_SCALAR)
+#if SIMD_X86
+GRID_KERNEL_VARIANT(grid_kernel_sse2, SIMD_SSE2)
+GRID_KERNEL_VARIANT(grid_kernel_avx2, SIMD_AVX2)
+GRID_KERNEL_VARIANT(grid_kernel_avx512, SIMD_AVX512)
+#endif
+/// \endcond
+
+/**
+ * Returns the variant of grid_kernel() for the currently selected SIMD level.
+ *
+ * @sa novas_get_simd()
+ */
+static grid_kernel_func grid_kernel_for_simd(void) {
+  switch(novas_get_simd()) {
+#if SIMD_X86
+    case NOVAS_SIMD_AVX512: return grid_kernel_avx512;
+    case NOVAS_SIMD_AVX2: return grid_kernel_avx2;
+    case NOVAS_SIMD_SSE2: return grid_kernel_sse2;
+#endif
+    default: return grid_kernel_scalar;
+  }
+}
+
+/**
+ * Returns the relative airmass for a given (observed) elevation angle, using the formula of
+ * Kasten &amp; Young (1989), which is accurate to about 0.1% at all elevations down to the
+ * horizon.
+ *
+ * REFERENCES:
+ * <ol>
+ * <li>Kasten, F., &amp; Young, A. T. 1989, Applied Optics, 28, 4735</li>
+ * </ol>
+ *
+ * @param el    [deg] (Observed) elevation angle
+ * @return      Relative airmass (1.0 at zenith), or NAN if the elevation is below the horizon.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_hor_grid()
+ */
+double novas_airmass(double el) {
+  if(!(el >= 0.0 && el <= 90.0))
+    return NAN;
+  return 1.0 / (sin(el * DEGREE) + 0.50572 * pow(el + 6.07995, -1.6364));
+}
+
+/**
+ * Calculates horizontal coordinates (azimuth and elevation) and / or airmass, for a set of
+ * distant (non Solar-system) sources, at a set of times / observing frames for an Earth-bound
+ * observer, e.g. for observability planning. For each frame a single rotation matrix is
+ * calculated from ICRS to the local horizontal system (via novas_make_transform()), which is then
+ * applied to all sources in cache-friendly tiles.
+ *
+ * The outputs are N&times;M matrices in row-major order, with one row per source, i.e. the
+ * result for source _i_ at time (frame) _j_ is stored at index `i * n_times + j`.
+ *
+ * NOTES:
+ * <ol>
+ * <li>The input directions are used as is for all times. Thus, proper motion (and parallax) are
+ * not accounted for beyond the epoch for which the directions were calculated. You can use
+ * starvectors() and proper_motion() to calculate ICRS directions for the mid-point of the
+ * observing period.</li>
+ * <li>The gravitational deflection of light is neglected, which is below 0.1 arcsec for sources
+ * more than 5 degrees from the Sun, and well below the arcsecond level everywhere except at the
+ * Sun's limb. Apart from deflection, the results with aberration enabled match those of
+ * novas_sky_pos() followed by novas_app_to_hor().</li>
+ * </ol>
+ *
+ * @param frames      Array of observing frames, one per time of observation, all with an
+ *                    Earth-bound observer.
+ * @param n_times     Number of observing frames (times).
+ * @param dirs        ICRS unit vectors for the sources, as consecutive (x, y, z) triplets.
+ * @param n_src       Number of sources (unit vectors).
+ * @param aberration  Whether to apply the aberration correction for the observer's motion
+ *                    (boolean TRUE / non-zero), or else calculate positions for the geometric
+ *                    directions (FALSE / 0).
+ * @param ref_model   Refraction model to apply, or NULL to calculate unrefracted positions.
+ * @param[out] az     [deg] N&times;M azimuth angles [0:360) to populate, or NULL if not needed.
+ * @param[out] el     [deg] N&times;M elevation angles to populate, or NULL if not needed.
+ * @param[out] airmass  N&times;M airmasses to populate (NAN below the horizon), or NULL if not
+ *                    needed.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_airmass(), novas_make_transform(), novas_app_to_hor(), novas_make_frame()
+ * @sa novas_standard_refraction(), novas_optical_refraction(), novas_radio_refraction(),
+ *     novas_wave_refraction()
+ */
+int novas_hor_grid(const novas_frame *restrict frames, int n_times, const double *restrict dirs, int n_src, int aberration,
+        RefractionModel ref_model, double *restrict az, double *restrict el, double *restrict airmass) {
+  static const char *fn = "novas_hor_grid";
+
+  double x[GRID_SRC_TILE], y[GRID_SRC_TILE], z[GRID_SRC_TILE];
+  double e[GRID_SRC_TILE], nn[GRID_SRC_TILE], u[GRID_SRC_TILE];
+  grid_time g[GRID_TIME_TILE];
+  grid_kernel_func kernel;
+  int j0;
+
+  if(!frames || !dirs)
+    return novas_error(-1, EINVAL, fn, "NULL input: frames=%p, dirs=%p", frames, dirs);
+
+  if(!az && !el && !airmass)
+    return novas_error(-1, EINVAL, fn, "all outputs (az, el, airmass) are NULL");
+
+  if(n_times < 0 || n_src < 0)
+    return novas_error(-1, EINVAL, fn, "invalid grid size: %d x %d", n_src, n_times);
+
+  kernel = grid_kernel_for_simd();
+
+  for(j0 = 0; j0 < n_times; j0 += GRID_TIME_TILE) {
+    const int nt = (n_times - j0 < GRID_TIME_TILE) ? n_times - j0 : GRID_TIME_TILE;
+    int i0, j;
+
+    for(j = 0; j < nt; j++) {
+      const novas_frame *frame = &frames[j0 + j];
+
+      if(!novas_frame_is_initialized(frame))
+        return novas_error(-1, EINVAL, fn, "frame #%d not initialized", j0 + j);
+
+      prop_error(fn, grid_set_time(frame, &g[j]), 0);
+    }
+
+    for(i0 = 0; i0 < n_src; i0 += GRID_SRC_TILE) {
+      const int ns = (n_src - i0 < GRID_SRC_TILE) ? n_src - i0 : GRID_SRC_TILE;
+      const double *d = &dirs[3 * i0];
+      int i;
+
+      // Load source directions into separate component arrays
+      for(i = 0; i < ns; i++) {
+        x[i] = d[3 * i];
+        y[i] = d[3 * i + 1];
+        z[i] = d[3 * i + 2];
+      }
+
+      for(j = 0; j < nt; j++) {
+        kernel(&g[j], aberration, ns, x, y, z, e, nn, u);
+
+        for(i = 0; i < ns; i++) {
+          const long k = (long) (i0 + i) * n_times + j0 + j;
+          double h = asin(u[i] > 1.0 ? 1.0 : (u[i] < -1.0 ? -1.0 : u[i])) / DEGREE;
+
+          if(ref_model) {
+            PROFILE_START(t0);
+            h += ref_model(g[j].jd_tt, g[j].loc, NOVAS_REFRACT_ASTROMETRIC, h);
+            PROFILE_STOP(NOVAS_PROFILE_REFRACTION, t0, 1);
+          }
+
+          if(az) {
+            double A = atan2(e[i], nn[i]) / DEGREE;
+            az[k] = A < 0.0 ? A + DEG360 : A;
+          }
+          if(el)
+            el[k] = h;
+          if(airmass)
+            airmass[k] = novas_airmass(h);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Tabulates the refraction correction of a model for observed or astrometric elevations, on a
+ * regular grid spanning REFRACT_TABLE_MIN to 90 degrees.
+ *
+ * @param ref_model   Refraction model
+ * @param jd_tt       [day] TT-based Julian date of observation
+ * @param loc         Observer location, with weather parameters
+ * @param type        Whether the table is for observed or astrometric elevations.
+ * @param[out] tab    Table of refraction corrections to populate, with REFRACT_TABLE_SIZE entries.
+ */
+static void refract_table(RefractionModel ref_model, double jd_tt, const on_surface *loc,
+        enum novas_refraction_type type, double *tab) {
+  int i;
+  PROFILE_START(t0);
+
+  for(i = 0; i < REFRACT_TABLE_SIZE; i++)
+    tab[i] = ref_model(jd_tt, loc, type, REFRACT_TABLE_MIN + i * REFRACT_TABLE_STEP);
+
+  PROFILE_STOP(NOVAS_PROFILE_REFRACTION, t0, REFRACT_TABLE_SIZE);
+}
+
+/**
+ * Interpolates a tabulated refraction correction, with a 4-point Lagrange polynomial, for an
+ * observed elevation inside the table range.
+ *
+ * @param tab   Table of refraction corrections, from refract_table().
+ * @param el    [deg] Observed elevation, in the REFRACT_TABLE_MIN to 90 degree range.
+ * @return      [deg] The interpolated refraction correction.
+ */
+static double refract_interpolate(const double *tab, double el) {
+  const double u = (el - REFRACT_TABLE_MIN) / REFRACT_TABLE_STEP;
+  int k = (int) u - 1;
+  double f;
+
+  if(k < 0)
+    k = 0;
+  else if(k > REFRACT_TABLE_SIZE - 4)
+    k = REFRACT_TABLE_SIZE - 4;
+
+  tab += k;
+  f = u - k - 1;
+
+  return -f * (f - 1.0) * (f - 2.0) / 6.0 * tab[0] + (f + 1.0) * (f - 1.0) * (f - 2.0) / 2.0 * tab[1]
+          - (f + 1.0) * f * (f - 2.0) / 2.0 * tab[2] + (f + 1.0) * f * (f - 1.0) / 6.0 * tab[3];
+}
+
+/**
+ * Converts arrays of observed azimuth and elevation coordinates to right ascension (R.A.) and
+ * declination coordinates in the coordinate system of choice, e.g. to de-project all pixels of
+ * an all-sky camera image. It is equivalent to calling novas_hor_to_app() for each position,
+ * but the rotation chain from the local horizontal system to the output system is combined
+ * into a single 3x3 matrix, which is applied to all positions in cache-sized tiles. For large
+ * arrays, the refraction correction is also interpolated from a table of the refraction model,
+ * with 0.05 degree spacing, rather than evaluating the model for every position. The
+ * interpolation error is around 1 mas near the horizon, and much less elsewhere, for the
+ * standard, optical, and radio refraction models of the library.
+ *
+ * @param frame       Observer frame, defining the time and place of observation (on Earth).
+ * @param n           Number of positions to convert.
+ * @param az          [deg] Array of observed azimuth angles.
+ * @param el          [deg] Array of observed elevation angles.
+ * @param ref_model   An appropriate refraction model, or NULL to assume unrefracted elevations.
+ *                    Depending on the refraction model, you might want to make sure that the
+ *                    weather parameters were set when the observing frame was defined.
+ * @param sys         Astronomical coordinate system in which the output is R.A. and declination
+ *                    values are to be calculated.
+ * @param[out] ra     [h] Array to populate with the calculated apparent right ascension (R.A.)
+ *                    coordinates, or NULL if not required.
+ * @param[out] dec    [deg] Array to populate with the calculated apparent declination
+ *                    coordinates, or NULL if not required.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_hor_to_app(), novas_hor_grid(), novas_make_transform()
+ * @sa novas_standard_refraction(), novas_optical_refraction(), novas_radio_refraction(),
+ *     novas_wave_refraction()
+ */
+int novas_hor_to_app_array(const novas_frame *restrict frame, int n, const double *restrict az,
+        const double *restrict el, RefractionModel ref_model, enum novas_reference_system sys, double *restrict ra,
+        double *restrict dec) {
+  static const char *fn = "novas_hor_to_app_array";
+
+  double e[GRID_SRC_TILE], nn[GRID_SRC_TILE], u[GRID_SRC_TILE];
+  double x[GRID_SRC_TILE], y[GRID_SRC_TILE], z[GRID_SRC_TILE];
+  double tab[REFRACT_TABLE_SIZE];
+  const on_surface *loc;
+  novas_transform T;
+  grid_time g;
+  grid_kernel_func kernel;
+  double jd_tt;
+  int i0, k, use_table;
+
+  if(!frame || !az || !el)
+    return novas_error(-1, EINVAL, fn, "NULL input: frame=%p, az=%p, el=%p", frame, az, el);
+
+  if(!ra && !dec)
+    return novas_error(-1, EINVAL, fn, "Both output arrays (ra, dec) are NULL");
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  if(!novas_frame_is_initialized(frame))
+    return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
+
+  if(frame->observer.where != NOVAS_OBSERVER_ON_EARTH && frame->observer.where != NOVAS_AIRBORNE_OBSERVER)
+    return novas_error(-1, EINVAL, fn, "observer not on Earth: where=%d", frame->observer.where);
+
+  prop_error(fn, novas_make_transform(frame, NOVAS_ITRS, sys, &T), 0);
+
+  loc = &frame->observer.on_surf;
+  jd_tt = frame->time.ijd_tt + frame->time.fjd_tt;
+
+  // East-North-Up -> output system: apply the ITRS -> output transform to the ITRS directions
+  // of the local East, North, and Up axes.
+  for(k = 3; --k >= 0;) {
+    double itrs[3];
+    int j;
+
+    hor_to_itrs(loc, k == 1 ? 0.0 : 90.0, k == 2 ? 0.0 : 90.0, itrs);
+
+    for(j = 3; --j >= 0;)
+      g.M[j][k] = T.matrix.M[j][0] * itrs[0] + T.matrix.M[j][1] * itrs[1] + T.matrix.M[j][2] * itrs[2];
+  }
+
+  // Tabulate the refraction model, if it takes fewer model evaluations than the positions.
+  use_table = (ref_model && n > REFRACT_TABLE_SIZE);
+  if(use_table)
+    refract_table(ref_model, jd_tt, loc, NOVAS_REFRACT_OBSERVED, tab);
+
+  kernel = grid_kernel_for_simd();
+
+  for(i0 = 0; i0 < n; i0 += GRID_SRC_TILE) {
+    const int ns = (n - i0 < GRID_SRC_TILE) ? n - i0 : GRID_SRC_TILE;
+    int i;
+
+    for(i = 0; i < ns; i++) {
+      const double A = az[i0 + i] * DEGREE;
+      double h = el[i0 + i];
+
+      if(ref_model) {
+        if(use_table && h >= REFRACT_TABLE_MIN && h <= 90.0)
+          h -= refract_interpolate(tab, h);
+        else {
+          PROFILE_START(t0);
+          h -= ref_model(jd_tt, loc, NOVAS_REFRACT_OBSERVED, h);
+          PROFILE_STOP(NOVAS_PROFILE_REFRACTION, t0, 1);
+        }
+      }
+
+      h *= DEGREE;
+
+      x[i] = cos(h) * sin(A);
+      y[i] = cos(h) * cos(A);
+      z[i] = sin(h);
+    }
+
+    kernel(&g, 0, ns, x, y, z, e, nn, u);
+
+    for(i = 0; i < ns; i++) {
+      if(ra) {
+        double r = atan2(nn[i], e[i]) / HOURANGLE;
+        ra[i0 + i] = r < 0.0 ? r + DAY_HOURS : r;
+      }
+      if(dec)
+        dec[i0 + i] = atan2(u[i], sqrt(e[i] * e[i] + nn[i] * nn[i])) / DEGREE;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Single-precision two-argument arctangent, with a polynomial approximation that compilers can
+ * vectorize (unlike atan2f() calls). The polynomial (Abramowitz &amp; Stegun 4.4.49) is accurate
+ * to 2e-8 rad, i.e. below the single-precision rounding of the result.
+ *
+ * @param y   y coordinate
+ * @param x   x coordinate
+ * @return    [rad] The angle of the (x, y) vector from the x axis, in the -&pi; to &pi; range.
+ */
+SIMD_INLINE float atan2_f32(float y, float x) {
+  const float ax = fabsf(x), ay = fabsf(y);
+  const float hi = ax > ay ? ax : ay, lo = ax > ay ? ay : ax;
+  const float t = hi > 0.0f ? lo / hi : 0.0f, t2 = t * t;
+  float r;
+
+  r = 0.0028662257f;
+  r = r * t2 - 0.0161657367f;
+  r = r * t2 + 0.0429096138f;
+  r = r * t2 - 0.0752896400f;
+  r = r * t2 + 0.1065626393f;
+  r = r * t2 - 0.1420889944f;
+  r = r * t2 + 0.1999355085f;
+  r = r * t2 - 0.3333314528f;
+  r = t + t * t2 * r;
+
+  r = ay > ax ? (float) HALF_PI - r : r;
+  r = x < 0.0f ? (float) M_PI - r : r;
+  return y < 0.0f ? -r : r;
+}
+
+/**
+ * Single-precision parameters for novas_hor_positions_f32(), for one time of observation.
+ */
+typedef struct {
+  float M[3][3];          ///< GCRS to East-North-Up rotation matrix
+  float beta[3];          ///< observer velocity / c, in East-North-Up
+  float gamma;            ///< sqrt(1 - beta^2)
+  const float *tab;       ///< Refraction table for astrometric elevations, or NULL
+} hor_f32_params;
+
+/**
+ * Calculates single-precision horizontal positions for a tile of (up to GRID_SRC_TILE) sources,
+ * for novas_hor_positions_f32(). Elevations are refracted only if the parameters contain a
+ * refraction table. It is inlined into the SIMD variants below.
+ */
+SIMD_INLINE void hor_f32_kernel(const hor_f32_params *restrict P, int ns, const float *restrict px,
+        const float *restrict py, const float *restrict pz, float *restrict az, float *restrict el) {
+  const float m00 = P->M[0][0], m01 = P->M[0][1], m02 = P->M[0][2];
+  const float m10 = P->M[1][0], m11 = P->M[1][1], m12 = P->M[1][2];
+  const float m20 = P->M[2][0], m21 = P->M[2][1], m22 = P->M[2][2];
+  const float be = P->beta[0], bn = P->beta[1], bu = P->beta[2], gam = P->gamma;
+  const float *restrict ftab = P->tab;
+  float e[GRID_SRC_TILE], nn[GRID_SRC_TILE], u[GRID_SRC_TILE], h[GRID_SRC_TILE];
+  int i;
+
+  // Rotation into East-North-Up, and aberration (as in grid_kernel())
+  for(i = 0; i < ns; i++) {
+    const float ei = m00 * px[i] + m01 * py[i] + m02 * pz[i];
+    const float ni = m10 * px[i] + m11 * py[i] + m12 * pz[i];
+    const float ui = m20 * px[i] + m21 * py[i] + m22 * pz[i];
+    const float p = ei * be + ni * bn + ui * bu;
+    const float q = 1.0f + p / (1.0f + gam);
+    const float r = 1.0f / (1.0f + p);
+
+    e[i] = (gam * ei + q * be) * r;
+    nn[i] = (gam * ni + q * bn) * r;
+    u[i] = (gam * ui + q * bu) * r;
+  }
+
+  if(el) {
+    // sqrtf() may set errno, so keep it out of the vectorized loop.
+    for(i = 0; i < ns; i++)
+      h[i] = sqrtf(e[i] * e[i] + nn[i] * nn[i]);
+
+    for(i = 0; i < ns; i++)
+      h[i] = atan2_f32(u[i], h[i]) * (float) (1.0 / DEGREE);
+
+    if(ftab) {
+      for(i = 0; i < ns; i++) {
+        // Linear interpolation, with zero refraction below the table range.
+        const float t = (h[i] - (float) REFRACT_TABLE_MIN) * (float) (1.0 / REFRACT_TABLE_STEP);
+        const float tc = t < 0.0f ? 0.0f : (t > REFRACT_TABLE_SIZE - 1.001f ? REFRACT_TABLE_SIZE - 1.001f : t);
+        const int l = (int) tc;
+        const float f = tc - l;
+        const float R = ftab[l] + f * (ftab[l + 1] - ftab[l]);
+
+        el[i] = h[i] + (t < 0.0f ? 0.0f : R);
+      }
+    }
+    else {
+      for(i = 0; i < ns; i++)
+        el[i] = h[i];
+    }
+  }
+
+  if(az) {
+    for(i = 0; i < ns; i++) {
+      const float A = atan2_f32(e[i], nn[i]) * (float) (1.0 / DEGREE);
+      az[i] = A < 0.0f ? A + (float) DEG360 : A;
+    }
+  }
+}
+
+/// \cond PRIVATE
+typedef void (*hor_f32_kernel_func)(const hor_f32_params *restrict P, int ns, const float *restrict px,
+        const float *restrict py, const float *restrict pz, float *restrict az, float *restrict el);
+
+#define HOR_F32_KERNEL_VARIANT(name, attr) \
+  attr static void name(const hor_f32_params *restrict P, int ns, const float *restrict px, \
+          const float *restrict py, const float *restrict pz, float *restrict az, float *restrict el) { \
+    hor_f32_kernel(P, ns, px, py, pz, az, el); \
+  }
+
+HOR_F32_KERNEL_VARIANT(hor_f32_kernel_scalar, SIMD_SCALAR)
+#if SIMD_X86
+HOR_F32_KERNEL_VARIANT(hor_f32_kernel_sse2, SIMD_SSE2)
+HOR_F32_KERNEL_VARIANT(hor_f32_kernel_avx2, SIMD_AVX2)
+HOR_F32_KERNEL_VARIANT(hor_f32_kernel_avx512, SIMD_AVX512)
+#endif
+/// \endcond
+
+/**
+ * Returns the variant of hor_f32_kernel() for the currently selected SIMD level.
+ *
+ * @sa novas_get_simd()
+ */
+static hor_f32_kernel_func hor_f32_kernel_for_simd(void) {
+  switch(novas_get_simd()) {
+#if SIMD_X86
+    case NOVAS_SIMD_AVX512: return hor_f32_kernel_avx512;
+    case NOVAS_SIMD_AVX2: return hor_f32_kernel_avx2;
+    case NOVAS_SIMD_SSE2: return hor_f32_kernel_sse2;
+#endif
+    default: return hor_f32_kernel_scalar;
+  }
+}
+
+/**
+ * Calculates apparent horizontal (azimuth and elevation) positions for large arrays of distant
+ * sources (e.g. all stars of a catalog) in single precision, e.g. for planetarium-style
+ * rendering at the arcsecond level. The inputs are ICRS unit vectors, given as separate arrays of
+ * x, y, and z components (structure of arrays), which are rotated into the local horizontal
+ * system with a single 3x3 matrix, followed by the aberration correction for the observer's
+ * motion, and optionally an atmospheric refraction correction, all in single-precision
+ * arithmetic. The calculation is done in cache-sized tiles, with loops free of library calls,
+ * which compilers can vectorize fully, e.g. with 8 lanes for AVX2 or 16 lanes for AVX-512. On
+ * x86 CPUs, the variant for the best supported instruction set is selected at runtime (see
+ * novas_get_simd()). For large arrays, the refraction correction is interpolated linearly from
+ * a table of the refraction model, with 0.05 degree spacing.
+ *
+ * Compared to novas_geom_to_app() and novas_app_to_hor() in double precision, the positions are
+ * typically accurate to ~0.05 arcsec, and better than 1 arcsec everywhere above the horizon,
+ * except within a few degrees of the Sun, where the gravitational deflection of light, which is
+ * neglected here, reaches 1.75 arcsec at the limb. The tabulated refraction adds up to ~0.2
+ * arcsec of error near the horizon.
+ *
+ * @param frame       Observer frame, defining the time and place of observation (on Earth).
+ * @param n           Number of sources
+ * @param x           Array of ICRS unit vector x components
+ * @param y           Array of ICRS unit vector y components
+ * @param z           Array of ICRS unit vector z components
+ * @param ref_model   An appropriate refraction model, or NULL to calculate unrefracted elevations.
+ *                    Depending on the refraction model, you might want to make sure that the
+ *                    weather parameters were set when the observing frame was defined.
+ * @param[out] az     [deg] Array to populate with azimuth angles [0:360), or NULL if not required.
+ * @param[out] el     [deg] Array to populate with elevation angles, or NULL if not required.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_hor_grid(), novas_app_to_hor(), novas_geom_to_app()
+ * @sa novas_standard_refraction(), novas_optical_refraction(), novas_radio_refraction(),
+ *     novas_wave_refraction()
+ */
+int novas_hor_positions_f32(const novas_frame *restrict frame, int n, const float *restrict x,
+        const float *restrict y, const float *restrict z, RefractionModel ref_model, float *restrict az,
+        float *restrict el) {
+  static const char *fn = "novas_hor_positions_f32";
+
+  float ftab[REFRACT_TABLE_SIZE];
+  hor_f32_params P;
+  hor_f32_kernel_func kernel;
+  grid_time g;
+  int i0, j, k, use_table;
+
+  if(!frame || !x || !y || !z)
+    return novas_error(-1, EINVAL, fn, "NULL input: frame=%p, x=%p, y=%p, z=%p", frame, x, y, z);
+
+  if(!az && !el)
+    return novas_error(-1, EINVAL, fn, "Both output arrays (az, el) are NULL");
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  if(!novas_frame_is_initialized(frame))
+    return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
+
+  prop_error(fn, grid_set_time(frame, &g), 0);
+
+  for(j = 3; --j >= 0;) {
+    for(k = 3; --k >= 0;)
+      P.M[j][k] = (float) g.M[j][k];
+    P.beta[j] = (float) g.beta[j];
+  }
+  P.gamma = (float) g.gamma;
+  P.tab = NULL;
+
+  // Tabulate the refraction model (for astrometric elevations), if it takes fewer model
+  // evaluations than the positions.
+  use_table = (ref_model && n > REFRACT_TABLE_SIZE);
+  if(use_table) {
+    double tab[REFRACT_TABLE_SIZE];
+
+    refract_table(ref_model, g.jd_tt, g.loc, NOVAS_REFRACT_ASTROMETRIC, tab);
+
+    for(k = 0; k < REFRACT_TABLE_SIZE; k++)
+      ftab[k] = (float) tab[k];
+
+    P.tab = ftab;
+  }
+
+  kernel = hor_f32_kernel_for_simd();
+
+  for(i0 = 0; i0 < n; i0 += GRID_SRC_TILE) {
+    const int ns = (n - i0 < GRID_SRC_TILE) ? n - i0 : GRID_SRC_TILE;
+    float *pel = el ? &el[i0] : NULL;
+    int i;
+
+    kernel(&P, ns, &x[i0], &y[i0], &z[i0], az ? &az[i0] : NULL, pel);
+
+    if(pel && ref_model && !use_table) {
+      PROFILE_START(t0);
+
+      for(i = 0; i < ns; i++)
+        pel[i] += (float) ref_model(g.jd_tt, g.loc, NOVAS_REFRACT_ASTROMETRIC, pel[i]);
+
+      PROFILE_STOP(NOVAS_PROFILE_REFRACTION, t0, ns);
+    }
+  }
+
+  return 0;
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
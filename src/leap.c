@@ -0,0 +1,372 @@
+/**
+ * @file
+ *
+ *  Leap seconds, i.e. the TAI - UTC time difference, from a built-in table, or else from an
+ *  updated table loaded from an IERS (`Leap_Second.dat`) or IANA (`leap-seconds.list`) file, and
+ *  the conversion of arrays of UNIX times to Julian dates in the TT, TAI, GPS, and TDB timescales
+ *  without the need for the caller to supply the leap seconds.
+ *
+ *  Leap seconds change only every few years at most. Thus, the batch conversion keeps the time
+ *  interval in which the current leap second value is valid, so for the typical high-rate stream
+ *  of times the leap seconds are confirmed by a single comparison.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa timescale.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+#define MJD_UNIX0       40587               ///< [day] MJD of the UNIX epoch (1970-01-01 0h UTC)
+#define IJD_UNIX0       2440587             ///< [day] Integer JD of noon before the UNIX epoch
+#define NTP_UNIX0       2208988800.0        ///< [s] NTP time of the UNIX epoch
+#define LEAP_REUSE_TDB  1.0                 ///< [s] time span over which the TDB - TT difference is reused
+
+/**
+ * A leap second table entry.
+ */
+typedef struct {
+  double unix_time;       ///< [s] UNIX time from which the leap seconds are valid
+  int leap;               ///< [s] TAI - UTC time difference
+} leap_entry;
+
+/// The built-in leap seconds table (no new leap seconds announced since 2017 January 1)
+static const leap_entry builtin_leaps[] = {
+        { 63072000.0, 10 },     // 1972 Jan 1
+        { 78796800.0, 11 },     // 1972 Jul 1
+        { 94694400.0, 12 },     // 1973 Jan 1
+        { 126230400.0, 13 },    // 1974 Jan 1
+        { 157766400.0, 14 },    // 1975 Jan 1
+        { 189302400.0, 15 },    // 1976 Jan 1
+        { 220924800.0, 16 },    // 1977 Jan 1
+        { 252460800.0, 17 },    // 1978 Jan 1
+        { 283996800.0, 18 },    // 1979 Jan 1
+        { 315532800.0, 19 },    // 1980 Jan 1
+        { 362793600.0, 20 },    // 1981 Jul 1
+        { 394329600.0, 21 },    // 1982 Jul 1
+        { 425865600.0, 22 },    // 1983 Jul 1
+        { 489024000.0, 23 },    // 1985 Jul 1
+        { 567993600.0, 24 },    // 1988 Jan 1
+        { 631152000.0, 25 },    // 1990 Jan 1
+        { 662688000.0, 26 },    // 1991 Jan 1
+        { 709948800.0, 27 },    // 1992 Jul 1
+        { 741484800.0, 28 },    // 1993 Jul 1
+        { 773020800.0, 29 },    // 1994 Jul 1
+        { 820454400.0, 30 },    // 1996 Jan 1
+        { 867715200.0, 31 },    // 1997 Jul 1
+        { 915148800.0, 32 },    // 1999 Jan 1
+        { 1136073600.0, 33 },   // 2006 Jan 1
+        { 1230768000.0, 34 },   // 2009 Jan 1
+        { 1341100800.0, 35 },   // 2012 Jul 1
+        { 1435708800.0, 36 },   // 2015 Jul 1
+        { 1483228800.0, 37 }    // 2017 Jan 1
+};
+
+static const leap_entry *leaps = builtin_leaps;       ///< The leap seconds table currently in use
+static int n_leaps = sizeof(builtin_leaps) / sizeof(leap_entry);  ///< Number of entries in the current table
+static leap_entry *loaded_leaps;                      ///< Leap seconds table loaded from a file, if any
+/// \endcond
+
+/**
+ * Looks up the leap seconds for a UNIX time, and the time interval in which that value is valid.
+ *
+ * @param unix_time   [s] UNIX time (not NAN).
+ * @param[out] from   [s] UNIX time from which the returned leap seconds are valid.
+ * @param[out] to     [s] UNIX time until which the returned leap seconds are valid.
+ * @return            [s] The leap seconds (TAI - UTC time difference) at the given time.
+ */
+static int leap_lookup(double unix_time, double *restrict from, double *restrict to) {
+  int lo = 0, hi = n_leaps;
+
+  // Find the first entry after the time.
+  while(lo < hi) {
+    const int mid = (lo + hi) >> 1;
+    if(leaps[mid].unix_time <= unix_time)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  *from = lo > 0 ? leaps[lo - 1].unix_time : -INFINITY;
+  *to = lo < n_leaps ? leaps[lo].unix_time : INFINITY;
+
+  // Prior to 1972 we return the 1972 value.
+  return leaps[lo > 0 ? lo - 1 : 0].leap;
+}
+
+/**
+ * Returns the leap seconds (TAI - UTC time difference) for the specified UTC-based Julian date,
+ * from the built-in leap seconds table, or else the table that was loaded via
+ * novas_load_leap_seconds(). The value can be used with novas_set_time(),
+ * novas_set_unix_time() etc., which require leap seconds as an argument.
+ *
+ * NOTES:
+ * <ol>
+ * <li>UTC was not defined with integer leap seconds before 1972. For earlier dates the function
+ * returns the leap seconds of 1972 January 1, i.e. 10 seconds.</li>
+ * <li>For future dates the latest leap seconds value is returned, which is correct only until
+ * the next leap second is announced by IERS. You may use novas_load_leap_seconds() to load an
+ * updated table as necessary.</li>
+ * </ol>
+ *
+ * @param jd_utc    [day] UTC-based Julian date
+ * @return          [s] The leap seconds (TAI - UTC time difference) at the specified date, or
+ *                  else -1 if the date is NAN (errno set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_load_leap_seconds(), novas_unix_to_jd(), novas_set_time(), get_utc_to_tt()
+ */
+int novas_leap_seconds(double jd_utc) {
+  double from, to;
+
+  if(isnan(jd_utc))
+    return novas_error(-1, EINVAL, "novas_leap_seconds", "input date is NAN");
+
+  return leap_lookup((jd_utc - IJD_UNIX0 - 0.5) * DAY, &from, &to);
+}
+
+/**
+ * Loads an updated leap seconds table from a file, to replace the built-in table (or the table
+ * loaded previously). Both the IERS `Leap_Second.dat` format (with MJD, day, month, year, and
+ * TAI - UTC columns) and the IANA / NIST `leap-seconds.list` format (with NTP time and TAI - UTC
+ * columns) are supported, and the format is detected automatically. Lines starting with '#' are
+ * treated as comments and ignored.
+ *
+ * Up-to-date leap seconds tables are available from IERS at
+ * <a href="https://hpiers.obspm.fr/iers/bul/bulc/Leap_Second.dat">
+ * https://hpiers.obspm.fr/iers/bul/bulc/Leap_Second.dat</a> or from IANA at
+ * <a href="https://data.iana.org/time-zones/tzdb/leap-seconds.list">
+ * https://data.iana.org/time-zones/tzdb/leap-seconds.list</a>.
+ *
+ * NOTES:
+ * <ol>
+ * <li>This function is not thread-safe. You should load leap seconds before using them in any
+ * of the threads of your application.</li>
+ * </ol>
+ *
+ * @param filename    Path to the leap seconds file, or NULL to revert to the built-in table.
+ * @return            The number of leap second entries in the table now in use, or else -1 if
+ *                    there was an error (errno will indicate the type of error), in which case
+ *                    the previous table remains in use.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_leap_seconds(), novas_unix_to_jd()
+ */
+int novas_load_leap_seconds(const char *filename) {
+  static const char *fn = "novas_load_leap_seconds";
+
+  leap_entry *table = NULL;
+  char line[256];
+  FILE *fp;
+  int n = 0, capacity = 0;
+
+  if(!filename) {
+    leaps = builtin_leaps;
+    n_leaps = sizeof(builtin_leaps) / sizeof(leap_entry);
+    free(loaded_leaps);
+    loaded_leaps = NULL;
+    return n_leaps;
+  }
+
+  fp = fopen(filename, "r");
+  if(!fp)
+    return novas_error(-1, errno, fn, "could not open %s: %s", filename, strerror(errno));
+
+  while(fgets(line, sizeof(line), fp)) {
+    char *s = line, *next;
+    double t = strtod(s, &next);
+    long leap;
+
+    if(next == s)
+      continue;       // comment, blank, or other non-data line
+
+    if(t > 1e6)
+      t -= NTP_UNIX0;                    // IANA: NTP seconds
+    else {
+      int k;
+      t = (t - MJD_UNIX0) * DAY;         // IERS: MJD, then skip day, month, year
+      for(k = 0; k < 3; k++)
+        strtol(next, &next, 10);
+    }
+
+    s = next;
+    leap = strtol(s, &next, 10);
+    if(next == s)
+      continue;
+
+    if(n > 0 && t <= table[n - 1].unix_time) {
+      fclose(fp);
+      free(table);
+      return novas_error(-1, EINVAL, fn, "%s: leap seconds not in chronological order at line %d", filename, n + 1);
+    }
+
+    if(n >= capacity) {
+      leap_entry *old = table;
+      capacity = capacity ? 2 * capacity : 64;
+      table = (leap_entry *) realloc(table, capacity * sizeof(leap_entry));
+      if(!table) {
+        fclose(fp);
+        free(old);
+        return novas_error(-1, errno, fn, "alloc error (%d entries): %s", capacity, strerror(errno));
+      }
+    }
+
+    table[n].unix_time = t;
+    table[n].leap = (int) leap;
+    n++;
+  }
+
+  fclose(fp);
+
+  if(n == 0) {
+    free(table);
+    return novas_error(-1, EINVAL, fn, "no leap seconds in %s", filename);
+  }
+
+  leaps = table;
+  n_leaps = n;
+  free(loaded_leaps);
+  loaded_leaps = table;
+
+  return n;
+}
+
+/**
+ * Converts an array of UNIX times (i.e. UTC-based seconds since 1970 January 1, 0h UTC) to
+ * Julian dates in the TT, TAI, GPS, TDB, or UTC timescales, using the built-in leap seconds
+ * table (or else the table loaded via novas_load_leap_seconds()). It is meant for high-rate
+ * streams of timestamps, which would otherwise need to look up the leap seconds for every time.
+ * The function keeps the time interval over which the last leap seconds value remains valid, so
+ * typically the leap seconds are confirmed with a single comparison per time.
+ *
+ * NOTES:
+ * <ol>
+ * <li>The TDB - TT time difference is calculated with tt2tdb_hp() for every second of time
+ * at most, and reused for times within a second of that, which results in errors below 1 ns.</li>
+ * <li>Input times that are NAN will result in NAN outputs.</li>
+ * </ol>
+ *
+ * @param unix_time   [s] Array of UNIX times, i.e. seconds since 1970 January 1, 0h UTC, as
+ *                    returned by `time()` or `clock_gettime()` (with the nanoseconds added),
+ *                    excluding leap seconds.
+ * @param n           Number of times to convert.
+ * @param scale       The timescale for the output Julian dates. One of NOVAS_TT, NOVAS_TAI,
+ *                    NOVAS_GPS, NOVAS_TDB, or NOVAS_UTC.
+ * @param[out] ijd    [day] Array of `n` integer Julian days to populate, or NULL to return the
+ *                    full Julian dates in `fjd` instead.
+ * @param[out] fjd    [day] Array of `n` values to populate with fractional Julian days relative
+ *                    to `ijd`, or the full Julian dates if `ijd` is NULL. The full Julian dates
+ *                    have about 20 &mu;s precision, whereas the split dates retain the full
+ *                    precision of the inputs.
+ * @return            0 if successful, or else -1 if there was an error (errno will be set to
+ *                    EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_leap_seconds(), novas_load_leap_seconds(), novas_set_unix_time()
+ */
+int novas_unix_to_jd(const double *restrict unix_time, int n, enum novas_timescale scale, long *restrict ijd,
+        double *restrict fjd) {
+  static const char *fn = "novas_unix_to_jd";
+
+  double from = INFINITY, to = -INFINITY, offset = 0.0, dt0 = 0.0;
+  double last_tt = NAN, tdb = 0.0;
+  int i, leap = 0;
+
+  if(!unix_time || !fjd)
+    return novas_error(-1, EINVAL, fn, "NULL argument: unix_time=%p, fjd=%p", unix_time, fjd);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  switch(scale) {
+    case NOVAS_UTC:
+      break;
+    case NOVAS_TAI:
+      break;
+    case NOVAS_GPS:
+      dt0 = -NOVAS_GPS_TO_TAI;
+      break;
+    case NOVAS_TT:
+    case NOVAS_TDB:
+      dt0 = NOVAS_TAI_TO_TT;
+      break;
+    default:
+      return novas_error(-1, EINVAL, fn, "unsupported timescale: %d", scale);
+  }
+
+  for(i = 0; i < n; i++) {
+    const double t = unix_time[i];
+    double d, f;
+    long id;
+
+    if(!(t >= from && t < to)) {
+      if(isnan(t)) {
+        if(ijd) ijd[i] = 0;
+        fjd[i] = NAN;
+        continue;
+      }
+
+      leap = leap_lookup(t, &from, &to);
+      offset = (scale == NOVAS_UTC) ? 0.0 : leap + dt0;
+    }
+
+    d = floor(t / DAY);
+    id = IJD_UNIX0 + (long) d;
+    f = 0.5 + (t - d * DAY + offset) / DAY;
+
+    if(scale == NOVAS_TDB) {
+      const double jd_tt = id + f;
+      if(!(fabs(jd_tt - last_tt) * DAY < LEAP_REUSE_TDB)) {
+        tdb = tt2tdb_hp(jd_tt);
+        last_tt = jd_tt;
+      }
+      f += tdb / DAY;
+    }
+
+    if(f >= 1.0) {
+      const long k = (long) floor(f);
+      id += k;
+      f -= k;
+    }
+
+    if(ijd) {
+      ijd[i] = id;
+      fjd[i] = f;
+    }
+    else
+      fjd[i] = id + f;
+  }
+
+  return 0;
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
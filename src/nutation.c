@@ -34,8 +34,6 @@ namespace novas {
 #endif
 
 /// \cond PRIVATE
-#define T0        NOVAS_JD_J2000
-
 /**
  * Data structure to contain coefficients for a single periodic nutation term.
  *
@@ -54,10 +52,30 @@ typedef struct {
 
 /// \endcond
 
+/**
+ * Calculates nutation angles using the nutation model appropriate for the accuracy, without
+ * caching.
+ *
+ * @sa nutation_angles(), nutation_angles_ctx()
+ */
+static void calc_nutation_angles(double t, enum novas_accuracy accuracy, double *restrict dpsi, double *restrict deps) {
+  novas_nutation_provider nutate_call = (accuracy == NOVAS_FULL_ACCURACY) ? iau2000a : get_nutation_lp_provider();
+
+  if(accuracy == NOVAS_FAST_ACCURACY)
+    nutate_call = novas_nutation_fast;
+
+  nutate_call(JD_J2000, t * JULIAN_CENTURY_DAYS, dpsi, deps);
+
+  // Convert output to arcseconds.
+  *dpsi /= ARCSEC;
+  *deps /= ARCSEC;
+}
+
 /**
  * Returns the IAU2000 / 2006 values for nutation in longitude and nutation in obliquity for a given TDB
  * Julian date and the desired level of accuracy. For NOVAS_FULL_ACCURACY (0), the IAU 2000A R06
- * nutation model is used. Otherwise, the model set by set_nutation_lp_provider() is used, or else
+ * nutation model is used, and for NOVAS_FAST_ACCURACY (2) the short series of
+ * novas_nutation_fast(). Otherwise, the model set by set_nutation_lp_provider() is used, or else
  * the iau2000b() by default.
  *
  * REFERENCES:
@@ -69,14 +87,14 @@ typedef struct {
  * </ol>
  *
  * @param t           [cy] TDB time in Julian centuries since J2000.0
- * @param accuracy    NOVAS_FULL_ACCURACY (0) or NOVAS_REDUCED_ACCURACY (1)
+ * @param accuracy    NOVAS_FULL_ACCURACY (0), NOVAS_REDUCED_ACCURACY (1), or NOVAS_FAST_ACCURACY (2)
  * @param[out] dpsi   [arcsec] Nutation in longitude in arcseconds.
  * @param[out] deps   [arcsec] Nutation in obliquity in arcseconds.
  *
  * @return            0 if successful, or -1 if the output pointer arguments are NULL
  *
  * @sa nutation(), set_nutation_lp_provider()
- * @sa iau2000a(), iau2000b(), nu2000k()
+ * @sa iau2000a(), iau2000b(), nu2000k(), novas_nutation_fast()
  * @sa NOVAS_JD_J2000
  */
 int nutation_angles(double t, enum novas_accuracy accuracy, double *restrict dpsi, double *restrict deps) {
@@ -92,14 +110,10 @@ int nutation_angles(double t, enum novas_accuracy accuracy, double *restrict dps
     return novas_error(-1, EINVAL, "nutation_angles", "NULL output pointer: dspi=%p, deps=%p", dpsi, deps);
   }
 
-  if(!(fabs(t - last_t) < 1e-12) || (accuracy != last_acc)) {
-    novas_nutation_provider nutate_call = (accuracy == NOVAS_FULL_ACCURACY) ? iau2000a : get_nutation_lp_provider();
-    nutate_call(JD_J2000, t * JULIAN_CENTURY_DAYS, &last_dpsi, &last_deps);
-
-    // Convert output to arcseconds.
-    last_dpsi /= ARCSEC;
-    last_deps /= ARCSEC;
+  PROFILE_CACHE(NOVAS_PROFILE_NUTATION_CACHE, fabs(t - last_t) < 1e-12 && accuracy == last_acc);
 
+  if(!(fabs(t - last_t) < 1e-12) || (accuracy != last_acc)) {
+    calc_nutation_angles(t, accuracy, &last_dpsi, &last_deps);
     last_acc = accuracy;
     last_t = t;
   }
@@ -110,6 +124,56 @@ int nutation_angles(double t, enum novas_accuracy accuracy, double *restrict dps
   return 0;
 }
 
+/**
+ * Returns the IAU2000 / 2006 values for nutation in longitude and nutation in obliquity, like
+ * nutation_angles(), but using the multi-entry cache of an explicit computation context, instead
+ * of the single-entry thread-local cache of nutation_angles().
+ *
+ * @param ctx         The computation context.
+ * @param t           [cy] TDB time in Julian centuries since J2000.0
+ * @param accuracy    NOVAS_FULL_ACCURACY (0), NOVAS_REDUCED_ACCURACY (1), or NOVAS_FAST_ACCURACY (2)
+ * @param[out] dpsi   [arcsec] Nutation in longitude in arcseconds.
+ * @param[out] deps   [arcsec] Nutation in obliquity in arcseconds.
+ * @return            0 if successful, or -1 if the context or output pointer arguments are NULL,
+ *                    or if the accuracy is invalid (errno will be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa nutation_angles(), novas_init_context(), NOVAS_NUTATION_CACHE
+ */
+int nutation_angles_ctx(novas_context *ctx, double t, enum novas_accuracy accuracy, double *restrict dpsi,
+        double *restrict deps) {
+  static const char *fn = "nutation_angles_ctx";
+  const double key[2] = { t, (double) accuracy };
+  double *v;
+
+  if(!ctx || !dpsi || !deps) {
+    if(dpsi)
+      *dpsi = NAN;
+    if(deps)
+      *deps = NAN;
+
+    return novas_error(-1, EINVAL, fn, "NULL argument: ctx=%p, dpsi=%p, deps=%p", ctx, dpsi, deps);
+  }
+
+  if(accuracy < NOVAS_FULL_ACCURACY || accuracy > NOVAS_FAST_ACCURACY) {
+    *dpsi = *deps = NAN;
+    return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", accuracy);
+  }
+
+  v = novas_cache_lookup(ctx, NOVAS_NUTATION_CACHE, key, 2);
+  if(!v) {
+    v = novas_cache_store(ctx, NOVAS_NUTATION_CACHE, key, 2);
+    calc_nutation_angles(t, accuracy, &v[0], &v[1]);
+  }
+
+  *dpsi = v[0];
+  *deps = v[1];
+
+  return 0;
+}
+
 static double sum_terms(double t, const double *a, const nutation_terms *P0, int N0, const nutation_terms *P1, int N1) {
   double sum = 0.0;
   int i;
@@ -141,7 +205,7 @@ static double sum_terms(double t, const double *a, const nutation_terms *P0, int
 
 static int iau2006_fp(double jd_tt_high, double jd_tt_low, int nA0, int nA1, int nB0, int nB1, double *restrict dpsi, double *restrict deps) {
   // Interval between fundamental epoch J2000.0 and given date.
-  const double t = ((jd_tt_high - T0) + jd_tt_low) / JULIAN_CENTURY_DAYS;
+  const double t = ((jd_tt_high - JD_J2000) + jd_tt_low) / JULIAN_CENTURY_DAYS;
 
   double a[14] = {0.0};
   int i;
@@ -299,7 +363,7 @@ int iau2000b(double jd_tt_high, double jd_tt_low, double *restrict dpsi, double
  */
 int nu2000k(double jd_tt_high, double jd_tt_low, double *restrict dpsi, double *restrict deps) {
   // Interval between fundamental epoch J2000.0 and given date.
-  const double t = ((jd_tt_high - T0) + jd_tt_low) / JULIAN_CENTURY_DAYS;
+  const double t = ((jd_tt_high - JD_J2000) + jd_tt_low) / JULIAN_CENTURY_DAYS;
 
   // Planetary longitudes, Mercury through Neptune, wrt mean dynamical
   // ecliptic and equinox of J2000, with high order terms omitted
@@ -421,6 +485,42 @@ int nu2000k(double jd_tt_high, double jd_tt_low, double *restrict dpsi, double *
 }
 
 
+/**
+ * Computes a short nutation series, with only the 13 largest terms in longitude and the 9 largest
+ * terms in obliquity of the IAU 2000A R06 model (plus the leading secular rate terms), for
+ * applications that need ~0.1 arcsec accuracy at the lowest computational cost. The largest
+ * errors, compared to iau2000a(), are 0.05 arcsec in d&psi; and 0.03 arcsec in d&epsilon; from
+ * 1900 to 2100. It is the nutation model used for NOVAS_FAST_ACCURACY, and it may be used also
+ * as the low-precision nutation provider via set_nutation_lp_provider().
+ *
+ * REFERENCES:
+ * <ol>
+ *  <li>IERS Conventions (2003), Chapter 5.</li>
+ *  <li>Capitaine, N. et al. (2003), Astronomy And Astrophysics 412, pp. 567-586.</li>
+ * </ol>
+ *
+ * @param jd_tt_high  [day] High-order part of the Terrestrial Time (TT) based Julian date.
+ *                    Typically it may be the integer part of a split date for the highest
+ *                    precision, or the full date for normal (reduced) precision.
+ * @param jd_tt_low   [day] Low-order part of the Terrestrial Time (TT) based Julian date.
+ *                    Typically it may be the fractional part of a split date for the highest
+ *                    precision, or 0.0 for normal (reduced) precision.
+ * @param[out] dpsi   [rad] &delta;&psi; Nutation (luni-solar) in longitude, It may be NULL if not
+ *                    required.
+ * @param[out] deps   [rad] &delta;&epsilon; Nutation (luni-solar) in obliquity. It may be NULL if
+ *                    not required.
+ * @return            0
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa iau2000b(), nu2000k(), nutation_angles(), set_nutation_lp_provider(), NOVAS_FAST_ACCURACY
+ */
+int novas_nutation_fast(double jd_tt_high, double jd_tt_low, double *restrict dpsi, double *restrict deps) {
+  prop_error("novas_nutation_fast", iau2006_fp(jd_tt_high, jd_tt_low, 13, 1, 9, 1, dpsi, deps), 0);
+  return 0;
+}
+
 #if __cplusplus
 #  ifdef NOVAS_NAMESPACE
 } // namespace novas
@@ -915,7 +915,7 @@ int obs_planets(double jd_tdb, enum novas_accuracy accuracy, const double *restr
 int light_time2(double jd_tdb, const object *restrict body, const double *restrict pos_obs, double tlight0,
         enum novas_accuracy accuracy, double *p_src_obs, double *restrict v_ssb, double *restrict tlight) {
   static const char *fn = "light_time2";
-  int iter = 0;
+  int iter = 0, error = 0;
 
   double tol, jd[2] = {0};
 
@@ -943,24 +943,37 @@ int light_time2(double jd_tdb, const object *restrict body, const double *restri
     jd[0] = jd_tdb;
   }
 
-  // Iterate to obtain correct light-time (usually converges rapidly).
-  for(iter = 0; iter < novas_inv_max_iter; iter++) {
-    int error;
-    double dt = 0.0;
+  {
+    PROFILE_START(t0);
 
-    error = ephemeris(jd, body, NOVAS_BARYCENTER, accuracy, p_src_obs, v_ssb);
-    bary2obs(p_src_obs, pos_obs, p_src_obs, tlight);
-    prop_error(fn, error, 10);
+    // Iterate to obtain correct light-time (usually converges rapidly).
+    for(iter = 0; iter < novas_inv_max_iter; iter++) {
+      double dt = 0.0;
 
-    dt = *tlight - tlight0;
-    if(fabs(dt) <= tol)
-      return 0;
+      PROFILE_ITERATION(NOVAS_LIGHT_TIME_ITERATIONS);
 
-    jd[1] -= dt;
-    tlight0 = *tlight;
+      error = ephemeris(jd, body, NOVAS_BARYCENTER, accuracy, p_src_obs, v_ssb);
+      bary2obs(p_src_obs, pos_obs, p_src_obs, tlight);
+      if(error)
+        break;
+
+      dt = *tlight - tlight0;
+      if(fabs(dt) <= tol)
+        break;
+
+      jd[1] -= dt;
+      tlight0 = *tlight;
+    }
+
+    PROFILE_STOP(NOVAS_PROFILE_LIGHT_TIME, t0, 1);
   }
 
-  return novas_error(1, ECANCELED, fn, "failed to converge");
+  prop_error(fn, error, 10);
+
+  if(iter >= novas_inv_max_iter)
+    return novas_error(1, ECANCELED, fn, "failed to converge");
+
+  return 0;
 }
 
 /**
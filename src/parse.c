@@ -1214,6 +1214,235 @@ enum novas_timescale novas_timescale_for_string(const char *restrict str) {
 }
 
 
+/// \cond PRIVATE
+#define MAX_FIELD_LEN     80          ///< Maximum length of table fields parsed via the generic parsers
+/// \endcond
+
+/**
+ * Fast path for parsing fixed-format sexagesimal fields, such as `hh:mm:ss.sss` or
+ * `&plusmn;dd mm ss.ss`, with colon or space separated components, an optional sign, 1 to 3 digit
+ * leading component, 2-digit minutes and seconds, and optional decimal seconds. Leading and
+ * trailing white spaces are ignored.
+ *
+ * @param from        Start of field.
+ * @param to          End of field (exclusive).
+ * @param[out] value  The parsed value (hours or degrees), if successful.
+ * @return            TRUE (1) if the field was parsed successfully, or else FALSE (0) if the field
+ *                    is not in the fixed format.
+ */
+static int parse_fixed_sexagesimal(const char *from, const char *to, double *value) {
+  static const double pow10[] = { 1.0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12 };
+
+  const char *s = from;
+  int neg = 0, d = 0, m, sec, nd = 0;
+  long frac = 0;
+  char sep;
+
+  while(s < to && (*s == ' ' || *s == '\t'))
+    s++;
+  while(to > s && (to[-1] == ' ' || to[-1] == '\t'))
+    to--;
+
+  if(s < to && (*s == '+' || *s == '-'))
+    neg = (*(s++) == '-');
+
+  // 1-3 digit leading component
+  if(s >= to || !isdigit((unsigned char) *s))
+    return 0;
+
+  for(nd = 0; s < to && nd < 4 && isdigit((unsigned char) *s); s++, nd++)
+    d = 10 * d + (*s - '0');
+
+  if(nd > 3 || to - s < 6)
+    return 0;
+
+  sep = *s;
+  if(sep != ':' && sep != ' ')
+    return 0;
+
+  if(!isdigit((unsigned char) s[1]) || !isdigit((unsigned char) s[2]) || s[3] != sep
+          || !isdigit((unsigned char) s[4]) || !isdigit((unsigned char) s[5]))
+    return 0;
+
+  m = 10 * (s[1] - '0') + (s[2] - '0');
+  sec = 10 * (s[4] - '0') + (s[5] - '0');
+  s += 6;
+
+  if(m >= 60 || sec >= 60)
+    return 0;
+
+  nd = 0;
+
+  if(s < to) {
+    if(*s != '.')
+      return 0;
+
+    for(s++; s < to && isdigit((unsigned char) *s); s++) {
+      if(nd < 12) {
+        frac = 10 * frac + (*s - '0');
+        nd++;
+      }
+    }
+
+    if(s != to)
+      return 0;
+  }
+
+  *value = d + m / 60.0 + (sec + frac / pow10[nd]) / 3600.0;
+  if(neg)
+    *value = -(*value);
+
+  return 1;
+}
+
+/**
+ * Parses a single table field as an angle, trying the fixed-format fast path first, and then
+ * the generic parser if needed.
+ */
+static double parse_table_angle(const char *from, const char *to, int hours) {
+  char field[MAX_FIELD_LEN];
+  double value;
+  size_t len;
+
+  if(parse_fixed_sexagesimal(from, to, &value))
+    return value;
+
+  len = to - from;
+  if(len >= MAX_FIELD_LEN)
+    return NAN;
+
+  memcpy(field, from, len);
+  field[len] = '\0';
+
+  return hours ? novas_str_hours(field) : novas_str_degrees(field);
+}
+
+/**
+ * Parses right ascension and declination columns from a buffer containing a table of delimited
+ * text rows (e.g. CSV), such as for ingesting large catalogs. Each row (line) is parsed in
+ * place, without copying or allocation. Fields in the common fixed sexagesimal formats, e.g.
+ * `hh:mm:ss.sss` and `&plusmn;dd:mm:ss.ss`, or space-separated, are parsed via a fast dedicated
+ * path. All other formats are parsed with novas_str_hours() and novas_str_degrees(),
+ * respectively, which accept a wide range of representations, including decimal values.
+ *
+ * Empty lines (or lines containing white spaces only), and lines starting with `#`, are
+ * skipped. Rows in which the RA or Dec field is missing or cannot be parsed are returned with NAN
+ * values for the unparseable fields.
+ *
+ * The function can be used in a streaming fashion: if `consumed` is not NULL, only complete
+ * (newline-terminated) lines are parsed, and `consumed` is set to the number of bytes processed.
+ * The caller may then move the remaining (incomplete) data to the front of the buffer, append
+ * more data, and call again. If `consumed` is NULL, the buffer is assumed to contain the entire
+ * table, and the last line is parsed also, even if it is not terminated by a newline.
+ *
+ * @param buf           Buffer containing rows of delimited text fields.
+ * @param len           [bytes] Number of bytes in the buffer to parse.
+ * @param delim         Field delimiter character, e.g. ',' or '|', or else 0 for fields
+ *                      separated by any number of white spaces (in which case the RA/Dec fields
+ *                      may not contain white spaces themselves).
+ * @param ra_col        (0-based) column index of the RA field, in hours (sexagesimal or decimal).
+ * @param dec_col       (0-based) column index of the Dec field, in degrees (sexagesimal or
+ *                      decimal).
+ * @param[out] ra       [h] Array to populate with right ascension values (NAN if unparseable).
+ * @param[out] dec      [deg] Array to populate with declination values (NAN if unparseable).
+ * @param n_max         Maximum number of rows to parse, i.e. the size of the output arrays.
+ * @param[out] consumed (optional) Set to the number of bytes parsed (i.e. up to the end of the
+ *                      last complete line processed), or NULL to parse the entire buffer.
+ * @return              The number of rows parsed, or else -1 if there was an error (errno will be
+ *                      set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_str_hours(), novas_str_degrees(), novas_parse_hms(), novas_parse_dms()
+ */
+int novas_parse_radec_table(const char *restrict buf, size_t len, char delim, int ra_col, int dec_col,
+        double *restrict ra, double *restrict dec, int n_max, size_t *restrict consumed) {
+  static const char *fn = "novas_parse_radec_table";
+
+  const char *line = buf, *end = buf + len;
+  int n = 0;
+
+  if(consumed)
+    *consumed = 0;
+
+  if(!buf && len > 0)
+    return novas_error(-1, EINVAL, fn, "input buffer is NULL");
+
+  if(!ra || !dec)
+    return novas_error(-1, EINVAL, fn, "NULL output: ra=%p, dec=%p", ra, dec);
+
+  if(ra_col < 0 || dec_col < 0 || ra_col == dec_col)
+    return novas_error(-1, EINVAL, fn, "invalid columns: ra_col=%d, dec_col=%d", ra_col, dec_col);
+
+  if(n_max < 0)
+    return novas_error(-1, EINVAL, fn, "invalid n_max: %d", n_max);
+
+  while(line < end && n < n_max) {
+    const char *eol = (const char *) memchr(line, '\n', end - line);
+    const char *next, *s, *t;
+    int col = 0, found = 0;
+
+    if(!eol) {
+      if(consumed)
+        break;          // Incomplete line; leave it for the next call
+      eol = end;
+      next = end;
+    }
+    else
+      next = eol + 1;
+
+    if(eol > line && eol[-1] == '\r')
+      eol--;
+
+    // Skip empty (or blank) lines and comments
+    for(t = line; t < eol && isspace((unsigned char) *t); t++);
+    if(t == eol || *line == '#') {
+      line = next;
+      continue;
+    }
+
+    ra[n] = dec[n] = NAN;
+
+    for(s = line; s <= eol && found < 2; col++) {
+      const char *f = s, *e;
+
+      if(!delim) {
+        // Skip leading white spaces, then field ends at next white space
+        while(f < eol && isspace((unsigned char) *f))
+          f++;
+        if(f >= eol)
+          break;
+        for(e = f; e < eol && !isspace((unsigned char) *e); e++);
+      }
+      else {
+        e = (const char *) memchr(f, delim, eol - f);
+        if(!e)
+          e = eol;
+      }
+
+      if(col == ra_col) {
+        ra[n] = parse_table_angle(f, e, 1);
+        found++;
+      }
+      else if(col == dec_col) {
+        dec[n] = parse_table_angle(f, e, 0);
+        found++;
+      }
+
+      s = e + 1;
+    }
+
+    n++;
+    line = next;
+  }
+
+  if(consumed)
+    *consumed = line - buf;
+
+  return n;
+}
+
 #if __cplusplus
 #  ifdef NOVAS_NAMESPACE
 } // namespace novas
@@ -0,0 +1,158 @@
+/**
+ * @file
+ *
+ *  Optional instrumentation of the hot paths of the library, for builds with the `NOVAS_PROFILE`
+ *  compile-time option (e.g. via the `ENABLE_PROFILE` CMake option, or `PROFILE_SUPPORT = 1` in
+ *  `config.mk`). Profiling builds keep per-thread counts and cumulative timers for the main
+ *  stages of the calculations (frame setup, ephemeris calls, light-time, gravitational deflection,
+ *  and refraction), iteration counts for iterative calculations, and the hits and misses of the
+ *  thread-local caches of functions like nutation_angles(). Applications may snapshot them via
+ *  novas_get_profile(), e.g. for exporting to a metrics system, and reset them via
+ *  novas_reset_profile().
+ *
+ *  Without `NOVAS_PROFILE` the instrumentation compiles to nothing, and so it does not affect
+ *  performance.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ */
+
+#if !defined(_MSC_VER) && !defined(_POSIX_C_SOURCE)
+#  define _POSIX_C_SOURCE 199309L   ///< clock_gettime()
+#endif
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+
+#ifdef NOVAS_PROFILE
+static THREAD_LOCAL novas_profile thread_profile;   ///< Counters and timers of the calling thread
+
+/**
+ * Returns a monotonic time, for measuring time intervals.
+ *
+ * @return    [ns] Monotonic time, with an arbitrary zero-point.
+ */
+int64_t novas_profile_clock(void) {
+  struct timespec t;
+
+#if defined(_MSC_VER)
+  timespec_get(&t, TIME_UTC);
+#else
+  clock_gettime(CLOCK_MONOTONIC, &t);
+#endif
+
+  return (int64_t) t.tv_sec * 1000000000L + t.tv_nsec;
+}
+
+/**
+ * Adds the time elapsed since a start time, and a number of calls, to a profiled stage.
+ *
+ * @param stage   The profiled stage
+ * @param t0      [ns] The start time, as returned by novas_profile_clock().
+ * @param n       The number of calls made since the start time.
+ */
+void novas_profile_stop(enum novas_profile_stage stage, int64_t t0, long n) {
+  thread_profile.calls[stage] += n;
+  thread_profile.nanos[stage] += novas_profile_clock() - t0;
+}
+
+/**
+ * Counts an iteration of an iterative calculation.
+ *
+ * @param type    The iterative calculation.
+ */
+void novas_profile_iteration(enum novas_profile_iteration type) {
+  thread_profile.iterations[type]++;
+}
+
+/**
+ * Counts a hit or miss of a thread-local cache.
+ *
+ * @param cache   The thread-local cache.
+ * @param hit     Whether the lookup found a cached value (boolean).
+ */
+void novas_profile_cache(enum novas_profile_cache cache, int hit) {
+  if(hit)
+    thread_profile.cache_hits[cache]++;
+  else
+    thread_profile.cache_misses[cache]++;
+}
+#endif
+
+/// \endcond
+
+/**
+ * Returns a snapshot of the instrumentation counters and timers of the calling thread, since the
+ * thread started or since they were last reset by novas_reset_profile(). It requires the library
+ * to be built with the `NOVAS_PROFILE` compile-time option. Each thread keeps its own counters,
+ * so applications that use multiple threads should collect (and sum, as appropriate) the
+ * snapshots from each thread.
+ *
+ * @param[out] profile  The snapshot to populate. It is zeroed if the library was built without
+ *                      `NOVAS_PROFILE`.
+ * @return              0 if successful, or else -1 if the argument is NULL (errno will be set to
+ *                      EINVAL), or if the library was built without `NOVAS_PROFILE` (errno will be
+ *                      set to ENOSYS).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_reset_profile()
+ */
+int novas_get_profile(novas_profile *profile) {
+  static const char *fn = "novas_get_profile";
+
+  if(!profile)
+    return novas_error(-1, EINVAL, fn, "NULL output profile");
+
+#ifdef NOVAS_PROFILE
+  *profile = thread_profile;
+  return 0;
+#else
+  memset(profile, 0, sizeof(*profile));
+  return novas_error(-1, ENOSYS, fn, "library was built without NOVAS_PROFILE");
+#endif
+}
+
+/**
+ * Resets the instrumentation counters and timers of the calling thread. It requires the library
+ * to be built with the `NOVAS_PROFILE` compile-time option.
+ *
+ * @return    0 if successful, or else -1 if the library was built without `NOVAS_PROFILE` (errno
+ *            will be set to ENOSYS).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_get_profile()
+ */
+int novas_reset_profile(void) {
+#ifdef NOVAS_PROFILE
+  memset(&thread_profile, 0, sizeof(thread_profile));
+  return 0;
+#else
+  return novas_error(-1, ENOSYS, "novas_reset_profile", "library was built without NOVAS_PROFILE");
+#endif
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
@@ -232,7 +232,13 @@ double novas_inv_refract(RefractionModel model, double jd_tt, const on_surface *
 
   for(i = 0; i < novas_inv_max_iter; i++) {
     double el1 = el0 + dir * refr;
+    PROFILE_START(t0);
+
+    PROFILE_ITERATION(NOVAS_INV_REFRACT_ITERATIONS);
+
     refr = model(jd_tt, loc, type, el1);
+    PROFILE_STOP(NOVAS_PROFILE_REFRACTION, t0, 1);
+
     if(errno)
       return novas_trace_nan(fn);
 
@@ -0,0 +1,201 @@
+/**
+ * @file
+ *
+ *  Runtime selection of SIMD instruction sets for the vectorized batch-processing kernels of the
+ *  library, such as the rotation of many source directions into the local horizontal system
+ *  (novas_hor_grid() and novas_hor_positions_f32()), the evaluation of field-local transforms
+ *  (novas_field_apply_offsets()), or the rotation of arrays of vectors with a coordinate transform
+ *  (novas_transform_vectors()).
+ *
+ *  The kernels are written as plain loops, which compilers can vectorize. On x86 CPUs (with GCC
+ *  or clang), each kernel is built in several variants, for SSE2, AVX2, and AVX-512 in addition
+ *  to a scalar fallback, and the best variant the CPU supports is selected when a kernel is first
+ *  used, based on `cpuid`. This way, a single library binary, built for a generic x86 target
+ *  (e.g. for a Linux distribution), can run optimally on a range of CPUs, without having to be
+ *  compiled with `-march=native`.
+ *
+ *  The selected level may be overridden via the `SUPERNOVAS_SIMD` environment variable (e.g.
+ *  for testing), or programmatically via novas_set_simd().
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa grid.c, field.c, frames.c
+ */
+
+#include <stdlib.h>
+#include <ctype.h>
+#include <errno.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#ifdef SUPERNOVAS_USE_PTHREAD
+#  include <pthread.h>
+#endif
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+
+/// Names of the SIMD levels, as they may be set in the NOVAS_SIMD_ENV environment variable.
+static const char *simd_names[NOVAS_SIMD_LEVELS] = { "scalar", "sse2", "avx2", "avx512" };
+
+static enum novas_simd simd_max = NOVAS_SIMD_SCALAR;   ///< Highest level supported by the CPU
+static enum novas_simd simd_level = NOVAS_SIMD_SCALAR; ///< Currently selected level
+
+#ifdef SUPERNOVAS_USE_PTHREAD
+static pthread_once_t simd_once = PTHREAD_ONCE_INIT;
+#else
+static int simd_initialized;
+#endif
+
+/**
+ * Returns the highest SIMD level, which is supported by both the CPU and the build.
+ */
+static enum novas_simd simd_detect(void) {
+#if SIMD_X86
+  __builtin_cpu_init();
+
+  if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+    return NOVAS_SIMD_AVX512;
+  if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return NOVAS_SIMD_AVX2;
+  if(__builtin_cpu_supports("sse2"))
+    return NOVAS_SIMD_SSE2;
+#endif
+
+  return NOVAS_SIMD_SCALAR;
+}
+
+/**
+ * Case-insensitive comparison of a string to a lower-case name.
+ */
+static int simd_matches(const char *str, const char *name) {
+  for(; *str && *name; str++, name++)
+    if(tolower((unsigned char) *str) != *name)
+      return 0;
+
+  return *str == *name;
+}
+
+/**
+ * Detects the SIMD capabilities of the CPU, and selects the best SIMD level, unless overridden
+ * by the NOVAS_SIMD_ENV environment variable. Unrecognized environment values are ignored.
+ */
+static void simd_init(void) {
+  const char *env = getenv(NOVAS_SIMD_ENV);
+  enum novas_simd level;
+
+  simd_max = level = simd_detect();
+
+  if(env) {
+    int i;
+
+    for(i = 0; i < NOVAS_SIMD_LEVELS; i++) {
+      if(simd_matches(env, simd_names[i])) {
+        if(i <= (int) simd_max)
+          level = (enum novas_simd) i;
+        break;
+      }
+    }
+  }
+
+  simd_level = level;
+
+#ifndef SUPERNOVAS_USE_PTHREAD
+  simd_initialized = 1;
+#endif
+}
+
+/**
+ * Makes sure the SIMD level has been selected.
+ */
+static void simd_check_init(void) {
+#ifdef SUPERNOVAS_USE_PTHREAD
+  pthread_once(&simd_once, simd_init);
+#else
+  if(!simd_initialized)
+    simd_init();
+#endif
+}
+
+/// \endcond
+
+/**
+ * Returns the highest SIMD instruction set level, which is supported by both the CPU and the
+ * library build.
+ *
+ * @return    The highest SIMD level available for the vectorized kernels of the library.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_get_simd(), novas_set_simd()
+ */
+enum novas_simd novas_max_simd(void) {
+  simd_check_init();
+  return simd_max;
+}
+
+/**
+ * Returns the SIMD instruction set level, which is currently used by the vectorized kernels of
+ * the library. By default, it is the highest level supported by the CPU (see novas_max_simd()),
+ * unless a lower level was selected via the `SUPERNOVAS_SIMD` environment variable (see
+ * NOVAS_SIMD_ENV), or else by novas_set_simd().
+ *
+ * @return    The SIMD level currently used by the vectorized kernels of the library.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_set_simd(), novas_max_simd(), NOVAS_SIMD_ENV
+ */
+enum novas_simd novas_get_simd(void) {
+  simd_check_init();
+  return simd_level;
+}
+
+/**
+ * Selects the SIMD instruction set level, to use for the vectorized kernels of the library, e.g.
+ * for testing or for comparing the performance of the different levels. The setting is global
+ * (not thread-local), and you should change it only when no other threads are making calls to the
+ * library.
+ *
+ * @param level   The SIMD level to use. It cannot exceed the level returned by novas_max_simd().
+ * @return        0 if successful, or else -1 if the level is invalid or not supported by the CPU
+ *                or the build (errno will be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_get_simd(), novas_max_simd()
+ */
+int novas_set_simd(enum novas_simd level) {
+  static const char *fn = "novas_set_simd";
+
+  simd_check_init();
+
+  if(level < 0 || level >= NOVAS_SIMD_LEVELS)
+    return novas_error(-1, EINVAL, fn, "invalid SIMD level: %d", level);
+
+  if(level > simd_max)
+    return novas_error(-1, EINVAL, fn, "SIMD level %s is not supported (max: %s)", simd_names[level], simd_names[simd_max]);
+
+  simd_level = level;
+  return 0;
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
@@ -0,0 +1,575 @@
+/**
+ * @file
+ *
+ *  A hierarchical index of catalog sources on the sky, based on the Hierarchical Triangular Mesh
+ *  (HTM) of Szalay et al. (2007). The sky is divided into 8 spherical triangles (octants), each of
+ *  which is recursively divided into 4 smaller triangles, down to the chosen depth of the index.
+ *  Sources are sorted by the leaf triangle (cell) in which they lie, so that the sources in any
+ *  cell, at any level, occupy a contiguous range in the index.
+ *
+ *  Queries select all sources inside a circular region (cone), by descending into the mesh only
+ *  where a cell straddles the boundary of the region. Frame-based queries map the region of
+ *  interest (e.g. above some elevation, or near some apparent position) back to an ICRS cone,
+ *  widened by an appropriate margin for aberration, gravitational deflection, and the proper
+ *  motion and parallax of the sources, such that only the returned candidates need to be reduced
+ *  fully, e.g. with novas_sky_pos().
+ *
+ *  REFERENCES:
+ *  <ol>
+ *  <li>Szalay, A. S., et al. 2007, Microsoft Research Technical Report, MSR-TR-2005-123,
+ *      arXiv:cs/0701164</li>
+ *  </ol>
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa grid.c, frames.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+#define SKY_INDEX_MARGIN    (30.0 * ARCSEC)   ///< [rad] Aberration (incl. diurnal) and deflection away from Sun's limb
+/// \endcond
+
+/// Vertices of the HTM octahedron
+static const double htm_v[6][3] = { { 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, //
+        { -1.0, 0.0, 0.0 }, { 0.0, -1.0, 0.0 }, { 0.0, 0.0, -1.0 } };
+
+/// Vertex indices of the 8 top-level HTM triangles: S0-S3, N0-N3 (counter-clockwise)
+static const int htm_base[8][3] = { { 1, 5, 2 }, { 2, 5, 3 }, { 3, 5, 4 }, { 4, 5, 1 }, //
+        { 1, 0, 4 }, { 4, 0, 3 }, { 3, 0, 2 }, { 2, 0, 1 } };
+
+/**
+ * Query state, for the recursive traversal of the mesh.
+ */
+typedef struct {
+  const novas_sky_index *index; ///< the sky index
+  double dir[3];                ///< unit vector to the center of the query cone
+  double radius;                ///< [rad] radius of the query cone
+  double cos_r;                 ///< cosine of the query radius
+  int *src;                     ///< output catalog indices, or NULL
+  int n_max;                    ///< maximum number of indices to return
+  int n;                        ///< number of sources found so far
+} sky_query;
+
+static void htm_norm(double *v) {
+  const double l = novas_vlen(v);
+  v[0] /= l;
+  v[1] /= l;
+  v[2] /= l;
+}
+
+static void htm_mid(const double *a, const double *b, double *m) {
+  int k;
+  for(k = 3; --k >= 0;)
+    m[k] = a[k] + b[k];
+  htm_norm(m);
+}
+
+static double htm_edge(const double *a, const double *b, const double *p) {
+  // (a x b) . p
+  return (a[1] * b[2] - a[2] * b[1]) * p[0] + (a[2] * b[0] - a[0] * b[2]) * p[1] + (a[0] * b[1] - a[1] * b[0]) * p[2];
+}
+
+/**
+ * Returns the vertices of the i-th child of an HTM triangle.
+ */
+static void htm_child(const double (*v)[3], int i, double (*c)[3]) {
+  double w[3][3];
+
+  htm_mid(v[1], v[2], w[0]);
+  htm_mid(v[0], v[2], w[1]);
+  htm_mid(v[0], v[1], w[2]);
+
+  switch(i) {
+    case 0:
+      memcpy(c[0], v[0], sizeof(c[0]));
+      memcpy(c[1], w[2], sizeof(c[1]));
+      memcpy(c[2], w[1], sizeof(c[2]));
+      break;
+    case 1:
+      memcpy(c[0], v[1], sizeof(c[0]));
+      memcpy(c[1], w[0], sizeof(c[1]));
+      memcpy(c[2], w[2], sizeof(c[2]));
+      break;
+    case 2:
+      memcpy(c[0], v[2], sizeof(c[0]));
+      memcpy(c[1], w[1], sizeof(c[1]));
+      memcpy(c[2], w[0], sizeof(c[2]));
+      break;
+    default:
+      memcpy(c, w, sizeof(w));
+  }
+}
+
+/**
+ * Returns the leaf cell ID (0-based) at the given depth, for a unit vector.
+ */
+static long htm_id(const double *p, int level) {
+  double v[3][3];
+  long id;
+  int b, l;
+
+  // The octant
+  if(p[2] >= 0.0)
+    b = (p[0] >= 0.0) ? (p[1] >= 0.0 ? 7 : 4) : (p[1] >= 0.0 ? 6 : 5);
+  else
+    b = (p[0] >= 0.0) ? (p[1] >= 0.0 ? 0 : 3) : (p[1] >= 0.0 ? 1 : 2);
+
+  for(l = 3; --l >= 0;)
+    memcpy(v[l], htm_v[htm_base[b][l]], sizeof(v[l]));
+
+  id = b;
+
+  for(l = 0; l < level; l++) {
+    double w[3][3];
+    int i;
+
+    htm_mid(v[1], v[2], w[0]);
+    htm_mid(v[0], v[2], w[1]);
+    htm_mid(v[0], v[1], w[2]);
+
+    // Corner children are on the inner side of the edge opposite their corner; or else the center.
+    if(htm_edge(w[2], w[1], p) >= 0.0)
+      i = 0;
+    else if(htm_edge(w[0], w[2], p) >= 0.0)
+      i = 1;
+    else if(htm_edge(w[1], w[0], p) >= 0.0)
+      i = 2;
+    else
+      i = 3;
+
+    htm_child((const double (*)[3]) v, i, w);
+    memcpy(v, w, sizeof(v));
+    id = (id << 2) | i;
+  }
+
+  return id;
+}
+
+/**
+ * Adds all sources from a contiguous range of leaf cells to the query results.
+ */
+static void sky_query_add_cells(sky_query *q, long from, long to) {
+  const novas_sky_index *index = q->index;
+  int i;
+
+  for(i = index->cell[from]; i < index->cell[to]; i++) {
+    if(q->src && q->n < q->n_max)
+      q->src[q->n] = index->src[i];
+    q->n++;
+  }
+}
+
+/**
+ * Adds the sources from a leaf cell that are inside the query cone.
+ */
+static void sky_query_test_cell(sky_query *q, long id) {
+  const novas_sky_index *index = q->index;
+  int i;
+
+  for(i = index->cell[id]; i < index->cell[id + 1]; i++) {
+    const double *p = &index->dirs[3 * i];
+    if(novas_vdot(p, q->dir) >= q->cos_r) {
+      if(q->src && q->n < q->n_max)
+        q->src[q->n] = index->src[i];
+      q->n++;
+    }
+  }
+}
+
+/**
+ * Recursively adds sources from an HTM triangle and its children that are inside the query cone.
+ */
+static void sky_query_node(sky_query *q, const double (*v)[3], long id, int level) {
+  const int depth = q->index->level - level;
+  double c[3], r, d;
+  int i;
+
+  // Bounding circle of the triangle
+  for(i = 3; --i >= 0;)
+    c[i] = v[0][i] + v[1][i] + v[2][i];
+  htm_norm(c);
+
+  r = novas_vdot(c, v[0]);
+  for(i = 1; i < 3; i++) {
+    double x = novas_vdot(c, v[i]);
+    if(x < r)
+      r = x;
+  }
+  r = acos(r > 1.0 ? 1.0 : r);
+
+  d = novas_vdot(c, q->dir);
+  d = acos(d > 1.0 ? 1.0 : (d < -1.0 ? -1.0 : d));
+
+  if(d - r > q->radius)
+    return;         // Entirely outside
+
+  if(d + r <= q->radius) {
+    // Entirely inside
+    sky_query_add_cells(q, id << (2 * depth), (id + 1) << (2 * depth));
+    return;
+  }
+
+  if(depth == 0) {
+    sky_query_test_cell(q, id);
+    return;
+  }
+
+  for(i = 0; i < 4; i++) {
+    double w[3][3];
+    htm_child(v, i, w);
+    sky_query_node(q, (const double (*)[3]) w, (id << 2) | i, level + 1);
+  }
+}
+
+static int sky_query_run(sky_query *q) {
+  int b;
+
+  for(b = 0; b < 8; b++) {
+    double v[3][3];
+    int l;
+
+    for(l = 3; --l >= 0;)
+      memcpy(v[l], htm_v[htm_base[b][l]], sizeof(v[l]));
+
+    sky_query_node(q, (const double (*)[3]) v, b, 0);
+  }
+
+  return q->n;
+}
+
+/**
+ * Returns the widening of query regions [rad] needed to account for aberration, deflection,
+ * as well as the proper motion and parallax of the sources, at the time of the observing frame.
+ */
+static double sky_index_margin(const novas_sky_index *index, const novas_frame *frame) {
+  double yrs = fabs(frame->time.ijd_tt + frame->time.fjd_tt - JD_J2000) / JULIAN_YEAR_DAYS;
+  return SKY_INDEX_MARGIN + (index->pm_max * yrs + index->plx_max) * MAS;
+}
+
+static int sky_index_check(const char *fn, const novas_sky_index *index, const int *src, int n_max) {
+  if(!index)
+    return novas_error(-1, EINVAL, fn, "input index is NULL");
+
+  if(!index->cell || (index->n > 0 && (!index->dirs || !index->src)))
+    return novas_error(-1, EINVAL, fn, "index is not initialized");
+
+  if(n_max < 0)
+    return novas_error(-1, EINVAL, fn, "invalid n_max: %d", n_max);
+
+  if(!src && n_max > 0)
+    return novas_error(-1, EINVAL, fn, "output src is NULL (with n_max = %d)", n_max);
+
+  return 0;
+}
+
+/**
+ * Builds a hierarchical (HTM) sky index for the sources in a catalog, which can then be used to
+ * quickly select the sources inside a region of the sky, such as all sources above some
+ * elevation at some time of observation, or all sources near an apparent position. The index
+ * should be destroyed with novas_free_sky_index() after it is no longer needed.
+ *
+ * The index stores the ICRS directions of the sources at their catalog epoch (J2000). Queries
+ * relative to an observing frame account for the proper motion and parallax of the sources
+ * conservatively, based on the largest values found in the catalog. Hence, including a few
+ * sources with very large proper motions will widen all time-dependent queries somewhat.
+ *
+ * A good choice for the depth of the index is a level at which there are a few sources per leaf
+ * cell on average, e.g. level 6 (about 1.1&deg; cells) for about 100,000 sources.
+ *
+ * @param catalog     Array of ICRS catalog entries (e.g. after transform_cat() if need be).
+ * @param n           Number of catalog entries.
+ * @param level       [0:NOVAS_SKY_INDEX_MAX_LEVEL] Depth of the index, with 8 &times;
+ *                    4<sup>level</sup> leaf cells, each about 90&deg; / 2<sup>level</sup> in
+ *                    size.
+ * @param[out] index  Sky index to populate. It should not hold a previously built index, or
+ *                    else the memory of that index is leaked.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_free_sky_index(), novas_sky_index_above(), novas_sky_index_near(),
+ *     novas_sky_index_cone()
+ */
+int novas_make_sky_index(const cat_entry *catalog, int n, int level, novas_sky_index *index) {
+  static const char *fn = "novas_make_sky_index";
+
+  novas_sky_index idx = NOVAS_SKY_INDEX_INIT;
+  long *ids, ncells, c;
+  int i;
+
+  if(!index)
+    return novas_error(-1, EINVAL, fn, "output index is NULL");
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid number of catalog entries: %d", n);
+
+  if(!catalog && n > 0)
+    return novas_error(-1, EINVAL, fn, "input catalog is NULL");
+
+  if(level < 0 || level > NOVAS_SKY_INDEX_MAX_LEVEL)
+    return novas_error(-1, EINVAL, fn, "invalid level: %d (expected 0 to %d)", level, NOVAS_SKY_INDEX_MAX_LEVEL);
+
+  ncells = 8L << (2 * level);
+
+  idx.level = level;
+  idx.n = n;
+  idx.cell = (int *) calloc(ncells + 1, sizeof(int));
+  idx.dirs = (double *) calloc(n > 0 ? 3 * n : 1, sizeof(double));
+  idx.src = (int *) calloc(n > 0 ? n : 1, sizeof(int));
+  ids = (long *) calloc(n > 0 ? n : 1, sizeof(long));
+
+  if(!idx.cell || !idx.dirs || !idx.src || !ids) {
+    free(ids);
+    novas_free_sky_index(&idx);
+    return novas_error(-1, ENOMEM, fn, "could not allocate index for %d sources at level %d", n, level);
+  }
+
+  // Leaf cell of each source, and the number of sources in each cell
+  for(i = 0; i < n; i++) {
+    const cat_entry *s = &catalog[i];
+    double p[3], pm = hypot(s->promora, s->promodec);
+
+    radec2vector(s->ra, s->dec, 1.0, p);
+    ids[i] = htm_id(p, level);
+    idx.cell[ids[i] + 1]++;
+
+    if(pm > idx.pm_max)
+      idx.pm_max = pm;
+    if(s->parallax > idx.plx_max)
+      idx.plx_max = s->parallax;
+  }
+
+  for(c = 0; c < ncells; c++)
+    idx.cell[c + 1] += idx.cell[c];
+
+  // Counting sort by cell (stable, i.e. catalog order within cells)
+  for(i = 0; i < n; i++) {
+    const int k = idx.cell[ids[i]]++;
+    radec2vector(catalog[i].ra, catalog[i].dec, 1.0, &idx.dirs[3 * k]);
+    idx.src[k] = i;
+  }
+
+  // Shift cell starts back into place
+  for(c = ncells; c > 0; c--)
+    idx.cell[c] = idx.cell[c - 1];
+  idx.cell[0] = 0;
+
+  free(ids);
+
+  *index = idx;
+  return 0;
+}
+
+/**
+ * Releases the memory used by a sky index, and resets it to an empty index.
+ *
+ * @param index   The sky index, previously built with novas_make_sky_index(). It may be NULL.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_sky_index()
+ */
+void novas_free_sky_index(novas_sky_index *index) {
+  if(!index)
+    return;
+
+  free(index->dirs);
+  free(index->src);
+  free(index->cell);
+
+  memset(index, 0, sizeof(*index));
+}
+
+/**
+ * Returns the catalog indices of all sources, in a sky index, whose ICRS catalog direction lies
+ * within a given angular distance of an ICRS direction.
+ *
+ * The catalog indices are returned in the order of the index cells, and not in the order of the
+ * catalog. The return value is the total number of sources found, which may exceed the size of
+ * the output array, in which case only the first `n_max` are returned.
+ *
+ * @param index       The sky index, built by novas_make_sky_index().
+ * @param dir         ICRS direction (need not be normalized) of the center of the query region.
+ * @param radius      [deg] Angular radius of the query region [0:180].
+ * @param[out] src    Array to populate with the (0-based) catalog indices of the matching
+ *                    sources. It may be NULL if `n_max` is 0.
+ * @param n_max       Maximum number of catalog indices to return.
+ * @return            The number of sources found (which may be larger than `n_max`), or else -1
+ *                    if there was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_sky_index_above(), novas_sky_index_near(), novas_make_sky_index()
+ */
+int novas_sky_index_cone(const novas_sky_index *restrict index, const double *restrict dir, double radius,
+        int *restrict src, int n_max) {
+  static const char *fn = "novas_sky_index_cone";
+
+  sky_query q;
+  double l;
+
+  prop_error(fn, sky_index_check(fn, index, src, n_max), 0);
+
+  if(!dir)
+    return novas_error(-1, EINVAL, fn, "input direction is NULL");
+
+  if(!(radius >= 0.0))
+    return novas_error(-1, EINVAL, fn, "invalid radius: %g", radius);
+
+  l = novas_vlen(dir);
+  if(l == 0.0)
+    return novas_error(-1, EINVAL, fn, "input direction is a null vector");
+
+  memset(&q, 0, sizeof(q));
+  q.index = index;
+  q.dir[0] = dir[0] / l;
+  q.dir[1] = dir[1] / l;
+  q.dir[2] = dir[2] / l;
+  q.radius = radius >= 180.0 ? M_PI : radius * DEGREE;
+  q.cos_r = cos(q.radius);
+  q.src = src;
+  q.n_max = n_max;
+
+  return sky_query_run(&q);
+}
+
+/**
+ * Returns the catalog indices of all candidate sources, in a sky index, which may be above a
+ * given (unrefracted) elevation angle, in an observing frame for an Earth-bound observer. The
+ * selection is conservative: the query region is widened to account for aberration,
+ * gravitational deflection (except near the Sun's limb), and the proper motion and parallax of
+ * the sources since J2000. As such, all sources above the given elevation are returned, along
+ * with some just below it. The precise positions of the candidates may then be calculated via
+ * novas_sky_pos() and novas_app_to_hor(), for example.
+ *
+ * To account for refraction, you may lower the elevation limit by the refraction at that
+ * elevation, e.g. by about 0.6&deg; for selecting sources above the (observed) horizon.
+ *
+ * @param index       The sky index, built by novas_make_sky_index().
+ * @param frame       Observing frame for an Earth-bound observer.
+ * @param el          [deg] (Unrefracted) elevation angle above which to select sources.
+ * @param[out] src    Array to populate with the (0-based) catalog indices of the candidate
+ *                    sources. It may be NULL if `n_max` is 0.
+ * @param n_max       Maximum number of catalog indices to return.
+ * @return            The number of candidate sources found (which may be larger than `n_max`),
+ *                    or else -1 if there was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_sky_index_near(), novas_sky_index_cone(), novas_hor_grid()
+ */
+int novas_sky_index_above(const novas_sky_index *restrict index, const novas_frame *restrict frame, double el,
+        int *restrict src, int n_max) {
+  static const char *fn = "novas_sky_index_above";
+
+  const on_surface *loc;
+  novas_transform T;
+  double up[3], enu[3] = { 0.0, 0.0, 1.0 }, r;
+
+  prop_error(fn, sky_index_check(fn, index, src, n_max), 0);
+
+  if(!frame)
+    return novas_error(-1, EINVAL, fn, "input frame is NULL");
+
+  if(!novas_frame_is_initialized(frame))
+    return novas_error(-1, EINVAL, fn, "frame not initialized");
+
+  if(frame->observer.where != NOVAS_OBSERVER_ON_EARTH && frame->observer.where != NOVAS_AIRBORNE_OBSERVER)
+    return novas_error(-1, EINVAL, fn, "observer not on Earth: where=%d", frame->observer.where);
+
+  if(isnan(el))
+    return novas_error(-1, EINVAL, fn, "input elevation is NaN");
+
+  // The local zenith, in ICRS (GCRS)
+  loc = &frame->observer.on_surf;
+  novas_enu_to_itrs(enu, loc->longitude, loc->latitude, up);
+  prop_error(fn, novas_make_transform(frame, NOVAS_ITRS, NOVAS_GCRS, &T), 0);
+  prop_error(fn, novas_transform_vector(up, &T, up), 0);
+
+  r = 90.0 - el + sky_index_margin(index, frame) / DEGREE;
+  if(r < 0.0)
+    return 0;
+
+  return novas_sky_index_cone(index, up, r, src, n_max);
+}
+
+/**
+ * Returns the catalog indices of all candidate sources, in a sky index, which may be within some
+ * angular distance of an apparent position, in an observing frame. The selection is
+ * conservative: the query region is widened to account for aberration, gravitational deflection
+ * (except near the Sun's limb), and the proper motion and parallax of the sources since J2000. As
+ * such, all sources within the given distance are returned, along with some just outside of it.
+ * The precise positions of the candidates may then be calculated via novas_sky_pos(), for
+ * example.
+ *
+ * @param index       The sky index, built by novas_make_sky_index().
+ * @param frame       Observing frame.
+ * @param sys         The coordinate reference system in which the apparent position is given.
+ * @param ra          [h] Apparent right ascension of the center of the query region.
+ * @param dec         [deg] Apparent declination of the center of the query region.
+ * @param radius      [deg] Angular radius of the query region.
+ * @param[out] src    Array to populate with the (0-based) catalog indices of the candidate
+ *                    sources. It may be NULL if `n_max` is 0.
+ * @param n_max       Maximum number of catalog indices to return.
+ * @return            The number of candidate sources found (which may be larger than `n_max`),
+ *                    or else -1 if there was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_sky_index_above(), novas_sky_index_cone(), novas_sky_pos()
+ */
+int novas_sky_index_near(const novas_sky_index *restrict index, const novas_frame *restrict frame,
+        enum novas_reference_system sys, double ra, double dec, double radius, int *restrict src, int n_max) {
+  static const char *fn = "novas_sky_index_near";
+
+  novas_transform T;
+  double p[3];
+
+  prop_error(fn, sky_index_check(fn, index, src, n_max), 0);
+
+  if(!frame)
+    return novas_error(-1, EINVAL, fn, "input frame is NULL");
+
+  if(!novas_frame_is_initialized(frame))
+    return novas_error(-1, EINVAL, fn, "frame not initialized");
+
+  if(!(radius >= 0.0))
+    return novas_error(-1, EINVAL, fn, "invalid radius: %g", radius);
+
+  prop_error(fn, radec2vector(ra, dec, 1.0, p), 0);
+  prop_error(fn, novas_make_transform(frame, sys, NOVAS_ICRS, &T), 0);
+  prop_error(fn, novas_transform_vector(p, &T, p), 0);
+
+  return novas_sky_index_cone(index, p, radius + sky_index_margin(index, frame) / DEGREE, src, n_max);
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
@@ -30,8 +30,6 @@
 /// \cond PRIVATE
 #define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
 #include "novas.h"
-
-#define T0        NOVAS_JD_J2000
 /// \endcond
 
 #if __cplusplus
@@ -197,7 +195,7 @@ short earth_sun_calc(double jd_tdb, enum novas_planet body, enum novas_origin or
 
       sun_eph(qjd, &ras, &decs, &diss);
       radec2vector(ras, decs, diss, position);
-      precession(qjd, position, T0, position);
+      precession(qjd, position, JD_J2000, position);
 
       p[i][0] = -position[0];
       p[i][1] = -position[1];
@@ -231,7 +229,7 @@ short earth_sun_calc(double jd_tdb, enum novas_planet body, enum novas_origin or
 
         // Compute mean longitude, mean anomaly, and eccentric anomaly.
         const double e = pe[i];
-        const double mlon = pl[i] + pn[i] * (jd_tdb - T0);
+        const double mlon = pl[i] + pn[i] * (jd_tdb - JD_J2000);
         const double ma = remainder((mlon - pw[i]), TWOPI);
         const double u = ma + e * sin(ma) + 0.5 * e * e * sin(2.0 * ma);
         const double sinu = sin(u);
@@ -412,7 +410,7 @@ int sun_eph(double jd, double *restrict ra, double *restrict dec, double *restri
 
   // Define the time units 'u', measured in units of 10000 Julian years
   // from J2000.0, and 't', measured in Julian centuries from J2000.0.
-  u = (jd - T0) / 3652500.0;
+  u = (jd - JD_J2000) / 3652500.0;
   t = u * 100.0;
 
   // Compute longitude and distance terms from the series.
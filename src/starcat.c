@@ -0,0 +1,440 @@
+/**
+ * @file
+ *
+ *  A compact binary catalog format for precomputed star vectors, i.e. the barycentric ICRS
+ *  position and motion vectors calculated by starvectors() from catalog entries. These can be
+ *  used directly, for any number of observing frames, without repeating the conversion from
+ *  catalog coordinates (several trigonometric functions and unit conversions per star) every
+ *  time.
+ *
+ *  The binary file consists of a 64-byte header, followed by the array of star vectors, and
+ *  optionally an array of matching metadata (names and catalog designations), all in the native
+ *  binary representation of the platform that wrote them. As such, the arrays can be mapped into
+ *  memory (mmap) and used as is, without any copying or parsing. Files are not portable between
+ *  platforms with different byte order or structure layouts, which is detected when opening.
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa target.c, frames.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__unix__) || defined(__unix) || defined(__APPLE__)
+#  define STARCAT_USE_MMAP    1     ///< Whether to map catalog files into memory
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+#define STARCAT_MAGIC       "NOVASSV"     ///< File identifier (with terminating '\0')
+#define STARCAT_VERSION     1             ///< File format version
+#define STARCAT_BYTE_ORDER  0x01020304    ///< Byte order marker
+
+/**
+ * Header of binary star vector catalog files.
+ */
+typedef struct {
+  char magic[8];          ///< STARCAT_MAGIC
+  uint32_t version;       ///< STARCAT_VERSION
+  uint32_t byte_order;    ///< STARCAT_BYTE_ORDER, as written on the platform
+  uint32_t vec_size;      ///< sizeof(novas_star_vec) on the platform
+  uint32_t meta_size;     ///< sizeof(novas_star_meta) on the platform, or 0 if no metadata
+  uint64_t n;             ///< Number of stars
+  char reserved[32];      ///< (unused)
+} starcat_header;
+/// \endcond
+
+/**
+ * Calculates the star vectors (barycentric ICRS position and motion) for a catalog entry, which
+ * can be used with novas_star_vec_sky_pos() for any number of observing frames.
+ *
+ * @param star      ICRS catalog entry (e.g. after transform_cat() if need be).
+ * @param[out] vec  Star vectors to populate.
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_star_vec_sky_pos(), novas_write_star_catalog(), starvectors()
+ */
+int novas_make_star_vec(const cat_entry *restrict star, novas_star_vec *restrict vec) {
+  static const char *fn = "novas_make_star_vec";
+
+  if(!star || !vec)
+    return novas_error(-1, EINVAL, fn, "NULL argument: star=%p, vec=%p", star, vec);
+
+  prop_error(fn, starvectors(star, vec->pos, vec->vel), 0);
+  return 0;
+}
+
+/**
+ * Calculates the geometric position of a star, relative to the observer, from its precomputed
+ * star vectors. It is the equivalent of novas_geom_posvel() for catalog sources (position
+ * only), without the need to convert catalog coordinates to vectors.
+ *
+ * @param vec       Precomputed star vectors, e.g. from novas_make_star_vec() or from a binary
+ *                  catalog opened with novas_open_star_catalog().
+ * @param frame     The observer frame, defining the location and time of observation.
+ * @param sys       The coordinate system in which to return the position.
+ * @param[out] pos  [AU] Geometric position of the star relative to the observer, in the
+ *                  requested coordinate system.
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_star_vec_sky_pos(), novas_geom_posvel()
+ */
+int novas_star_vec_geom_pos(const novas_star_vec *restrict vec, const novas_frame *restrict frame,
+        enum novas_reference_system sys, double *restrict pos) {
+  static const char *fn = "novas_star_vec_geom_pos";
+
+  double jd_tdb, p[3];
+
+  if(!vec || !frame || !pos)
+    return novas_error(-1, EINVAL, fn, "NULL argument: vec=%p, frame=%p, pos=%p", vec, frame, pos);
+
+  if(!novas_frame_is_initialized(frame))
+    return novas_error(-1, EINVAL, fn, "frame at %p not initialized", frame);
+
+  jd_tdb = novas_get_time(&frame->time, NOVAS_TDB);
+
+  // Same as for catalog sources in novas_geom_posvel()
+  proper_motion(NOVAS_JD_J2000, vec->pos, vec->vel, jd_tdb + d_light(vec->pos, frame->obs_pos), p);
+  bary2obs(p, frame->obs_pos, p, NULL);
+
+  if(sys != NOVAS_ICRS && sys != NOVAS_GCRS) {
+    novas_transform T;
+    prop_error(fn, novas_make_transform(frame, NOVAS_ICRS, sys, &T), 0);
+    novas_transform_vector(p, &T, p);
+  }
+
+  memcpy(pos, p, sizeof(p));
+  return 0;
+}
+
+/**
+ * Calculates the apparent place of a star, from its precomputed star vectors. It is the
+ * equivalent of novas_sky_pos() for catalog sources, without the need to convert catalog
+ * coordinates to vectors, except that the radial velocity is not calculated (set to NAN). If
+ * you need radial velocities, use novas_sky_pos() instead.
+ *
+ * @param vec       Precomputed star vectors, e.g. from novas_make_star_vec() or from a binary
+ *                  catalog opened with novas_open_star_catalog().
+ * @param frame     The observer frame, defining the location and time of observation.
+ * @param sys       The coordinate system in which to return the apparent sky location.
+ * @param[out] out  Pointer to the data structure which is populated with the calculated
+ *                  apparent location in the designated coordinate system.
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_star_vec_geom_pos(), novas_sky_pos(), novas_app_to_hor()
+ */
+int novas_star_vec_sky_pos(const novas_star_vec *restrict vec, const novas_frame *restrict frame,
+        enum novas_reference_system sys, sky_pos *restrict out) {
+  static const char *fn = "novas_star_vec_sky_pos";
+
+  double pos[3];
+
+  if(!out)
+    return novas_error(-1, EINVAL, fn, "NULL output sky_pos");
+
+  prop_error(fn, novas_star_vec_geom_pos(vec, frame, NOVAS_ICRS, pos), 0);
+  prop_error(fn, novas_geom_to_app(frame, pos, sys, out), 0);
+
+  return 0;
+}
+
+/**
+ * Writes a binary star vector catalog file from an array of catalog entries, which can then be
+ * opened (mapped into memory) with novas_open_star_catalog() without any parsing or conversion.
+ *
+ * @param filename  Path to the output file. If the file exists, it will be overwritten.
+ * @param catalog   Array of ICRS catalog entries (e.g. after transform_cat() if need be).
+ * @param n         Number of catalog entries.
+ * @param with_meta Whether to include the names, catalog designations, and numbers of the stars
+ *                  also (boolean TRUE / non-zero), or just the star vectors (FALSE / 0).
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_open_star_catalog(), novas_make_star_vec()
+ */
+int novas_write_star_catalog(const char *restrict filename, const cat_entry *restrict catalog, int n, int with_meta) {
+  static const char *fn = "novas_write_star_catalog";
+
+  starcat_header h;
+  FILE *fp;
+  int i, ok = 1;
+
+  if(!filename)
+    return novas_error(-1, EINVAL, fn, "NULL filename");
+
+  if(!filename[0])
+    return novas_error(-1, EINVAL, fn, "empty filename");
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid number of catalog entries: %d", n);
+
+  if(!catalog && n > 0)
+    return novas_error(-1, EINVAL, fn, "input catalog is NULL");
+
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, STARCAT_MAGIC, sizeof(STARCAT_MAGIC));
+  h.version = STARCAT_VERSION;
+  h.byte_order = STARCAT_BYTE_ORDER;
+  h.vec_size = sizeof(novas_star_vec);
+  h.meta_size = with_meta ? sizeof(novas_star_meta) : 0;
+  h.n = n;
+
+  fp = fopen(filename, "wb");
+  if(!fp)
+    return novas_error(-1, errno, fn, "could not open %s for writing", filename);
+
+  ok = (fwrite(&h, sizeof(h), 1, fp) == 1);
+
+  for(i = 0; ok && i < n; i++) {
+    novas_star_vec v;
+    starvectors(&catalog[i], v.pos, v.vel);
+    ok = (fwrite(&v, sizeof(v), 1, fp) == 1);
+  }
+
+  for(i = 0; ok && with_meta && i < n; i++) {
+    novas_star_meta m;
+
+    memset(&m, 0, sizeof(m));
+    strncpy(m.starname, catalog[i].starname, sizeof(m.starname) - 1);
+    strncpy(m.catalog, catalog[i].catalog, sizeof(m.catalog) - 1);
+    m.starnumber = catalog[i].starnumber;
+
+    ok = (fwrite(&m, sizeof(m), 1, fp) == 1);
+  }
+
+  if(fclose(fp) != 0)
+    ok = 0;
+
+  if(!ok)
+    return novas_error(-1, errno ? errno : EIO, fn, "could not write %s", filename);
+
+  return 0;
+}
+
+/// \cond PRIVATE
+/**
+ * Maps a file into memory (read-only), or else reads its contents into memory, on platforms that
+ * do not support mmap().
+ *
+ * @param filename      Path to the file.
+ * @param min_size      [bytes] The minimum expected size of the file.
+ * @param[out] data     The mapped (or loaded) file contents.
+ * @param[out] size     [bytes] The size of the file.
+ * @return              0 if successful, or else -1 if there was an error (errno will indicate the
+ *                      type of error).
+ *
+ * @sa novas_unmap_file()
+ */
+int novas_map_file(const char *restrict filename, size_t min_size, void **restrict data, size_t *restrict size) {
+  static const char *fn = "novas_map_file";
+
+#if STARCAT_USE_MMAP
+  struct stat st;
+  int fd = open(filename, O_RDONLY);
+
+  if(fd < 0)
+    return novas_error(-1, errno, fn, "could not open %s", filename);
+
+  if(fstat(fd, &st) != 0) {
+    int err = errno;
+    close(fd);
+    return novas_error(-1, err, fn, "could not stat %s", filename);
+  }
+
+  *size = (size_t) st.st_size;
+  if(*size < min_size) {
+    close(fd);
+    return novas_error(-1, EINVAL, fn, "%s is too short (%ld bytes)", filename, (long) *size);
+  }
+
+  *data = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if(*data == MAP_FAILED) {
+    *data = NULL;
+    return novas_error(-1, errno, fn, "could not map %s", filename);
+  }
+#else
+  FILE *fp = fopen(filename, "rb");
+  long len;
+
+  if(!fp)
+    return novas_error(-1, errno, fn, "could not open %s", filename);
+
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  rewind(fp);
+
+  if(len < (long) min_size) {
+    fclose(fp);
+    return novas_error(-1, EINVAL, fn, "%s is too short (%ld bytes)", filename, len);
+  }
+
+  *size = (size_t) len;
+  *data = malloc(*size);
+  if(!*data) {
+    fclose(fp);
+    return novas_error(-1, ENOMEM, fn, "could not allocate %ld bytes for %s", len, filename);
+  }
+
+  if(fread(*data, *size, 1, fp) != 1) {
+    fclose(fp);
+    free(*data);
+    *data = NULL;
+    return novas_error(-1, errno ? errno : EIO, fn, "could not read %s", filename);
+  }
+
+  fclose(fp);
+#endif
+
+  return 0;
+}
+
+/**
+ * Releases the memory of a file that was mapped (or loaded) by novas_map_file().
+ *
+ * @param data    The mapped (or loaded) file contents. It may be NULL.
+ * @param size    [bytes] The size of the file.
+ *
+ * @sa novas_map_file()
+ */
+void novas_unmap_file(void *data, size_t size) {
+  if(!data)
+    return;
+
+#if STARCAT_USE_MMAP
+  munmap(data, size);
+#else
+  (void) size;
+  free(data);
+#endif
+}
+/// \endcond
+
+/**
+ * Opens a binary star vector catalog file, written by novas_write_star_catalog(), for use with
+ * novas_star_vec_sky_pos(). On POSIX platforms, the file is mapped into memory (read-only), and
+ * the star vectors and metadata are used from the mapped file directly, without copying or
+ * parsing. On other platforms the file is read into memory. Either way, the catalog should be
+ * closed with novas_close_star_catalog() after it is no longer needed.
+ *
+ * @param filename  Path to the catalog file.
+ * @param[out] cat  Star catalog to populate.
+ * @return          0 if successful, or else -1 if there was an error (errno will indicate the
+ *                  type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_close_star_catalog(), novas_write_star_catalog(), novas_star_vec_sky_pos()
+ */
+int novas_open_star_catalog(const char *restrict filename, novas_star_catalog *restrict cat) {
+  static const char *fn = "novas_open_star_catalog";
+
+  const starcat_header *h;
+  size_t size, expected;
+  void *data;
+
+  if(!filename || !cat)
+    return novas_error(-1, EINVAL, fn, "NULL argument: filename=%p, cat=%p", filename, cat);
+
+  memset(cat, 0, sizeof(*cat));
+
+  prop_error(fn, novas_map_file(filename, sizeof(starcat_header), &data, &size), 0);
+
+  cat->data = data;
+  cat->size = size;
+
+  h = (const starcat_header *) data;
+
+  if(strncmp(h->magic, STARCAT_MAGIC, sizeof(h->magic)) != 0) {
+    novas_close_star_catalog(cat);
+    return novas_error(-1, EINVAL, fn, "%s is not a star vector catalog", filename);
+  }
+
+  if(h->version != STARCAT_VERSION) {
+    novas_close_star_catalog(cat);
+    return novas_error(-1, EINVAL, fn, "%s has unsupported version %u", filename, (unsigned) h->version);
+  }
+
+  if(h->byte_order != STARCAT_BYTE_ORDER || h->vec_size != sizeof(novas_star_vec)
+          || (h->meta_size && h->meta_size != sizeof(novas_star_meta))) {
+    novas_close_star_catalog(cat);
+    return novas_error(-1, EINVAL, fn, "%s was written on an incompatible platform", filename);
+  }
+
+  expected = sizeof(starcat_header) + h->n * (h->vec_size + h->meta_size);
+  if(h->n > (uint64_t) 0x7fffffff || size != expected) {
+    novas_close_star_catalog(cat);
+    return novas_error(-1, EINVAL, fn, "%s has unexpected size: %ld (expected %ld)", filename, (long) size, (long) expected);
+  }
+
+  cat->n = (int) h->n;
+  cat->stars = (const novas_star_vec *) ((char *) data + sizeof(starcat_header));
+  if(h->meta_size)
+    cat->meta = (const novas_star_meta *) ((char *) data + sizeof(starcat_header) + h->n * h->vec_size);
+
+  return 0;
+}
+
+/**
+ * Closes a binary star vector catalog, releasing its memory (or mapping), and resets it to an
+ * empty catalog.
+ *
+ * @param cat   The star catalog, previously opened with novas_open_star_catalog(). It may be
+ *              NULL.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_open_star_catalog()
+ */
+void novas_close_star_catalog(novas_star_catalog *cat) {
+  if(!cat)
+    return;
+
+  novas_unmap_file(cat->data, cat->size);
+
+  memset(cat, 0, sizeof(*cat));
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
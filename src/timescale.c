@@ -11,7 +11,7 @@
  */
 
 /// \cond PRIVATE
-#if !defined(_MSC_VER) && __STDC_VERSION__ < 201112L
+#if !defined(_MSC_VER) && !defined(_POSIX_C_SOURCE) && __STDC_VERSION__ < 201112L
 #  define _POSIX_C_SOURCE 199309L   ///< struct timespec
 #endif
 #define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
@@ -34,7 +34,6 @@ namespace novas {
 
 /// \cond PRIVATE
 #define DTA         (32.184 / DAY)        ///< [day] TT - TAI time difference
-#define GPS2TAI     (19.0 / DAY)          ///< [day] TAI - GPS time difference
 
 #define IDAY        86400                 ///< [s] 1 day
 
@@ -80,6 +79,13 @@ namespace novas {
 #define HOUR_MILLIS    3600000L           ///< milliseconds in an hour
 #define MIN_MILLIS     60000L             ///< milliseconds in a minute
 
+#define NS_DAY         INT64_C(86400000000000)  ///< [ns] nanoseconds in a day
+#define NS_TT_TAI      INT64_C(32184000000)     ///< [ns] TT - TAI time difference
+#define NS_TAI_GPS     INT64_C(19000000000)     ///< [ns] TAI - GPS time difference
+#define NS_MAX_DAYS    106000L                  ///< [day] Range of 64-bit nanosecond times around J2000
+
+#define SIDEREAL_CLOCK_ERR0  1e-6               ///< [s] Sidereal clock error at the anchor time
+
 static const double iM[] = NOVAS_RMASS_INIT;       ///< [1/M<sub>sun</sub>]
 static const double R[] = NOVAS_PLANET_RADII_INIT; ///< [m]
 
@@ -399,6 +405,523 @@ double tt2tdb_hp(double jd_tt) {
   return last_dt;
 }
 
+/**
+ * Returns the TDB-TT time difference with high precision, like tt2tdb_hp(), but using the
+ * multi-entry cache of an explicit computation context, instead of the single-entry thread-local
+ * cache of tt2tdb_hp().
+ *
+ * @param ctx     The computation context.
+ * @param jd_tt   [day] Terrestrial Time (TT) based Julian date, but Barycentric Dynamical Time (TDB)
+ * @return        [s] TDB - TT time difference, or else NAN if the context is NULL (errno will be
+ *                set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa tt2tdb_hp(), novas_init_context(), NOVAS_TT2TDB_CACHE
+ */
+double tt2tdb_hp_ctx(novas_context *ctx, double jd_tt) {
+  double *dt;
+
+  if(!ctx) {
+    novas_error(-1, EINVAL, "tt2tdb_hp_ctx", "NULL context");
+    return NAN;
+  }
+
+  dt = novas_cache_lookup(ctx, NOVAS_TT2TDB_CACHE, &jd_tt, 1);
+  if(!dt) {
+    dt = novas_cache_store(ctx, NOVAS_TT2TDB_CACHE, &jd_tt, 1);
+    *dt = tt2tdb_fp(jd_tt, 0.0);
+  }
+
+  return *dt;
+}
+
+/// \cond PRIVATE
+#define TDB_CHEB_TERMS    12      ///< Number of Chebyshev coefficients per TDB - TT segment
+/// \endcond
+
+/**
+ * Evaluates the TDB - TT time difference from the Chebyshev expansion of a segment.
+ *
+ * @param c   Chebyshev coefficients of the segment.
+ * @param x   Normalized time within the segment [-1:1].
+ * @return    [s] TDB - TT time difference.
+ */
+static double tdb_cheb_eval(const double *restrict c, double x) {
+  const double x2 = 2.0 * x;
+  double b0 = 0.0, b1 = 0.0;
+  int j;
+
+  // Clenshaw recurrence
+  for(j = TDB_CHEB_TERMS; --j > 0;) {
+    const double b = x2 * b0 - b1 + c[j];
+    b1 = b0;
+    b0 = b;
+  }
+
+  return x * b0 - b1 + 0.5 * c[0];
+}
+
+/**
+ * Returns the TDB - TT time difference from a table of piecewise polynomials.
+ *
+ * @param table   TDB - TT table.
+ * @param dt      [day] Time since the start of the table.
+ * @return        [s] TDB - TT time difference, or NAN if the time is outside of the table.
+ */
+static double tdb_table_eval(const novas_tdb_table *restrict table, double dt) {
+  double u = dt / table->span;
+  int k;
+
+  if(!(u >= 0.0 && u <= table->n))
+    return NAN;
+
+  k = (int) u;
+  if(k >= table->n)
+    k = table->n - 1;
+
+  return tdb_cheb_eval(&table->coeffs[k * TDB_CHEB_TERMS], 2.0 * (u - k) - 1.0);
+}
+
+/**
+ * Precomputes the TDB - TT time difference as piecewise Chebyshev polynomials (of fixed degree
+ * 11) over consecutive time spans, for fast evaluation via novas_tt2tdb_table() or for
+ * converting arrays of TT-based times to TDB, TCB, or TCG via novas_convert_tt_times(), e.g. for
+ * pulsar timing or telemetry. Each polynomial is fitted to the full Fairhead &amp; Bretagnon
+ * series (tt2tdb_hp()), whose shortest periods are around 14 days.
+ *
+ * With the default span (NOVAS_TDB_TABLE_SPAN, i.e. 16 days), the polynomials reproduce
+ * tt2tdb_hp() to better than 0.001 ns, at any time in the table. The maximum deviation from
+ * tt2tdb_hp() is checked at points in between the fitting nodes when the table is created, and
+ * stored in the table. Longer spans may be used to save memory (about 100 bytes per span),
+ * at the expense of accuracy: e.g. 32-day spans are accurate to about 0.5 ns, but 64-day spans
+ * only to about 0.1 &mu;s.
+ *
+ * @param jd_tt       [day] TT-based Julian date at the start of the table.
+ * @param days        [day] Time range covered by the table (&gt;0).
+ * @param span        [day] Time span of each polynomial segment, or &lt;=0 to use
+ *                    NOVAS_TDB_TABLE_SPAN.
+ * @param[out] table  The table to populate. It should be released by novas_free_tdb_table()
+ *                    after it is no longer needed.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_tt2tdb_table(), novas_convert_tt_times(), novas_free_tdb_table(), tt2tdb_hp()
+ */
+int novas_make_tdb_table(double jd_tt, double days, double span, novas_tdb_table *table) {
+  static const char *fn = "novas_make_tdb_table";
+
+  double cosk[TDB_CHEB_TERMS][TDB_CHEB_TERMS], err = 0.0;
+  int i, j, k, n;
+
+  if(!table)
+    return novas_error(-1, EINVAL, fn, "output table is NULL");
+
+  memset(table, 0, sizeof(*table));
+
+  if(!isfinite(jd_tt))
+    return novas_error(-1, EINVAL, fn, "invalid start date: %g", jd_tt);
+
+  if(span <= 0.0)
+    span = NOVAS_TDB_TABLE_SPAN;
+
+  if(!(days > 0.0) || days / span > 1e7)
+    return novas_error(-1, EINVAL, fn, "invalid time range: %g days (span %g days)", days, span);
+
+  n = (int) ceil(days / span);
+
+  table->coeffs = (double *) calloc((size_t) n * TDB_CHEB_TERMS, sizeof(double));
+  if(!table->coeffs)
+    return novas_error(-1, errno, fn, "alloc error (%d spans)", n);
+
+  table->jd_tt = jd_tt;
+  table->span = span;
+  table->n = n;
+
+  // cos(pi j (k + 1/2) / N) for the Chebyshev nodes
+  for(j = 0; j < TDB_CHEB_TERMS; j++)
+    for(k = 0; k < TDB_CHEB_TERMS; k++)
+      cosk[j][k] = cos(M_PI * j * (k + 0.5) / TDB_CHEB_TERMS);
+
+  for(i = 0; i < n; i++) {
+    double *c = &table->coeffs[i * TDB_CHEB_TERMS], f[TDB_CHEB_TERMS];
+    const double mid = jd_tt + (i + 0.5) * span;
+
+    for(k = 0; k < TDB_CHEB_TERMS; k++)
+      f[k] = tt2tdb_fp(mid + 0.5 * span * cosk[1][k], 0.0);
+
+    for(j = 0; j < TDB_CHEB_TERMS; j++) {
+      double sum = 0.0;
+      for(k = 0; k < TDB_CHEB_TERMS; k++)
+        sum += f[k] * cosk[j][k];
+      c[j] = 2.0 * sum / TDB_CHEB_TERMS;
+    }
+
+    // Check deviation at the mid-points between nodes (and the ends)
+    for(k = 0; k <= TDB_CHEB_TERMS; k++) {
+      const double x = cos(M_PI * k / TDB_CHEB_TERMS);
+      const double d = fabs(tdb_cheb_eval(c, x) - tt2tdb_fp(mid + 0.5 * span * x, 0.0));
+      if(d > err)
+        err = d;
+    }
+  }
+
+  table->max_error = err;
+
+  return 0;
+}
+
+/**
+ * Releases the memory used by a TDB - TT table, and resets it to an empty table.
+ *
+ * @param table   The TDB - TT table. It may be NULL.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_tdb_table()
+ */
+void novas_free_tdb_table(novas_tdb_table *table) {
+  if(!table)
+    return;
+
+  free(table->coeffs);
+  memset(table, 0, sizeof(*table));
+}
+
+/**
+ * Returns the TDB - TT time difference from a precomputed table of piecewise polynomials. It is
+ * the fast equivalent of tt2tdb_hp(), with the deviation from it bounded by the `max_error` of
+ * the table.
+ *
+ * @param table   The TDB - TT table, created by novas_make_tdb_table().
+ * @param jd_tt   [day] TT-based Julian date, within the time range of the table.
+ * @return        [s] TDB - TT time difference, or else NAN if the table is NULL or
+ *                uninitialized (errno set to EINVAL), or if the date is outside of the range
+ *                of the table (errno set to ERANGE).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_tdb_table(), novas_convert_tt_times(), tt2tdb_hp()
+ */
+double novas_tt2tdb_table(const novas_tdb_table *table, double jd_tt) {
+  static const char *fn = "novas_tt2tdb_table";
+  double dt;
+
+  if(!table || !table->coeffs) {
+    novas_set_errno(EINVAL, fn, "NULL or uninitialized table");
+    return NAN;
+  }
+
+  dt = tdb_table_eval(table, jd_tt - table->jd_tt);
+  if(isnan(dt))
+    novas_set_errno(ERANGE, fn, "date %.6f is outside of table range", jd_tt);
+
+  return dt;
+}
+
+/**
+ * Converts an array of TT-based Julian dates to Barycentric Dynamical Time (TDB), Barycentric
+ * Coordinate Time (TCB), or Geocentric Coordinate Time (TCG), using a precomputed table of
+ * piecewise polynomials for the TDB - TT time difference. It is meant for dense time series,
+ * such as in pulsar timing or telemetry, for which it is much faster than calculating the
+ * TDB - TT difference with tt2tdb_hp() for each time.
+ *
+ * The dates may be supplied as split Julian dates for the highest (sub-ns) precision, in which
+ * case the outputs are the fractional days, relative to the same integer days as the inputs.
+ *
+ * @param table     The TDB - TT table, covering all input dates. It may be NULL for
+ *                  converting to TCG only.
+ * @param n         Number of dates to convert.
+ * @param ijd       [day] Array of integer parts of the TT-based Julian dates, or NULL if `fjd`
+ *                  contains full Julian dates.
+ * @param fjd       [day] Array of fractional parts of the TT-based Julian dates relative to
+ *                  `ijd`, or the full Julian dates if `ijd` is NULL.
+ * @param scale     Timescale to convert to: NOVAS_TDB, NOVAS_TCB, or NOVAS_TCG. (NOVAS_TT is
+ *                  also accepted, in which case the dates are simply copied.)
+ * @param[out] out  [day] Array to populate with the converted dates (fractional parts relative
+ *                  to `ijd`, or full Julian dates if `ijd` is NULL). It may be the same as `fjd`.
+ * @return          0 if successful, or else -1 if there was an error (errno will be set to
+ *                  EINVAL, or ERANGE if a date is outside of the range of the table, in which
+ *                  case the corresponding output is NAN).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_tdb_table(), novas_tt2tdb_table(), novas_get_split_time()
+ */
+int novas_convert_tt_times(const novas_tdb_table *table, int n, const long *ijd, const double *fjd,
+        enum novas_timescale scale, double *out) {
+  static const char *fn = "novas_convert_tt_times";
+
+  const long i0 = table ? (long) floor(table->jd_tt) : 0;
+  const double f0 = table ? table->jd_tt - i0 : 0.0;
+  int i, status = 0;
+
+  if(!fjd || !out)
+    return novas_error(-1, EINVAL, fn, "NULL argument: fjd=%p, out=%p", fjd, out);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  switch(scale) {
+    case NOVAS_TT:
+    case NOVAS_TCG:
+      break;
+    case NOVAS_TDB:
+    case NOVAS_TCB:
+      if(!table || !table->coeffs)
+        return novas_error(-1, EINVAL, fn, "NULL or uninitialized table");
+      break;
+    default:
+      return novas_error(-1, EINVAL, fn, "unsupported timescale: %d", scale);
+  }
+
+  for(i = 0; i < n; i++) {
+    const long id = ijd ? ijd[i] : 0L;
+    double f = fjd[i];
+
+    switch(scale) {
+      case NOVAS_TT:
+        break;
+      case NOVAS_TCG:
+        f += TC_LG * ((id - TC_T0) + f);
+        break;
+      default: {
+        const double dt = tdb_table_eval(table, (id - i0) + (f - f0));
+
+        if(isnan(dt))
+          status = -1;
+
+        f += dt / DAY;
+
+        if(scale == NOVAS_TCB) {
+          f -= TC_TDB0;
+          f += TC_LB * ((id - TC_T0) + f);
+        }
+      }
+    }
+
+    out[i] = f;
+  }
+
+  if(status)
+    return novas_error(-1, ERANGE, fn, "some dates are outside of table range");
+
+  return 0;
+}
+
+/**
+ * Converts an astronomical time to an integer count of nanoseconds since J2000.0 (JD 2451545.0)
+ * in the specified timescale, for high-rate time series, such as telemetry, whose timestamps can
+ * then be offset or differenced with simple integer arithmetic (see novas_ns_offset() and
+ * novas_ns_diff()) with no loss of precision. The conversion itself is accurate to better than
+ * 0.1 ns, and the result is rounded to the nearest nanosecond.
+ *
+ * 64-bit nanosecond counts can represent times within about &pm;292 years of J2000.0.
+ *
+ * @param time      Pointer to the astronomical time specification data structure.
+ * @param scale     The astronomical timescale in which to return the time.
+ * @param[out] ns   [ns] The time, in nanoseconds since J2000.0 in the requested timescale.
+ * @return          0 if successful, or else -1 if there was an error (errno will be set to
+ *                  EINVAL, or ERANGE if the time cannot be represented by a 64-bit nanosecond
+ *                  count).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_set_ns_time(), novas_convert_ns_times(), novas_get_split_time()
+ */
+int novas_get_ns_time(const novas_timespec *restrict time, enum novas_timescale scale, novas_ns_time *restrict ns) {
+  static const char *fn = "novas_get_ns_time";
+
+  long ijd;
+  double fjd;
+
+  if(!ns)
+    return novas_error(-1, EINVAL, fn, "NULL output ns time");
+
+  *ns = 0;
+
+  fjd = novas_get_split_time(time, scale, &ijd);
+  if(isnan(fjd))
+    return novas_trace(fn, -1, 0);
+
+  ijd -= IJD_J2000;
+  if(labs(ijd) > NS_MAX_DAYS)
+    return novas_error(-1, ERANGE, fn, "time is too far from J2000: %ld days", ijd);
+
+  *ns = (novas_ns_time) ijd * NS_DAY + (novas_ns_time) floor(fjd * NS_DAY + 0.5);
+  return 0;
+}
+
+/**
+ * Sets an astronomical time from an integer count of nanoseconds since J2000.0 (JD 2451545.0)
+ * in the specified timescale.
+ *
+ * @param scale     The astronomical timescale in which the nanosecond time is given.
+ * @param ns        [ns] Nanoseconds since J2000.0 in the specified timescale.
+ * @param leap      [s] Leap seconds, e.g. as published by IERS Bulletin C.
+ * @param dut1      [s] mean UT1-UTC time difference, e.g. as published in IERS Bulletin A.
+ * @param[out] time Pointer to the data structure that uniquely defines the astronomical time
+ *                  for all applications.
+ * @return          0 if successful, or else -1 if there was an error (errno will be set to
+ *                  indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_get_ns_time(), novas_set_split_time()
+ */
+int novas_set_ns_time(enum novas_timescale scale, novas_ns_time ns, int leap, double dut1,
+        novas_timespec *restrict time) {
+  novas_ns_time days = ns / NS_DAY;
+  novas_ns_time rem = ns - days * NS_DAY;
+
+  prop_error("novas_set_ns_time", novas_set_split_time(scale, IJD_J2000 + (long) days, (double) rem / NS_DAY, leap, dut1, time), 0);
+  return 0;
+}
+
+/**
+ * Returns a nanosecond time, offset by the specified amount of time, rounded to the nearest
+ * nanosecond.
+ *
+ * @param t         [ns] Original time, in nanoseconds.
+ * @param seconds   [s] Seconds to add to the original time.
+ * @return          [ns] The incremented time, in nanoseconds.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_ns_diff(), novas_offset_time()
+ */
+novas_ns_time novas_ns_offset(novas_ns_time t, double seconds) {
+  return t + (novas_ns_time) floor(seconds * E9 + 0.5);
+}
+
+/**
+ * Returns the time difference (t1 - t2) between two nanosecond times in the same timescale.
+ * The difference is exact to the nanosecond for differences up to about 100 days, and has
+ * 16 significant digits otherwise.
+ *
+ * @param t1    [ns] First time, in nanoseconds.
+ * @param t2    [ns] Second time, in nanoseconds.
+ * @return      [s] The time difference (t1 - t2).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_ns_offset(), novas_diff_time()
+ */
+double novas_ns_diff(novas_ns_time t1, novas_ns_time t2) {
+  return (double) (t1 - t2) / E9;
+}
+
+/**
+ * Converts an array of TT-based nanosecond times to another timescale, without floating-point
+ * renormalization. Conversions to TAI and GPS time are simple integer offsets. UTC uses the leap
+ * seconds from novas_leap_seconds() for each time. TDB and TCB use a precomputed table of the
+ * TDB - TT time difference (see novas_make_tdb_table()), for which the outputs are accurate to
+ * within 1 ns with the default table spans.
+ *
+ * @param table     The TDB - TT table, covering all input times, for converting to TDB or TCB.
+ *                  It may be NULL for other timescales.
+ * @param n         Number of times to convert.
+ * @param tt        [ns] Array of TT-based times, in nanoseconds since J2000.0 (TT).
+ * @param scale     Timescale to convert to: NOVAS_TT, NOVAS_TAI, NOVAS_GPS, NOVAS_UTC,
+ *                  NOVAS_TDB, NOVAS_TCB, or NOVAS_TCG.
+ * @param[out] out  [ns] Array to populate with the converted times, in nanoseconds since J2000.0
+ *                  in the requested timescale. It may be the same as the input.
+ * @return          0 if successful, or else -1 if there was an error (errno will be set to
+ *                  EINVAL, or ERANGE if a time is outside of the range of the table, in which
+ *                  case the corresponding output is set to INT64_MIN).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_get_ns_time(), novas_make_tdb_table(), novas_convert_tt_times()
+ */
+int novas_convert_ns_times(const novas_tdb_table *table, int n, const novas_ns_time *tt,
+        enum novas_timescale scale, novas_ns_time *out) {
+  static const char *fn = "novas_convert_ns_times";
+
+  const double t0 = table ? table->jd_tt - NOVAS_JD_J2000 : 0.0;
+  int i, status = 0;
+
+  if(!tt || !out)
+    return novas_error(-1, EINVAL, fn, "NULL argument: tt=%p, out=%p", tt, out);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  switch(scale) {
+    case NOVAS_TT:
+    case NOVAS_TAI:
+    case NOVAS_GPS:
+    case NOVAS_UTC:
+    case NOVAS_TCG:
+      break;
+    case NOVAS_TDB:
+    case NOVAS_TCB:
+      if(!table || !table->coeffs)
+        return novas_error(-1, EINVAL, fn, "NULL or uninitialized table");
+      break;
+    default:
+      return novas_error(-1, EINVAL, fn, "unsupported timescale: %d", scale);
+  }
+
+  for(i = 0; i < n; i++) {
+    novas_ns_time t = tt[i];
+
+    switch(scale) {
+      case NOVAS_TT:
+        break;
+      case NOVAS_TAI:
+        t -= NS_TT_TAI;
+        break;
+      case NOVAS_GPS:
+        t -= NS_TT_TAI + NS_TAI_GPS;
+        break;
+      case NOVAS_UTC: {
+        // TAI-based date, then UTC date with leap seconds refined once, to be exact around leap seconds.
+        const double jd_tai = NOVAS_JD_J2000 + (double) (t - NS_TT_TAI) / NS_DAY;
+        const int leap = novas_leap_seconds(jd_tai - novas_leap_seconds(jd_tai) / DAY);
+        t -= NS_TT_TAI + (novas_ns_time) leap * E9;
+        break;
+      }
+      case NOVAS_TCG:
+        t += (novas_ns_time) floor(TC_LG * ((double) t + (IJD_J2000 - TC_T0) * NS_DAY) + 0.5);
+        break;
+      default: {
+        const double dt = tdb_table_eval(table, (double) t / NS_DAY - t0);
+
+        if(isnan(dt)) {
+          out[i] = INT64_MIN;
+          status = -1;
+          continue;
+        }
+
+        t += (novas_ns_time) floor(dt * E9 + 0.5);
+
+        if(scale == NOVAS_TCB)
+          t += (novas_ns_time) floor(TC_LB * ((double) t + (IJD_J2000 - TC_T0) * NS_DAY) - TC_TDB0 * NS_DAY + 0.5);
+      }
+    }
+
+    out[i] = t;
+  }
+
+  if(status)
+    return novas_error(-1, ERANGE, fn, "some times are outside of table range");
+
+  return 0;
+}
+
 /**
  * Returns the difference between Terrestrial Time (TT) and Universal Coordinated Time (UTC)
  *
@@ -1198,6 +1721,387 @@ int novas_timestamp(const novas_timespec *restrict time, enum novas_timescale sc
   return n;
 }
 
+/// \cond PRIVATE
+#define ISO_TIMESTAMP_LEN     24      ///< characters in a millisecond-precision ISO timestamp, e.g. "2025-01-26T21:32:49.701Z"
+#define ISO_REUSE_SPAN        (1.0 / DAY)   ///< [day] Time span over which to reuse TDB and diurnal EOP corrections
+/// \endcond
+
+/**
+ * Returns the integer Julian day number (at noon) for a proleptic Gregorian calendar date, using
+ * integer arithmetic only (Fliegel &amp; van Flandern 1968). Valid for non-negative Julian days.
+ */
+static long iso_jd_from_date(int y, int m, int d) {
+  const long a = (m - 14) / 12;
+  return (1461L * (y + 4800L + a)) / 4 + (367L * (m - 2 - 12 * a)) / 12 - (3L * ((y + 4900L + a) / 100)) / 4 + d - 32075L;
+}
+
+/**
+ * Calculates the proleptic Gregorian calendar date for an integer Julian day number, using
+ * integer arithmetic only (Fliegel &amp; van Flandern 1968). Valid for non-negative Julian days.
+ */
+static void iso_jd_to_date(long ijd, int *restrict y, int *restrict m, int *restrict d) {
+  long l = ijd + 68569L, n, i, j;
+
+  n = (4L * l) / 146097L;
+  l -= (146097L * n + 3L) / 4;
+  i = (4000L * (l + 1)) / 1461001L;
+  l -= (1461L * i) / 4 - 31L;
+  j = (80L * l) / 2447L;
+  *d = (int) (l - (2447L * j) / 80);
+  l = j / 11;
+  *m = (int) (j + 2 - 12 * l);
+  *y = (int) (100L * (n - 49) + i + l);
+}
+
+/**
+ * Parses a fixed number of decimal digits.
+ *
+ * @return    the parsed non-negative value, or -1 if not all characters were digits.
+ */
+static int iso_digits(const char *restrict s, int n) {
+  int i, v = 0;
+
+  for(i = 0; i < n; i++) {
+    const int c = s[i] - '0';
+    if(c < 0 || c > 9)
+      return -1;
+    v = 10 * v + c;
+  }
+
+  return v;
+}
+
+/**
+ * Parses a fixed-format ISO 8601 timestamp, i.e. `YYYY-MM-DDThh:mm:ss[.fff...][Z|{+/-}hh[[:]mm]]`
+ * (with 'T' or a space separating the date and time), into a split Julian date, without using
+ * stdio.
+ *
+ * @param str       String containing the timestamp. Parsing stops at the first white space or
+ *                  the string termination following the timestamp.
+ * @param[out] ijd  [day] The integer part of the Julian date.
+ * @param[out] fjd  [day] The fractional part of the Julian date, relative to `ijd`.
+ * @return          0 if the timestamp was parsed, or else -1 if the string was not in the
+ *                  expected fixed format.
+ */
+static int iso_parse_fixed(const char *restrict str, long *restrict ijd, double *restrict fjd) {
+  static const char mdays[] = { 0, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+  const char *s = str + 19;
+  int y, M, d, h, m, sec, zone = 0;
+  double frac = 0.0;
+  int i;
+
+  // The fixed-format part must not be truncated.
+  for(i = 0; i < 19; i++)
+    if(!str[i])
+      return -1;
+
+  if(str[4] != '-' || str[7] != '-' || (str[10] != 'T' && str[10] != ' ') || str[13] != ':' || str[16] != ':')
+    return -1;
+
+  y = iso_digits(str, 4);
+  M = iso_digits(&str[5], 2);
+  d = iso_digits(&str[8], 2);
+  h = iso_digits(&str[11], 2);
+  m = iso_digits(&str[14], 2);
+  sec = iso_digits(&str[17], 2);
+
+  if(y < 0 || M < 1 || M > 12 || d < 1 || d > mdays[M] || h < 0 || h > 23 || m < 0 || m > 59 || sec < 0 || sec > 59)
+    return -1;
+
+  // February 29 only in leap years...
+  if(M == 2 && d == 29 && ((y & 3) || (y % 100 == 0 && y % 400)))
+    return -1;
+
+  if(*s == '.') {
+    double scale = 1.0;
+    long f = 0;
+
+    for(s++; *s >= '0' && *s <= '9'; s++) {
+      // Digits beyond ns precision are ignored.
+      if(scale > 1e-9) {
+        f = 10 * f + (*s - '0');
+        scale *= 0.1;
+      }
+    }
+
+    frac = f * scale;
+  }
+
+  if(*s == 'Z' || *s == 'z')
+    s++;
+  else if(*s == '+' || *s == '-') {
+    const int sign = (*s == '-') ? -1 : 1;
+    int zh = iso_digits(++s, 2), zm = 0;
+
+    if(zh < 0)
+      return -1;
+    s += 2;
+
+    if(*s == ':')
+      s++;
+
+    if(*s >= '0' && *s <= '9') {
+      zm = iso_digits(s, 2);
+      if(zm < 0)
+        return -1;
+      s += 2;
+    }
+
+    zone = sign * (60 * zh + zm);
+  }
+
+  if(*s && *s != ' ' && *s != '\t' && *s != '\n' && *s != '\r')
+    return -1;
+
+  *ijd = iso_jd_from_date(y, M, d);
+  *fjd = (60.0 * (60 * h + m - zone) + sec + frac) / DAY - 0.5;
+
+  return 0;
+}
+
+/**
+ * Sets an astronomical time from a split Julian date, reusing the TDB - TT time difference and the
+ * diurnal UT1 correction of a nearby reference time, when possible. Over the span of
+ * ISO_REUSE_SPAN, these change by less than a nanosecond (TDB) and 10 ns (UT1), respectively.
+ *
+ * @param scale     The timescale in which the Julian date is defined.
+ * @param ijd       [day] Integer part of the Julian date in the timescale.
+ * @param fjd       [day] Fractional part of the Julian date in the timescale.
+ * @param leap      [s] Leap seconds.
+ * @param dut1      [s] UT1 - UTC time difference (without diurnal corrections).
+ * @param ref       Reference time, calculated fully with `novas_set_split_time()` using the same
+ *                  `leap` and `dut1` values, or else NULL.
+ * @param[out] time The astronomical time to populate.
+ * @return          1 if the reference time was reused, 0 if the time was fully calculated, or else
+ *                  -1 if there was an error.
+ */
+static int iso_set_time(enum novas_timescale scale, long ijd, double fjd, int leap, double dut1,
+        const novas_timespec *restrict ref, novas_timespec *restrict time) {
+  double dt = 0.0;
+
+  switch(scale) {
+    case NOVAS_TT: break;
+    case NOVAS_TAI: dt = DTA; break;
+    case NOVAS_GPS: dt = DTA + GPS2TAI; break;
+    case NOVAS_UTC: dt = leap / DAY + DTA; break;
+    default: ref = NULL;
+  }
+
+  if(ref) {
+    double f = fjd + dt;
+    long i = (long) floor(f);
+
+    f -= i;
+    i += ijd;
+
+    if(fabs((i - ref->ijd_tt) + (f - ref->fjd_tt)) < ISO_REUSE_SPAN) {
+      *time = *ref;
+      time->ijd_tt = i;
+      time->fjd_tt = f;
+      return 1;
+    }
+  }
+
+  prop_error("iso_set_time", novas_set_split_time(scale, ijd, fjd, leap, dut1, time), 0);
+  return 0;
+}
+
+/**
+ * Parses an array of ISO 8601 timestamps into astronomical times, e.g. for processing large
+ * numbers of timestamps from logs or telemetry. Timestamps in the fixed format:
+ *
+ * <pre>
+ *  YYYY-MM-DDThh:mm:ss[.fff...][Z|{+/-}hh[[:]mm]]
+ * </pre>
+ *
+ * (with 'T' or a space between the date and the time, and any number of fractional second
+ * digits) are parsed directly, without using stdio or any intermediate conversion, and with
+ * nanosecond precision. Other timestamps are parsed with `novas_parse_iso_date()` instead, with
+ * all the flexibility (and cost) that entails.
+ *
+ * NOTES:
+ * <ol>
+ * <li>As per the ISO 8601 specification, timestamps are interpreted as proleptic Gregorian
+ * dates, even prior to the Gregorian calendar reform of 15 October 1582.</li>
+ * <li>Timestamps, which could not be parsed, will have their `fjd_tt` field set to NAN in the
+ * output, and errno set to EINVAL.</li>
+ * <li>For UTC, TAI, GPS and TT based timestamps, the TDB - TT time difference and the diurnal
+ * UT1 corrections are calculated once for every second of time, and reused for timestamps within
+ * a second of that (e.g. consecutive timestamps in logs). This results in errors below 1 ns in
+ * TDB and below 10 ns in UT1, while speeding up processing considerably.</li>
+ * </ol>
+ *
+ * @param str         Array of `n` ISO 8601 timestamp strings.
+ * @param n           Number of timestamps to parse.
+ * @param scale       The timescale in which the timestamps are defined (usually `NOVAS_UTC`).
+ * @param leap        [s] Leap seconds, e.g. as published by IERS Bulletin C.
+ * @param dut1        [s] mean UT1-UTC time difference, e.g. as published in IERS Bulletin A.
+ * @param[out] times  Array of `n` astronomical times to populate.
+ * @return            The number of timestamps that were successfully parsed, or else -1 if
+ *                    there was an error with the arguments (errno will be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_iso_timestamps(), novas_parse_iso_date(), novas_set_str_time()
+ */
+int novas_parse_iso_times(const char *const *restrict str, int n, enum novas_timescale scale, int leap, double dut1,
+        novas_timespec *restrict times) {
+  static const char *fn = "novas_parse_iso_times";
+  const novas_timespec *ref = NULL;
+  int i, ok = 0;
+
+  if(!str || !times)
+    return novas_error(-1, EINVAL, fn, "NULL argument: str=%p, times=%p", str, times);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  for(i = 0; i < n; i++) {
+    const char *s = str[i];
+    long ijd = 0;
+    double fjd = NAN;
+
+    if(!s)
+      novas_set_errno(EINVAL, fn, "timestamp #%d is NULL", i);
+    else if(iso_parse_fixed(s, &ijd, &fjd) != 0) {
+      ijd = 0;
+      fjd = novas_parse_iso_date(s, NULL);
+    }
+
+    if(!isnan(fjd)) {
+      int status = iso_set_time(scale, ijd, fjd, leap, dut1, ref, &times[i]);
+
+      if(status >= 0) {
+        if(status == 0)
+          ref = &times[i];
+        ok++;
+        continue;
+      }
+    }
+
+    times[i].ijd_tt = 0;
+    times[i].fjd_tt = NAN;
+  }
+
+  return ok;
+}
+
+/**
+ * Prints an array of astronomical times as UTC-based ISO timestamps, to millisecond precision,
+ * into a buffer of fixed-size string records, e.g. for writing large numbers of timestamps
+ * to logs or telemetry. E.g.:
+ *
+ * <pre>
+ *  2025-01-26T21:32:49.701Z
+ * </pre>
+ *
+ * The output is identical to that of `novas_iso_timestamp()`, but dates in the years 0 to 9999
+ * are printed without stdio, which is considerably faster.
+ *
+ * @param times     Array of `n` astronomical times.
+ * @param n         Number of timestamps to print.
+ * @param[out] buf  Output buffer, with at least `n * stride` bytes of space.
+ * @param stride    [bytes] The size of each string record in the output buffer, at least 25
+ *                  bytes for a complete timestamp with termination. Each record is
+ *                  '\0'-terminated. Invalid times (e.g. with a NAN `fjd_tt`, such as the
+ *                  timestamps that novas_parse_iso_times() failed to parse) result in empty
+ *                  strings.
+ * @return          0 if successful, or else -1 if there was an error (errno will be set to
+ *                  EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_parse_iso_times(), novas_iso_timestamp()
+ */
+int novas_iso_timestamps(const novas_timespec *restrict times, int n, char *restrict buf, int stride) {
+  static const char *fn = "novas_iso_timestamps";
+  int i;
+
+  if(!times || !buf)
+    return novas_error(-1, EINVAL, fn, "NULL argument: times=%p, buf=%p", times, buf);
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid count: %d", n);
+
+  if(stride <= ISO_TIMESTAMP_LEN)
+    return novas_error(-1, EINVAL, fn, "stride too small: %d (need > %d)", stride, ISO_TIMESTAMP_LEN);
+
+  for(i = 0; i < n; i++) {
+    char *dst = &buf[(long) i * stride];
+    long ijd = 0, ms;
+    double fjd = novas_get_split_time(&times[i], NOVAS_UTC, &ijd), dd;
+    int y = 0, M = 0, d = 0, v;
+
+    if(!isfinite(fjd)) {
+      // Invalid time (e.g. failed to parse)
+      *dst = '\0';
+      continue;
+    }
+
+    // Same rounding as timestamp()
+    dd = floor(fjd + 0.5);
+    ijd += (long) dd;
+    fjd -= dd;
+
+    ms = (long) floor((fjd + 0.5) * DAY_MILLIS + 0.5);
+    if(ms >= DAY_MILLIS) {
+      ms -= DAY_MILLIS;
+      ijd++;
+    }
+
+    if(ijd < 1721060L || ijd > 5373484L) {
+      // Outside of years 0--9999: use the generic formatter.
+      if(novas_iso_timestamp(&times[i], dst, stride) < 0)
+        return novas_trace(fn, -1, 0);
+      continue;
+    }
+
+    iso_jd_to_date(ijd, &y, &M, &d);
+
+    dst[0] = '0' + y / 1000;
+    dst[1] = '0' + (y / 100) % 10;
+    dst[2] = '0' + (y / 10) % 10;
+    dst[3] = '0' + y % 10;
+    dst[4] = '-';
+    dst[5] = '0' + M / 10;
+    dst[6] = '0' + M % 10;
+    dst[7] = '-';
+    dst[8] = '0' + d / 10;
+    dst[9] = '0' + d % 10;
+    dst[10] = 'T';
+
+    v = (int) (ms / HOUR_MILLIS);
+    ms -= HOUR_MILLIS * v;
+    dst[11] = '0' + v / 10;
+    dst[12] = '0' + v % 10;
+    dst[13] = ':';
+
+    v = (int) (ms / MIN_MILLIS);
+    ms -= MIN_MILLIS * v;
+    dst[14] = '0' + v / 10;
+    dst[15] = '0' + v % 10;
+    dst[16] = ':';
+
+    v = (int) (ms / 1000L);
+    ms -= 1000L * v;
+    dst[17] = '0' + v / 10;
+    dst[18] = '0' + v % 10;
+    dst[19] = '.';
+
+    v = (int) ms;
+    dst[20] = '0' + v / 100;
+    dst[21] = '0' + (v / 10) % 10;
+    dst[22] = '0' + v % 10;
+    dst[23] = 'Z';
+    dst[24] = '\0';
+  }
+
+  return 0;
+}
+
 /**
  * Prints the standard string representation of the timescale to the specified buffer. The string
  * is terminated after. E.g. "UTC", or "TAI". It will print dates in the Gregorian calendar, which
@@ -1290,6 +2194,161 @@ double novas_time_lst(const novas_timespec *restrict time, double lon, enum nova
   return st < 0.0 ? st + DAY_HOURS : st;
 }
 
+/**
+ * (Re-)anchors a sidereal clock at its anchor time, with a full LST calculation, and updates
+ * the rate of mean sidereal time (Earth rotation plus precession) for the anchor time.
+ *
+ * @param clock     The sidereal clock
+ * @return          0 if successful, or else -1 if there was an error.
+ */
+static int sidereal_clock_anchor(novas_sidereal_clock *restrict clock) {
+  long ijd;
+  const double fjd = novas_get_split_time(&clock->anchor, NOVAS_UT1, &ijd);
+  const double jd_ut1 = ijd + fjd;
+  const double dg = remainder(novas_gmst(jd_ut1 + 1.0, clock->anchor.ut1_to_tt) - novas_gmst(jd_ut1, clock->anchor.ut1_to_tt),
+          DAY_HOURS);
+  double ee = 0.0;
+
+  // Not via novas_gast(), whose cached result may be for a slightly different time.
+  prop_error("sidereal_clock_anchor", e_tilt(jd_ut1 + clock->anchor.ut1_to_tt / DAY, clock->accuracy, NULL, NULL, &ee, NULL, NULL), 0);
+
+  clock->lst0 = novas_gmst(jd_ut1, clock->anchor.ut1_to_tt) + (ee / 3600.0 + clock->lon / 15.0);
+  clock->rate = (DAY_HOURS + dg) / DAY;
+
+  // Correct for the rounding of the UT1 date to double precision in the full calculation.
+  clock->lst0 = remainder(clock->lst0 + ((ijd - jd_ut1) + fjd) * DAY * clock->rate, DAY_HOURS);
+  if(clock->lst0 < 0.0)
+    clock->lst0 += DAY_HOURS;
+
+  return 0;
+}
+
+/**
+ * Initializes a sidereal clock, which provides the Local apparent Sidereal Time (LST) for a
+ * steadily advancing time, e.g. in a control loop, at a fraction of the cost of calling
+ * novas_time_lst() every time. The clock is anchored with a full LST calculation at the given
+ * time, after which novas_advance_sidereal_clock() extrapolates the LST linearly, at the rate of
+ * mean sidereal time (Earth rotation plus precession), and re-anchors the clock with a full
+ * calculation when the specified interval has elapsed since the last anchoring. Thus, the
+ * equation of the equinoxes (i.e. the nutation series) is evaluated only once per interval.
+ *
+ * Between anchorings the extrapolated LST deviates from novas_time_lst() only by the change in
+ * the equation of the equinoxes and in the length of day, which together amount to less than
+ * NOVAS_SIDEREAL_CLOCK_DRIFT seconds of time per second elapsed. See
+ * novas_sidereal_clock_error() for the resulting error bound at any given time.
+ *
+ * @param time      The astronomical time at which to start the clock.
+ * @param site      The observer location on Earth. Only the longitude is used.
+ * @param accuracy  NOVAS_FULL_ACCURACY (0) or NOVAS_REDUCED_ACCURACY (1).
+ * @param interval  [s] Time elapsed after which to re-anchor the clock with a full LST
+ *                  calculation, or &lt;=0 to use the default NOVAS_SIDEREAL_CLOCK_INTERVAL.
+ * @param[out] clock  The sidereal clock to initialize.
+ * @return          0 if successful, or else -1 if there was an error (errno will be set to
+ *                  indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_advance_sidereal_clock(), novas_sidereal_clock_error(), novas_time_lst()
+ */
+int novas_init_sidereal_clock(const novas_timespec *restrict time, const on_surface *restrict site,
+        enum novas_accuracy accuracy, double interval, novas_sidereal_clock *restrict clock) {
+  static const char *fn = "novas_init_sidereal_clock";
+
+  if(!time || !site || !clock)
+    return novas_error(-1, EINVAL, fn, "NULL argument: time=%p, site=%p, clock=%p", time, site, clock);
+
+  if(accuracy != NOVAS_FULL_ACCURACY && accuracy != NOVAS_REDUCED_ACCURACY)
+    return novas_error(-1, EINVAL, fn, "invalid accuracy: %d", accuracy);
+
+  if(isnan(interval))
+    return novas_error(-1, EINVAL, fn, "invalid re-anchoring interval: %g", interval);
+
+  memset(clock, 0, sizeof(*clock));
+
+  clock->anchor = *time;
+  clock->lon = site->longitude;
+  clock->accuracy = accuracy;
+  clock->interval = interval > 0.0 ? interval : NOVAS_SIDEREAL_CLOCK_INTERVAL;
+
+  prop_error(fn, sidereal_clock_anchor(clock), 0);
+  return 0;
+}
+
+/**
+ * Advances a sidereal clock by the specified amount of time, and returns the Local apparent
+ * Sidereal Time (LST) for the new time. The LST is extrapolated from the last anchor time, and
+ * the clock is re-anchored with a full calculation whenever the re-anchoring interval has
+ * elapsed.
+ *
+ * @param clock     The sidereal clock, initialized by novas_init_sidereal_clock().
+ * @param seconds   [s] The time increment, e.g. the period of the control loop. It may be zero
+ *                  or negative also.
+ * @return          [h] The Local apparent Sidereal Time (LST) in the [0:24) hour range, at the
+ *                  new time, or else NAN if there was an error (errno will be set to indicate
+ *                  the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_init_sidereal_clock(), novas_sidereal_clock_error()
+ */
+double novas_advance_sidereal_clock(novas_sidereal_clock *restrict clock, double seconds) {
+  static const char *fn = "novas_advance_sidereal_clock";
+  double lst;
+
+  if(!clock) {
+    novas_set_errno(EINVAL, fn, "NULL clock");
+    return NAN;
+  }
+
+  if(!isfinite(seconds)) {
+    novas_set_errno(EINVAL, fn, "invalid time increment: %g", seconds);
+    return NAN;
+  }
+
+  clock->elapsed += seconds;
+
+  if(fabs(clock->elapsed) >= clock->interval) {
+    novas_offset_time(&clock->anchor, clock->elapsed, &clock->anchor);
+    clock->elapsed = 0.0;
+    if(sidereal_clock_anchor(clock) != 0)
+      return novas_trace_nan(fn);
+  }
+
+  lst = remainder(clock->lst0 + clock->rate * clock->elapsed, DAY_HOURS);
+  return lst < 0.0 ? lst + DAY_HOURS : lst;
+}
+
+/**
+ * Returns an upper bound to the error of the Local apparent Sidereal Time (LST) provided by a
+ * sidereal clock, relative to a full LST calculation, at the current time of the clock. The bound
+ * grows linearly with the time elapsed since the last anchoring, at the rate of
+ * NOVAS_SIDEREAL_CLOCK_DRIFT.
+ *
+ * Note, that novas_time_lst() evaluates the LST for a UT1 date that is rounded to double
+ * precision, and so its results are themselves accurate to about 20 &mu;s only (in seconds of
+ * time), whereas the sidereal clock retains the full precision of the split Julian date at each
+ * anchoring.
+ *
+ * @param clock     The sidereal clock.
+ * @return          [s] The maximum error of the LST of the clock, in seconds of time, or else
+ *                  NAN if the clock is NULL (errno will be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_advance_sidereal_clock(), novas_init_sidereal_clock()
+ */
+double novas_sidereal_clock_error(const novas_sidereal_clock *restrict clock) {
+  if(!clock) {
+    novas_set_errno(EINVAL, "novas_sidereal_clock_error", "NULL clock");
+    return NAN;
+  }
+
+  return SIDEREAL_CLOCK_ERR0 + NOVAS_SIDEREAL_CLOCK_DRIFT * fabs(clock->elapsed);
+}
+
 /**
  * Returns the Newtonian Solar-system gravitational potential due to the major planets, the Sun,
  * and Moon. If the position is inside one of the bodies (i.e., its distance from the body's
@@ -1313,6 +2372,9 @@ static double solar_system_potential(const novas_frame *frame, const double *pos
   double V = 0.0;
   int i;
 
+  if(novas_frame_require(frame, FRAME_PLANETS) != 0)
+    return novas_trace_nan("solar_system_potential");
+
   // Calculate the Newtonian gravitational potential of the major planets, Sun and the Moon
   for(i = NOVAS_MERCURY; i <= NOVAS_MOON; i++) {
     double d = 0.0;
@@ -1332,7 +2394,7 @@ static double solar_system_potential(const novas_frame *frame, const double *pos
       // an Earth-position (possibly less accurate) as part of the frame itself...
       d = novas_vdist(pos, frame->earth_pos) * NOVAS_AU;
     }
-    else if(frame->accuracy != NOVAS_REDUCED_ACCURACY) {
+    else if(frame->accuracy == NOVAS_FULL_ACCURACY) {
       novas_set_errno(EAGAIN, "solar_system_potential", "Missing position data for planet %d", i);
       return NAN;
     }
@@ -458,6 +458,55 @@ int spin(double angle, const double *in, double *out) {
   return 0;
 }
 
+/**
+ * Transforms a vector from one coordinate system to another with same origin and axes rotated
+ * about the z-axis, like spin(), but using the multi-entry cache of an explicit computation
+ * context for the rotation, instead of the single-entry thread-local cache of spin().
+ *
+ * @param ctx         The computation context.
+ * @param angle       [deg] Angle of coordinate system rotation, positive counterclockwise when
+ *                    viewed from +z, in degrees.
+ * @param in          Input position vector.
+ * @param[out] out    Position vector expressed in new coordinate system rotated about z by
+ *                    'angle'. It can be the same vector as the input.
+ * @return            0 if successful, or -1 if the context or either vector is NULL (errno will
+ *                    be set to EINVAL).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa spin(), novas_init_context(), NOVAS_SPIN_CACHE
+ */
+int spin_ctx(novas_context *ctx, double angle, const double *in, double *out) {
+  static const char *fn = "spin_ctx";
+  double *cs, x, y;
+
+  if(!ctx)
+    return novas_error(-1, EINVAL, fn, "NULL context");
+
+  if(!in || !out)
+    return novas_error(-1, EINVAL, fn, "NULL input or output 3-vector: in=%p, out=%p", in, out);
+
+  cs = novas_cache_lookup(ctx, NOVAS_SPIN_CACHE, &angle, 1);
+  if(!cs) {
+    const double a = remainder(angle * DEGREE, TWOPI);
+
+    cs = novas_cache_store(ctx, NOVAS_SPIN_CACHE, &angle, 1);
+    cs[0] = cos(a);
+    cs[1] = sin(a);
+  }
+
+  x = in[0];
+  y = in[1];
+
+  // Perform rotation.
+  out[0] = cs[0] * x + cs[1] * y;
+  out[1] = cs[0] * y - cs[1] * x;
+  out[2] = in[2];
+
+  return 0;
+}
+
 /**
  * Converts an vector in equatorial rectangular coordinates to equatorial spherical
  * coordinates.
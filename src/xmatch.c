@@ -0,0 +1,508 @@
+/**
+ * @file
+ *
+ *  Cross-matching of source catalogs, based on the zones algorithm of Gray et al. (2007). Sources
+ *  are propagated to a common epoch (using proper_motion()), and divided into declination zones,
+ *  inside which they are sorted by right ascension. For each source in one catalog, only the
+ *  sources in the other catalog that lie in the nearby zones, and inside the corresponding right
+ *  ascension window, are compared, via dot products of unit vectors over contiguous arrays.
+ *
+ *  If the library was built with POSIX threads support (`SUPERNOVAS_USE_PTHREAD`), the zones of
+ *  the first catalog may be processed in parallel threads.
+ *
+ *  REFERENCES:
+ *  <ol>
+ *  <li>Gray, J., Nieto-Santisteban, M. A., &amp; Szalay, A. S. 2007, Microsoft Research Technical
+ *      Report, MSR-TR-2006-52, arXiv:cs/0701171</li>
+ *  </ol>
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ * @since 1.6
+ *
+ * @sa skyindex.c, target.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+#ifdef SUPERNOVAS_USE_PTHREAD
+#  include <pthread.h>
+#endif
+
+/// \cond PRIVATE
+#define __NOVAS_INTERNAL_API__      ///< Use definitions meant for internal use by SuperNOVAS only
+/// \endcond
+
+#include "novas.h"
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+namespace novas {
+#  endif
+#endif
+
+/// \cond PRIVATE
+#define XMATCH_MAX_THREADS    256     ///< Maximum number of parallel threads for cross-matching
+/// \endcond
+
+/**
+ * Sort key for arranging sources into zones
+ */
+typedef struct {
+  int zone;       ///< declination zone
+  double ra;      ///< [deg] right ascension
+  int i;          ///< catalog index
+} zone_key;
+
+/**
+ * Cross-matching results from one thread.
+ */
+typedef struct {
+  const novas_zone_catalog *a;  ///< First catalog (zones processed in this thread)
+  const novas_zone_catalog *b;  ///< Second catalog
+  double radius;                ///< [deg] match radius
+  enum novas_xmatch_mode mode;  ///< Whether to return all or only the best matches
+  int first;                    ///< First zone of the first catalog to process
+  int step;                     ///< Zone stride (number of threads)
+  novas_xmatch_pair *pairs;     ///< Dynamically allocated matches
+  int n;                        ///< Number of matches
+  int size;                     ///< Allocated capacity of pairs
+  int error;                    ///< Error (errno), if any
+} xmatch_job;
+
+static int cmp_zone_key(const void *a, const void *b) {
+  const zone_key *ka = (const zone_key *) a;
+  const zone_key *kb = (const zone_key *) b;
+
+  if(ka->zone != kb->zone)
+    return ka->zone < kb->zone ? -1 : 1;
+  if(ka->ra != kb->ra)
+    return ka->ra < kb->ra ? -1 : 1;
+  return ka->i < kb->i ? -1 : (ka->i > kb->i);
+}
+
+static int cmp_xmatch_pair(const void *a, const void *b) {
+  const novas_xmatch_pair *pa = (const novas_xmatch_pair *) a;
+  const novas_xmatch_pair *pb = (const novas_xmatch_pair *) b;
+
+  if(pa->a != pb->a)
+    return pa->a < pb->a ? -1 : 1;
+  if(pa->sep != pb->sep)
+    return pa->sep < pb->sep ? -1 : 1;
+  return pa->b < pb->b ? -1 : (pa->b > pb->b);
+}
+
+static int zone_of(const novas_zone_catalog *zc, double dec) {
+  int z = (int) floor((dec + 90.0) / zc->zone_height);
+  if(z < 0)
+    return 0;
+  if(z >= zc->n_zones)
+    return zc->n_zones - 1;
+  return z;
+}
+
+/**
+ * Returns the index of the first source in the range [from, to), with RA >= ra.
+ */
+static int zone_bisect(const novas_zone_catalog *zc, int from, int to, double ra) {
+  while(from < to) {
+    const int mid = (from + to) >> 1;
+    if(zc->ra[mid] < ra)
+      from = mid + 1;
+    else
+      to = mid;
+  }
+  return from;
+}
+
+static int xmatch_add(xmatch_job *job, int a, int b, double sep) {
+  if(job->n >= job->size) {
+    int size = job->size ? 2 * job->size : 256;
+    novas_xmatch_pair *p = (novas_xmatch_pair *) realloc(job->pairs, size * sizeof(novas_xmatch_pair));
+
+    if(!p) {
+      job->error = ENOMEM;
+      return -1;
+    }
+
+    job->pairs = p;
+    job->size = size;
+  }
+
+  job->pairs[job->n].a = a;
+  job->pairs[job->n].b = b;
+  job->pairs[job->n].sep = sep;
+  job->n++;
+
+  return 0;
+}
+
+/**
+ * Compares one source against a contiguous range of sources in the other catalog, and adds the
+ * matches.
+ */
+static int xmatch_range(xmatch_job *job, int ia, int from, int to, double cos_r, int *best, double *best_d) {
+  const novas_zone_catalog *a = job->a, *b = job->b;
+  const double *restrict bx = b->x, *restrict by = b->y, *restrict bz = b->z;
+  const double px = a->x[ia], py = a->y[ia], pz = a->z[ia];
+  int j;
+
+  for(j = from; j < to; j++) {
+    const double d = px * bx[j] + py * by[j] + pz * bz[j];
+
+    if(d < cos_r)
+      continue;
+
+    if(job->mode == NOVAS_XMATCH_BEST) {
+      if(d > *best_d) {
+        *best_d = d;
+        *best = j;
+      }
+    }
+    else {
+      const double dx = px - bx[j], dy = py - by[j], dz = pz - bz[j];
+      const double sep = 2.0 * asin(0.5 * sqrt(dx * dx + dy * dy + dz * dz)) / ARCSEC;
+      if(xmatch_add(job, a->src[ia], b->src[j], sep) != 0)
+        return -1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Cross-matches the sources in every step-th zone of the first catalog, starting from the first.
+ */
+static void *xmatch_zones(void *arg) {
+  xmatch_job *job = (xmatch_job *) arg;
+  const novas_zone_catalog *a = job->a, *b = job->b;
+  const double r = job->radius, cos_r = cos(r * DEGREE), sin_r = sin(r * DEGREE);
+  int za;
+
+  for(za = job->first; za < a->n_zones; za += job->step) {
+    int ia;
+
+    for(ia = a->zone[za]; ia < a->zone[za + 1]; ia++) {
+      const double ra = a->ra[ia], dec = asin(a->z[ia]) / DEGREE;
+      double w = 180.0, best_d = -2.0;
+      int zb, zb1, best = -1;
+
+      // Half-width of the RA window (Gray et al. 2007)
+      if(fabs(dec) + r < 89.9) {
+        const double c = fabs(cos((dec - r) * DEGREE) * cos((dec + r) * DEGREE));
+        w = fabs(atan(sin_r / sqrt(c))) / DEGREE;
+      }
+
+      zb1 = zone_of(b, dec + r);
+
+      for(zb = zone_of(b, dec - r); zb <= zb1; zb++) {
+        const int from = b->zone[zb], to = b->zone[zb + 1];
+        int err;
+
+        if(w >= 180.0)
+          err = xmatch_range(job, ia, from, to, cos_r, &best, &best_d);
+        else {
+          const double lo = ra - w, hi = ra + w;
+
+          err = xmatch_range(job, ia, zone_bisect(b, from, to, lo), zone_bisect(b, from, to, hi + 1e-12), cos_r, &best,
+                  &best_d);
+
+          // Wrap-around at RA = 0 / 360
+          if(!err && lo < 0.0)
+            err = xmatch_range(job, ia, zone_bisect(b, from, to, lo + DEG360), to, cos_r, &best, &best_d);
+          if(!err && hi >= DEG360)
+            err = xmatch_range(job, ia, from, zone_bisect(b, from, to, hi - DEG360 + 1e-12), cos_r, &best, &best_d);
+        }
+
+        if(err)
+          return NULL;
+      }
+
+      if(best >= 0) {
+        const double dx = a->x[ia] - b->x[best], dy = a->y[ia] - b->y[best], dz = a->z[ia] - b->z[best];
+        const double sep = 2.0 * asin(0.5 * sqrt(dx * dx + dy * dy + dz * dz)) / ARCSEC;
+        if(xmatch_add(job, a->src[ia], b->src[best], sep) != 0)
+          return NULL;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * Prepares a catalog for cross-matching, by propagating all sources to a common epoch, and
+ * arranging them into declination zones, sorted by right ascension within each zone. The zone
+ * catalog should be destroyed with novas_free_zone_catalog() after it is no longer needed.
+ *
+ * The zone height should be comparable to, or larger than, the match radius that will be used.
+ * For typical match radii of a few arcseconds, zones of a few arcminutes work well.
+ *
+ * @param catalog     Array of ICRS catalog entries (e.g. after transform_cat() if need be).
+ * @param n           Number of catalog entries.
+ * @param jd_tdb_cat  [day] Barycentric Dynamical Time (TDB) based Julian date of the catalog
+ *                    epoch, e.g. NOVAS_JD_J2000.
+ * @param jd_tdb      [day] Barycentric Dynamical Time (TDB) based Julian date of the epoch to
+ *                    which to propagate the sources, using their proper motions, parallaxes,
+ *                    and radial velocities.
+ * @param zone_height [deg] Height of the declination zones (0:180].
+ * @param[out] zc     Zone catalog to populate. It should not hold a previously built zone
+ *                    catalog, or else the memory of that catalog is leaked.
+ * @return            0 if successful, or else -1 if there was an error (errno will indicate the
+ *                    type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_xmatch(), novas_free_zone_catalog(), proper_motion(), starvectors()
+ */
+int novas_make_zone_catalog(const cat_entry *catalog, int n, double jd_tdb_cat, double jd_tdb, double zone_height,
+        novas_zone_catalog *zc) {
+  static const char *fn = "novas_make_zone_catalog";
+
+  novas_zone_catalog z = NOVAS_ZONE_CATALOG_INIT;
+  zone_key *keys;
+  double *p;
+  int i, k;
+
+  if(!zc)
+    return novas_error(-1, EINVAL, fn, "output zone catalog is NULL");
+
+  if(n < 0)
+    return novas_error(-1, EINVAL, fn, "invalid number of catalog entries: %d", n);
+
+  if(!catalog && n > 0)
+    return novas_error(-1, EINVAL, fn, "input catalog is NULL");
+
+  if(!(zone_height > 0.0 && zone_height <= 180.0))
+    return novas_error(-1, EINVAL, fn, "invalid zone height: %g", zone_height);
+
+  if(isnan(jd_tdb_cat) || isnan(jd_tdb))
+    return novas_error(-1, EINVAL, fn, "NaN epoch: jd_tdb_cat=%g, jd_tdb=%g", jd_tdb_cat, jd_tdb);
+
+  z.jd_tdb = jd_tdb;
+  z.zone_height = zone_height;
+  z.n = n;
+  z.n_zones = (int) ceil(180.0 / zone_height);
+
+  z.zone = (int *) calloc(z.n_zones + 1, sizeof(int));
+  z.x = (double *) calloc(n > 0 ? n : 1, sizeof(double));
+  z.y = (double *) calloc(n > 0 ? n : 1, sizeof(double));
+  z.z = (double *) calloc(n > 0 ? n : 1, sizeof(double));
+  z.ra = (double *) calloc(n > 0 ? n : 1, sizeof(double));
+  z.src = (int *) calloc(n > 0 ? n : 1, sizeof(int));
+  keys = (zone_key *) calloc(n > 0 ? n : 1, sizeof(zone_key));
+  p = (double *) calloc(n > 0 ? 3 * n : 1, sizeof(double));
+
+  if(!z.zone || !z.x || !z.y || !z.z || !z.ra || !z.src || !keys || !p) {
+    free(keys);
+    free(p);
+    novas_free_zone_catalog(&z);
+    return novas_error(-1, ENOMEM, fn, "could not allocate zone catalog for %d sources", n);
+  }
+
+  for(i = 0; i < n; i++) {
+    double *pos = &p[3 * i], vel[3], ra, dec;
+
+    starvectors(&catalog[i], pos, vel);
+    if(jd_tdb != jd_tdb_cat)
+      proper_motion(jd_tdb_cat, pos, vel, jd_tdb, pos);
+
+    vector2radec(pos, &ra, &dec);
+
+    keys[i].zone = zone_of(&z, dec);
+    keys[i].ra = 15.0 * ra;
+    keys[i].i = i;
+  }
+
+  qsort(keys, n, sizeof(zone_key), cmp_zone_key);
+
+  for(k = 0; k < n; k++) {
+    const double *pos = &p[3 * keys[k].i];
+    const double l = novas_vlen(pos);
+
+    z.x[k] = pos[0] / l;
+    z.y[k] = pos[1] / l;
+    z.z[k] = pos[2] / l;
+    z.ra[k] = keys[k].ra;
+    z.src[k] = keys[k].i;
+    z.zone[keys[k].zone + 1]++;
+  }
+
+  for(k = 0; k < z.n_zones; k++)
+    z.zone[k + 1] += z.zone[k];
+
+  free(keys);
+  free(p);
+
+  *zc = z;
+  return 0;
+}
+
+/**
+ * Releases the memory used by a zone catalog, and resets it to an empty catalog.
+ *
+ * @param zc    The zone catalog, previously built with novas_make_zone_catalog(). It may be NULL.
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_zone_catalog()
+ */
+void novas_free_zone_catalog(novas_zone_catalog *zc) {
+  if(!zc)
+    return;
+
+  free(zc->x);
+  free(zc->y);
+  free(zc->z);
+  free(zc->ra);
+  free(zc->src);
+  free(zc->zone);
+
+  memset(zc, 0, sizeof(*zc));
+}
+
+/**
+ * Cross-matches two catalogs, which were propagated to the same epoch, returning either all
+ * pairs of sources within the match radius, or only the closest match in the second catalog for
+ * each source in the first catalog. The matches are returned in ascending order of the catalog
+ * index in the first catalog, and by increasing separation for the same source.
+ *
+ * If the library was built with POSIX threads support (`SUPERNOVAS_USE_PTHREAD`), the
+ * declination zones of the first catalog are distributed among the requested number of threads.
+ * Otherwise, the matching is always performed in the calling thread. Either way, the results
+ * are the same.
+ *
+ * @param a           First catalog, prepared with novas_make_zone_catalog().
+ * @param b           Second catalog, prepared with novas_make_zone_catalog() for the same epoch
+ *                    as the first. It may be the same as the first catalog, e.g. to find close
+ *                    pairs within a catalog (in which case each source also matches itself).
+ * @param radius      [arcsec] Match radius.
+ * @param mode        NOVAS_XMATCH_ALL to return all pairs within the radius, or NOVAS_XMATCH_BEST to
+ *                    return only the closest match for each source in the first catalog.
+ * @param threads     Number of parallel threads to use (1 or less for serial processing).
+ * @param[out] matches  Array to populate with matched pairs. It may be NULL if `n_max` is 0.
+ * @param n_max       Maximum number of matches to return.
+ * @return            The total number of matches found (which may be larger than `n_max`), or
+ *                    else -1 if there was an error (errno will indicate the type of error).
+ *
+ * @since 1.6
+ * @author Attila Kovacs
+ *
+ * @sa novas_make_zone_catalog(), novas_sep(), novas_sky_index_cone()
+ */
+int novas_xmatch(const novas_zone_catalog *a, const novas_zone_catalog *b, double radius, enum novas_xmatch_mode mode,
+        int threads, novas_xmatch_pair *matches, int n_max) {
+  static const char *fn = "novas_xmatch";
+
+  xmatch_job job[XMATCH_MAX_THREADS];
+  novas_xmatch_pair *all;
+  int i, n = 0, error = 0;
+
+  if(!a || !b)
+    return novas_error(-1, EINVAL, fn, "NULL catalog: a=%p, b=%p", a, b);
+
+  if(!a->zone || !b->zone)
+    return novas_error(-1, EINVAL, fn, "zone catalog is not initialized");
+
+  if(a->jd_tdb != b->jd_tdb)
+    return novas_error(-1, EINVAL, fn, "catalogs are for different epochs: %.6f vs %.6f", a->jd_tdb, b->jd_tdb);
+
+  if(!(radius >= 0.0))
+    return novas_error(-1, EINVAL, fn, "invalid match radius: %g", radius);
+
+  if(mode != NOVAS_XMATCH_ALL && mode != NOVAS_XMATCH_BEST)
+    return novas_error(-1, EINVAL, fn, "invalid mode: %d", mode);
+
+  if(n_max < 0)
+    return novas_error(-1, EINVAL, fn, "invalid n_max: %d", n_max);
+
+  if(!matches && n_max > 0)
+    return novas_error(-1, EINVAL, fn, "output matches is NULL (with n_max = %d)", n_max);
+
+#ifndef SUPERNOVAS_USE_PTHREAD
+  threads = 1;
+#endif
+
+  if(threads < 1)
+    threads = 1;
+  if(threads > XMATCH_MAX_THREADS)
+    threads = XMATCH_MAX_THREADS;
+  if(threads > a->n_zones)
+    threads = a->n_zones;
+
+  memset(job, 0, threads * sizeof(xmatch_job));
+
+  for(i = 0; i < threads; i++) {
+    job[i].a = a;
+    job[i].b = b;
+    job[i].radius = radius / 3600.0;
+    job[i].mode = mode;
+    job[i].first = i;
+    job[i].step = threads;
+  }
+
+#ifdef SUPERNOVAS_USE_PTHREAD
+  if(threads > 1) {
+    pthread_t tid[XMATCH_MAX_THREADS];
+    int started;
+
+    for(started = 0; started < threads; started++)
+      if(pthread_create(&tid[started], NULL, xmatch_zones, &job[started]) != 0)
+        break;
+
+    // Process whatever could not be started in parallel in this thread
+    for(i = started; i < threads; i++)
+      xmatch_zones(&job[i]);
+
+    for(i = 0; i < started; i++)
+      pthread_join(tid[i], NULL);
+  }
+  else
+#endif
+    xmatch_zones(&job[0]);
+
+  for(i = 0; i < threads; i++) {
+    if(job[i].error)
+      error = job[i].error;
+    n += job[i].n;
+  }
+
+  all = error ? NULL : (novas_xmatch_pair *) malloc((n > 0 ? n : 1) * sizeof(novas_xmatch_pair));
+  if(!all && !error)
+    error = ENOMEM;
+
+  if(!error) {
+    int k = 0;
+
+    for(i = 0; i < threads; i++) {
+      if(job[i].n > 0)
+        memcpy(&all[k], job[i].pairs, job[i].n * sizeof(novas_xmatch_pair));
+      k += job[i].n;
+    }
+
+    qsort(all, n, sizeof(novas_xmatch_pair), cmp_xmatch_pair);
+
+    if(matches)
+      memcpy(matches, all, (n < n_max ? n : n_max) * sizeof(novas_xmatch_pair));
+  }
+
+  for(i = 0; i < threads; i++)
+    free(job[i].pairs);
+  free(all);
+
+  if(error)
+    return novas_error(-1, error, fn, "cross-matching failed");
+
+  return n;
+}
+
+#if __cplusplus
+#  ifdef NOVAS_NAMESPACE
+} // namespace novas
+#  endif
+#endif
@@ -0,0 +1,228 @@
+/**
+ * Regression tests for the header-only C++ layer (novas.hpp).
+ *
+ * @date Created  on Oct 18, 2026
+ * @author Attila Kovacs
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+
+#include "novas.hpp"
+
+static int is_ok(const char *func, int error) {
+  if(error) fprintf(stderr, "ERROR %d! %s\n", error, func);
+  return !error;
+}
+
+static int is_equal(const char *func, double v1, double v2, double prec) {
+  if(fabs(v1 - v2) < prec) return 1;
+
+  fprintf(stderr, "ERROR! %s (%.12g != %.12g)\n", func, v1, v2);
+  return 0;
+}
+
+static int make_frame(enum novas_accuracy accuracy, novas_frame *frame) {
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.1, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  return novas_make_frame(accuracy, &obs, &time, 0.1, -0.2, frame);
+}
+
+// Geometric positions of test sources, at various distances.
+static void make_positions(int n, double *pos) {
+  for(int i = 0; i < n; i++) {
+    const double dec = asin(2.0 * (i + 0.5) / n - 1.0), ra = 2.39996 * i, d = 1.0 + 1e5 * i;
+
+    pos[3 * i] = d * cos(dec) * cos(ra);
+    pos[3 * i + 1] = d * cos(dec) * sin(ra);
+    pos[3 * i + 2] = d * sin(dec);
+  }
+}
+
+template<enum novas_reference_system SYS, enum novas_accuracy ACC>
+static int test_reduction(const novas_frame *frame) {
+  const int N = 20;
+  int n = 0;
+  double pos[3 * N], app[3 * N], rot[3 * N];
+  sky_pos sky[N];
+  char label[80];
+
+  supernovas::reduction<SYS, ACC> r(*frame);
+
+  snprintf(label, sizeof(label), "reduction:sys=%d:acc=%d", SYS, ACC);
+  if(!is_ok(label, !r.is_valid())) return 1;
+  if(!is_ok(label, r.frame().accuracy != ACC)) n++;
+
+  make_positions(N, pos);
+
+  if(!is_ok(label, r.geom_to_app(pos, N, sky))) n++;
+  if(!is_ok(label, r.geom_to_app(pos, N, app))) n++;
+  if(!is_ok(label, r.icrs_to_sys(pos, N, rot))) n++;
+
+  for(int i = 0; i < N; i++) {
+    sky_pos exp = SKY_POS_INIT;
+    double v[3];
+
+    novas_geom_to_app(frame, &pos[3 * i], SYS, &exp);
+
+    snprintf(label, sizeof(label), "reduction:sys=%d:acc=%d:%d", SYS, ACC, i);
+    if(!is_equal(label, remainder(sky[i].ra - exp.ra, 24.0) * 15.0 * cos(exp.dec * NOVAS_DEGREE) * 3600.0, 0.0, 1e-9)) n++;
+    if(!is_equal(label, (sky[i].dec - exp.dec) * 3600.0, 0.0, 1e-9)) n++;
+    if(!is_equal(label, sky[i].dis / exp.dis - 1.0, 0.0, 1e-12)) n++;
+    if(!is_ok(label, !isnan(sky[i].rv))) n++;
+
+    for(int k = 0; k < 3; k++) {
+      if(!is_equal(label, sky[i].r_hat[k], exp.r_hat[k], 1e-12)) n++;
+      if(!is_equal(label, app[3 * i + k] / sky[i].dis, exp.r_hat[k], 1e-12)) n++;
+    }
+
+    // Rotation only, same as novas_transform_vector() from GCRS.
+    novas_transform T;
+    novas_make_transform(frame, NOVAS_GCRS, SYS, &T);
+    novas_transform_vector(&pos[3 * i], &T, v);
+    for(int k = 0; k < 3; k++)
+      if(!is_equal(label, rot[3 * i + k], v[k], 1e-12 * fabs(v[k]) + 1e-15)) n++;
+  }
+
+#ifdef __cpp_lib_span
+  {
+    double (*p3)[3] = reinterpret_cast<double (*)[3]>(pos);
+    double (*a3)[3] = reinterpret_cast<double (*)[3]>(app);
+    sky_pos s[N];
+
+    snprintf(label, sizeof(label), "reduction:sys=%d:acc=%d:span", SYS, ACC);
+    if(!is_ok(label, r.geom_to_app(std::span<const double[3]>(p3, N), std::span<sky_pos>(s, N)))) n++;
+    if(!is_ok(label, r.geom_to_app(std::span<const double[3]>(p3, N), std::span<double[3]>(a3, N)))) n++;
+    if(!is_ok(label, r.icrs_to_sys(std::span<const double[3]>(p3, N), std::span<double[3]>(a3, N)))) n++;
+    for(int i = 0; i < N; i++)
+      if(!is_equal(label, s[i].dec, sky[i].dec, 1e-15)) n++;
+
+    if(!is_ok(label, r.geom_to_app(std::span<const double[3]>(p3, N), std::span<sky_pos>(s, N - 1)) != -1)) n++;
+  }
+#endif
+
+  return n;
+}
+
+template<enum novas_accuracy ACC>
+static int test_systems() {
+  novas_frame frame = NOVAS_FRAME_INIT;
+  int n = 0;
+
+  if(!is_ok("systems:make_frame", make_frame(ACC, &frame))) return 1;
+
+  n += test_reduction<NOVAS_GCRS, ACC>(&frame);
+  n += test_reduction<NOVAS_TOD, ACC>(&frame);
+  n += test_reduction<NOVAS_CIRS, ACC>(&frame);
+  n += test_reduction<NOVAS_ICRS, ACC>(&frame);
+  n += test_reduction<NOVAS_J2000, ACC>(&frame);
+  n += test_reduction<NOVAS_MOD, ACC>(&frame);
+  n += test_reduction<NOVAS_TIRS, ACC>(&frame);
+  n += test_reduction<NOVAS_ITRS, ACC>(&frame);
+
+  return n;
+}
+
+static int test_traits() {
+  int n = 0;
+
+  static_assert(!supernovas::system_traits<NOVAS_ICRS>::is_rotated, "ICRS rotated");
+  static_assert(!supernovas::system_traits<NOVAS_GCRS>::is_rotated, "GCRS rotated");
+  static_assert(supernovas::system_traits<NOVAS_TOD>::is_equinox_based, "TOD not equinox based");
+  static_assert(!supernovas::system_traits<NOVAS_CIRS>::is_equinox_based, "CIRS equinox based");
+  static_assert(supernovas::system_traits<NOVAS_ITRS>::is_earth_fixed, "ITRS not Earth fixed");
+  static_assert(supernovas::accuracy_traits<NOVAS_FAST_ACCURACY>::is_first_order_aberration, "FAST aberration");
+  static_assert(!supernovas::accuracy_traits<NOVAS_FULL_ACCURACY>::is_first_order_aberration, "FULL aberration");
+
+  if(!is_ok("traits:system", supernovas::reduction<NOVAS_TOD, NOVAS_FULL_ACCURACY>::system != NOVAS_TOD)) n++;
+  if(!is_ok("traits:accuracy", supernovas::reduction<NOVAS_TOD, NOVAS_FAST_ACCURACY>::accuracy != NOVAS_FAST_ACCURACY)) n++;
+
+  return n;
+}
+
+static int test_lazy() {
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT, ref = NOVAS_FRAME_INIT;
+  double pos[3] = { 1e5, -2e5, 3e5 };
+  sky_pos a = SKY_POS_INIT, b = SKY_POS_INIT;
+  int n = 0;
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.1, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+
+  if(!is_ok("lazy:make_frame", novas_make_lazy_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.1, -0.2, &frame))) return 1;
+  if(!is_ok("lazy:make_frame:ref", make_frame(NOVAS_REDUCED_ACCURACY, &ref))) return 1;
+
+  supernovas::reduction<NOVAS_CIRS, NOVAS_REDUCED_ACCURACY> r(frame);
+  if(!is_ok("lazy:valid", !r.is_valid())) return 1;
+
+  if(!is_ok("lazy:reduce", r.geom_to_app(pos, 1, &a))) n++;
+  if(!is_ok("lazy:ref", novas_geom_to_app(&ref, pos, NOVAS_CIRS, &b))) n++;
+  if(!is_equal("lazy:ra", a.ra, b.ra, 1e-12)) n++;
+  if(!is_equal("lazy:dec", a.dec, b.dec, 1e-11)) n++;
+
+  return n;
+}
+
+static int test_errors() {
+  novas_frame frame = NOVAS_FRAME_INIT, uninit;
+  double pos[3] = { 1.0, 0.0, 0.0 }, app[3];
+  sky_pos out;
+  int n = 0;
+
+  memset(&uninit, 0, sizeof(uninit));
+
+  if(!is_ok("errors:make_frame", make_frame(NOVAS_REDUCED_ACCURACY, &frame))) return 1;
+
+  {
+    supernovas::reduction<NOVAS_TOD, NOVAS_REDUCED_ACCURACY> r(uninit);
+    errno = 0;
+    if(!is_ok("errors:uninit", r.is_valid())) n++;
+    if(!is_ok("errors:uninit:reduce", r.geom_to_app(pos, 1, app) != -1 || errno != EINVAL)) n++;
+  }
+
+  {
+    errno = 0;
+    supernovas::reduction<NOVAS_TOD, NOVAS_FULL_ACCURACY> r(frame);
+    if(!is_ok("errors:accuracy", r.is_valid() || errno != EINVAL)) n++;
+    if(!is_ok("errors:accuracy:reduce", r.geom_to_app(pos, 1, &out) != -1)) n++;
+    if(!is_ok("errors:accuracy:rotate", r.icrs_to_sys(pos, 1, app) != -1)) n++;
+  }
+
+  {
+    supernovas::reduction<NOVAS_TOD, NOVAS_REDUCED_ACCURACY> r(frame);
+    if(!is_ok("errors:valid", !r.is_valid())) n++;
+    if(!is_ok("errors:in:null", r.geom_to_app(nullptr, 1, app) != -1)) n++;
+    if(!is_ok("errors:out:null", r.geom_to_app(pos, 1, (double *) nullptr) != -1)) n++;
+    if(!is_ok("errors:sky:null", r.geom_to_app(pos, 1, (sky_pos *) nullptr) != -1)) n++;
+    if(!is_ok("errors:rotate:null", r.icrs_to_sys(nullptr, 1, app) != -1)) n++;
+    if(!is_ok("errors:empty", r.geom_to_app(pos, 0, app))) n++;
+  }
+
+  return n;
+}
+
+int main() {
+  int n = 0;
+
+  novas_debug(NOVAS_DEBUG_OFF);
+  enable_earth_sun_hp(1);
+
+  n += test_traits();
+  n += test_systems<NOVAS_FULL_ACCURACY>();
+  n += test_systems<NOVAS_REDUCED_ACCURACY>();
+  n += test_systems<NOVAS_FAST_ACCURACY>();
+  n += test_lazy();
+  n += test_errors();
+
+  if(n) fprintf(stderr, " -- FAILED %d tests\n", n);
+  else fprintf(stderr, " -- OK\n");
+
+  return n;
+}
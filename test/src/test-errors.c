@@ -1312,7 +1312,7 @@ static int test_make_frame() {
   if(check("make_frame:time", -1, novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, NULL, 0.0, 0.0, &frame))) n++;
   if(check("make_frame:frame", -1, novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &ts, 0.0, 0.0, NULL))) n++;
   if(check("make_frame:accuracy:-1", -1, novas_make_frame(-1, &obs, &ts, 0.0, 0.0, &frame))) n++;
-  if(check("make_frame:accuracy:2", -1, novas_make_frame(2, &obs, &ts, 0.0, 0.0, &frame))) n++;
+  if(check("make_frame:accuracy:3", -1, novas_make_frame(NOVAS_FAST_ACCURACY + 1, &obs, &ts, 0.0, 0.0, &frame))) n++;
 
   obs.where = -1;
   if(check("make_frame:obs:where:-1", -1, novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &ts, 0.0, 0.0, &frame))) n++;
@@ -1394,8 +1394,8 @@ static int test_geom_posvel() {
   frame.accuracy = -1;
   if(check("geom_posvel:frame:accuracy:-1", -1, novas_geom_posvel(&o, &frame, NOVAS_ICRS, pos, vel))) n++;
 
-  frame.accuracy = 2;
-  if(check("geom_posvel:frame:accuracy:2", -1, novas_geom_posvel(&o, &frame, NOVAS_ICRS, pos, vel))) n++;
+  frame.accuracy = NOVAS_FAST_ACCURACY + 1;
+  if(check("geom_posvel:frame:accuracy:3", -1, novas_geom_posvel(&o, &frame, NOVAS_ICRS, pos, vel))) n++;
 
 #ifndef DEFAULT_READEPH
   frame.accuracy = NOVAS_REDUCED_ACCURACY;
@@ -1431,8 +1431,8 @@ static int test_sky_pos() {
   frame.accuracy = -1;
   if(check("sky_pos:frame:accuracy:-1", -1, novas_sky_pos(&o, &frame, NOVAS_ICRS, &out))) n++;
 
-  frame.accuracy = 2;
-  if(check("sky_pos:frame:accuracy:2", -1, novas_sky_pos(&o, &frame, NOVAS_ICRS, &out))) n++;
+  frame.accuracy = NOVAS_FAST_ACCURACY + 1;
+  if(check("sky_pos:frame:accuracy:3", -1, novas_sky_pos(&o, &frame, NOVAS_ICRS, &out))) n++;
 
   frame.accuracy = NOVAS_FULL_ACCURACY;
   if(check("sky_pos:frame:accuracy:full", 73, novas_sky_pos(&o, &frame, NOVAS_ICRS, &out))) n++;
@@ -1491,8 +1491,8 @@ static int test_geom_to_app() {
   frame.accuracy = -1;
   if(check("geom_to_app:frame:accuracy:-1", -1, novas_geom_to_app(&frame, pos, NOVAS_ICRS, &out))) n++;
 
-  frame.accuracy = 2;
-  if(check("geom_to_app:frame:accuracy:2", -1, novas_geom_to_app(&frame, pos, NOVAS_ICRS, &out))) n++;
+  frame.accuracy = NOVAS_FAST_ACCURACY + 1;
+  if(check("geom_to_app:frame:accuracy:3", -1, novas_geom_to_app(&frame, pos, NOVAS_ICRS, &out))) n++;
 
   return n;
 }
@@ -2517,6 +2517,682 @@ static int test_itrs_to_enu() {
   return n;
 }
 
+static double nan_observable(const novas_frame *frame, const void *arg) {
+  (void) frame;
+  (void) arg;
+  return NAN;
+}
+
+static int test_find_events() {
+  int n = 0;
+
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  novas_event_finder finder = NOVAS_EVENT_FINDER_INIT;
+  novas_event events[2];
+  object sun = NOVAS_SUN_INIT;
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+  make_observer_at_geocenter(&obs);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(check("find_events:func", -1, novas_find_events(&finder, &frame, 1.0, events, 2))) n++;
+
+  finder.func = novas_event_elevation;
+  finder.arg = &sun;
+
+  if(check("find_events:finder", -1, novas_find_events(NULL, &frame, 1.0, events, 2))) n++;
+  if(check("find_events:frame", -1, novas_find_events(&finder, NULL, 1.0, events, 2))) n++;
+  if(check("find_events:span", -1, novas_find_events(&finder, &frame, 0.0, events, 2))) n++;
+  if(check("find_events:span:nan", -1, novas_find_events(&finder, &frame, NAN, events, 2))) n++;
+  if(check("find_events:events", -1, novas_find_events(&finder, &frame, 1.0, NULL, 2))) n++;
+  if(check("find_events:n_max", -1, novas_find_events(&finder, &frame, 1.0, events, -1))) n++;
+
+  // geocentric observer has no elevation
+  if(check("find_events:geocenter", -1, novas_find_events(&finder, &frame, 1.0, events, 2))) n++;
+
+  finder.func = nan_observable;
+  if(check("find_events:nan", -1, novas_find_events(&finder, &frame, 1.0, events, 2))) n++;
+
+  finder.func = novas_event_moon_phase;
+  finder.types = 0;
+  if(check("find_events:types", -1, novas_find_events(&finder, &frame, 1.0, events, 2))) n++;
+  finder.types = NOVAS_EVENT_ANY;
+
+  finder.step = 0.0;
+  if(check("find_events:step", -1, novas_find_events(&finder, &frame, 1.0, events, 2))) n++;
+  finder.step = 1.0;
+
+  finder.period = -1.0;
+  if(check("find_events:period", -1, novas_find_events(&finder, &frame, 1.0, events, 2))) n++;
+  finder.period = 0.0;
+
+  finder.tol = -1.0;
+  if(check("find_events:tol", -1, novas_find_events(&finder, &frame, 1.0, events, 2))) n++;
+
+  frame.state = 0;
+  if(check("find_events:frame:init", -1, novas_find_events(&finder, &frame, 1.0, events, 2))) n++;
+
+  if(check_nan("find_events:elevation:arg", novas_event_elevation(&frame, NULL))) n++;
+  if(check_nan("find_events:separation:arg", novas_event_separation(&frame, NULL))) n++;
+  if(check_nan("find_events:moon_phase:frame", novas_event_moon_phase(NULL, NULL))) n++;
+  if(check_nan("find_events:sun_angle:arg", novas_event_sun_angle(&frame, NULL))) n++;
+  if(check_nan("find_events:moon_angle:arg", novas_event_moon_angle(&frame, NULL))) n++;
+  if(check_nan("find_events:solar_illum:arg", novas_event_solar_illum(&frame, NULL))) n++;
+
+  return n;
+}
+
+static int test_hor_grid() {
+  int n = 0;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  double dir[3] = { 1.0, 0.0, 0.0 }, el;
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+  make_observer_at_geocenter(&obs);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(check("hor_grid:frames", -1, novas_hor_grid(NULL, 1, dir, 1, 1, NULL, NULL, &el, NULL))) n++;
+  if(check("hor_grid:dirs", -1, novas_hor_grid(&frame, 1, NULL, 1, 1, NULL, NULL, &el, NULL))) n++;
+  if(check("hor_grid:out", -1, novas_hor_grid(&frame, 1, dir, 1, 1, NULL, NULL, NULL, NULL))) n++;
+  if(check("hor_grid:n_times", -1, novas_hor_grid(&frame, -1, dir, 1, 1, NULL, NULL, &el, NULL))) n++;
+  if(check("hor_grid:n_src", -1, novas_hor_grid(&frame, 1, dir, -1, 1, NULL, NULL, &el, NULL))) n++;
+  if(check("hor_grid:observer", -1, novas_hor_grid(&frame, 1, dir, 1, 1, NULL, NULL, &el, NULL))) n++;
+
+  frame = (novas_frame) NOVAS_FRAME_INIT;
+  if(check("hor_grid:frame", -1, novas_hor_grid(&frame, 1, dir, 1, 1, NULL, NULL, &el, NULL))) n++;
+
+  return n;
+}
+
+static int test_sky_index() {
+  int n = 0, src[2];
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  novas_sky_index index = NOVAS_SKY_INDEX_INIT, empty = NOVAS_SKY_INDEX_INIT;
+  cat_entry star = CAT_ENTRY_INIT;
+  double dir[3] = { 1.0, 0.0, 0.0 }, zero[3] = { 0.0 };
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+  make_observer_at_geocenter(&obs);
+
+  if(check("sky_index:make:frame", -1, novas_sky_index_near(&index, &frame, NOVAS_ICRS, 0.0, 0.0, 1.0, src, 2))) n++;
+
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(check("sky_index:make:index", -1, novas_make_sky_index(&star, 1, 2, NULL))) n++;
+  if(check("sky_index:make:catalog", -1, novas_make_sky_index(NULL, 1, 2, &index))) n++;
+  if(check("sky_index:make:n", -1, novas_make_sky_index(&star, -1, 2, &index))) n++;
+  if(check("sky_index:make:level:lo", -1, novas_make_sky_index(&star, 1, -1, &index))) n++;
+  if(check("sky_index:make:level:hi", -1, novas_make_sky_index(&star, 1, NOVAS_SKY_INDEX_MAX_LEVEL + 1, &index))) n++;
+
+  if(check("sky_index:cone:empty", -1, novas_sky_index_cone(&empty, dir, 1.0, src, 2))) n++;
+
+  if(check("sky_index:make", 0, novas_make_sky_index(&star, 1, 2, &index))) n++;
+
+  if(check("sky_index:cone:index", -1, novas_sky_index_cone(NULL, dir, 1.0, src, 2))) n++;
+  if(check("sky_index:cone:dir", -1, novas_sky_index_cone(&index, NULL, 1.0, src, 2))) n++;
+  if(check("sky_index:cone:zero", -1, novas_sky_index_cone(&index, zero, 1.0, src, 2))) n++;
+  if(check("sky_index:cone:radius", -1, novas_sky_index_cone(&index, dir, -1.0, src, 2))) n++;
+  if(check("sky_index:cone:radius:nan", -1, novas_sky_index_cone(&index, dir, NAN, src, 2))) n++;
+  if(check("sky_index:cone:src", -1, novas_sky_index_cone(&index, dir, 1.0, NULL, 2))) n++;
+  if(check("sky_index:cone:n_max", -1, novas_sky_index_cone(&index, dir, 1.0, src, -1))) n++;
+
+  if(check("sky_index:above:frame", -1, novas_sky_index_above(&index, NULL, 0.0, src, 2))) n++;
+  if(check("sky_index:above:observer", -1, novas_sky_index_above(&index, &frame, 0.0, src, 2))) n++;
+  if(check("sky_index:above:index", -1, novas_sky_index_above(NULL, &frame, 0.0, src, 2))) n++;
+
+  if(check("sky_index:near:frame", -1, novas_sky_index_near(&index, NULL, NOVAS_ICRS, 0.0, 0.0, 1.0, src, 2))) n++;
+  if(check("sky_index:near:sys", -1, novas_sky_index_near(&index, &frame, -1, 0.0, 0.0, 1.0, src, 2))) n++;
+  if(check("sky_index:near:radius", -1, novas_sky_index_near(&index, &frame, NOVAS_ICRS, 0.0, 0.0, -1.0, src, 2))) n++;
+
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+  if(check("sky_index:above:el", -1, novas_sky_index_above(&index, &frame, NAN, src, 2))) n++;
+
+  novas_free_sky_index(&index);
+
+  return n;
+}
+
+static int test_xmatch() {
+  int n = 0;
+  cat_entry star = CAT_ENTRY_INIT;
+  novas_zone_catalog z = NOVAS_ZONE_CATALOG_INIT, z1 = NOVAS_ZONE_CATALOG_INIT, empty = NOVAS_ZONE_CATALOG_INIT;
+  novas_xmatch_pair m[2];
+
+  if(check("xmatch:make:zc", -1, novas_make_zone_catalog(&star, 1, NOVAS_JD_J2000, NOVAS_JD_J2000, 1.0, NULL))) n++;
+  if(check("xmatch:make:catalog", -1, novas_make_zone_catalog(NULL, 1, NOVAS_JD_J2000, NOVAS_JD_J2000, 1.0, &z))) n++;
+  if(check("xmatch:make:n", -1, novas_make_zone_catalog(&star, -1, NOVAS_JD_J2000, NOVAS_JD_J2000, 1.0, &z))) n++;
+  if(check("xmatch:make:height:0", -1, novas_make_zone_catalog(&star, 1, NOVAS_JD_J2000, NOVAS_JD_J2000, 0.0, &z))) n++;
+  if(check("xmatch:make:height:hi", -1, novas_make_zone_catalog(&star, 1, NOVAS_JD_J2000, NOVAS_JD_J2000, 181.0, &z))) n++;
+  if(check("xmatch:make:jd_cat", -1, novas_make_zone_catalog(&star, 1, NAN, NOVAS_JD_J2000, 1.0, &z))) n++;
+  if(check("xmatch:make:jd", -1, novas_make_zone_catalog(&star, 1, NOVAS_JD_J2000, NAN, 1.0, &z))) n++;
+
+  if(check("xmatch:make", 0, novas_make_zone_catalog(&star, 1, NOVAS_JD_J2000, NOVAS_JD_J2000, 1.0, &z))) n++;
+  if(check("xmatch:make:1", 0, novas_make_zone_catalog(&star, 1, NOVAS_JD_J2000, NOVAS_JD_J2000 + 1.0, 1.0, &z1))) n++;
+
+  if(check("xmatch:a", -1, novas_xmatch(NULL, &z, 1.0, NOVAS_XMATCH_ALL, 1, m, 2))) n++;
+  if(check("xmatch:b", -1, novas_xmatch(&z, NULL, 1.0, NOVAS_XMATCH_ALL, 1, m, 2))) n++;
+  if(check("xmatch:empty", -1, novas_xmatch(&z, &empty, 1.0, NOVAS_XMATCH_ALL, 1, m, 2))) n++;
+  if(check("xmatch:epoch", -1, novas_xmatch(&z, &z1, 1.0, NOVAS_XMATCH_ALL, 1, m, 2))) n++;
+  if(check("xmatch:radius", -1, novas_xmatch(&z, &z, -1.0, NOVAS_XMATCH_ALL, 1, m, 2))) n++;
+  if(check("xmatch:radius:nan", -1, novas_xmatch(&z, &z, NAN, NOVAS_XMATCH_ALL, 1, m, 2))) n++;
+  if(check("xmatch:mode", -1, novas_xmatch(&z, &z, 1.0, -1, 1, m, 2))) n++;
+  if(check("xmatch:n_max", -1, novas_xmatch(&z, &z, 1.0, NOVAS_XMATCH_ALL, 1, m, -1))) n++;
+  if(check("xmatch:matches", -1, novas_xmatch(&z, &z, 1.0, NOVAS_XMATCH_ALL, 1, NULL, 2))) n++;
+
+  novas_free_zone_catalog(&z);
+  novas_free_zone_catalog(&z1);
+
+  return n;
+}
+
+static int test_star_catalog() {
+  int n = 0;
+  const char *filename = "test-starcat-errors.bin";
+  cat_entry star = CAT_ENTRY_INIT;
+  novas_star_vec vec;
+  novas_star_catalog cat = NOVAS_STAR_CATALOG_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  sky_pos pos = SKY_POS_INIT;
+  double p[3];
+  FILE *fp;
+
+  if(check("star_vec:make:star", -1, novas_make_star_vec(NULL, &vec))) n++;
+  if(check("star_vec:make:vec", -1, novas_make_star_vec(&star, NULL))) n++;
+  novas_make_star_vec(&star, &vec);
+
+  if(check("star_vec:geom_pos:frame:init", -1, novas_star_vec_geom_pos(&vec, &frame, NOVAS_ICRS, p))) n++;
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+  make_observer_at_geocenter(&obs);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(check("star_vec:geom_pos:vec", -1, novas_star_vec_geom_pos(NULL, &frame, NOVAS_ICRS, p))) n++;
+  if(check("star_vec:geom_pos:frame", -1, novas_star_vec_geom_pos(&vec, NULL, NOVAS_ICRS, p))) n++;
+  if(check("star_vec:geom_pos:pos", -1, novas_star_vec_geom_pos(&vec, &frame, NOVAS_ICRS, NULL))) n++;
+  if(check("star_vec:geom_pos:sys", -1, novas_star_vec_geom_pos(&vec, &frame, -1, p))) n++;
+  if(check("star_vec:sky_pos:out", -1, novas_star_vec_sky_pos(&vec, &frame, NOVAS_ICRS, NULL))) n++;
+  if(check("star_vec:sky_pos:vec", -1, novas_star_vec_sky_pos(NULL, &frame, NOVAS_ICRS, &pos))) n++;
+
+  if(check("star_catalog:write:filename", -1, novas_write_star_catalog(NULL, &star, 1, 1))) n++;
+  if(check("star_catalog:write:filename:empty", -1, novas_write_star_catalog("", &star, 1, 1))) n++;
+  if(check("star_catalog:write:catalog", -1, novas_write_star_catalog(filename, NULL, 1, 1))) n++;
+  if(check("star_catalog:write:n", -1, novas_write_star_catalog(filename, &star, -1, 1))) n++;
+  if(check("star_catalog:write:dir", -1, novas_write_star_catalog("/no-such-dir/starcat.bin", &star, 1, 1))) n++;
+
+  if(check("star_catalog:open:filename", -1, novas_open_star_catalog(NULL, &cat))) n++;
+  if(check("star_catalog:open:cat", -1, novas_open_star_catalog(filename, NULL))) n++;
+  if(check("star_catalog:open:missing", -1, novas_open_star_catalog("/no-such-dir/starcat.bin", &cat))) n++;
+
+  // Too short
+  fp = fopen(filename, "w");
+  fprintf(fp, "NOVASSV");
+  fclose(fp);
+  if(check("star_catalog:open:short", -1, novas_open_star_catalog(filename, &cat))) n++;
+
+  // Not a catalog
+  fp = fopen(filename, "w");
+  fprintf(fp, "This is not a star vector catalog, just some random text here...");
+  fclose(fp);
+  if(check("star_catalog:open:magic", -1, novas_open_star_catalog(filename, &cat))) n++;
+
+  // Unexpected size
+  if(check("star_catalog:write", 0, novas_write_star_catalog(filename, &star, 1, 1))) n++;
+  fp = fopen(filename, "ab");
+  fprintf(fp, "extra");
+  fclose(fp);
+  if(check("star_catalog:open:size", -1, novas_open_star_catalog(filename, &cat))) n++;
+
+  remove(filename);
+
+  return n;
+}
+
+static int test_parse_radec_table() {
+  int n = 0;
+  const char *csv = "12:00:00,10:00:00\n";
+  double ra[2], dec[2];
+
+  if(check("parse_radec_table:buf", -1, novas_parse_radec_table(NULL, 10, ',', 0, 1, ra, dec, 2, NULL))) n++;
+  if(check("parse_radec_table:ra", -1, novas_parse_radec_table(csv, strlen(csv), ',', 0, 1, NULL, dec, 2, NULL))) n++;
+  if(check("parse_radec_table:dec", -1, novas_parse_radec_table(csv, strlen(csv), ',', 0, 1, ra, NULL, 2, NULL))) n++;
+  if(check("parse_radec_table:ra_col", -1, novas_parse_radec_table(csv, strlen(csv), ',', -1, 1, ra, dec, 2, NULL))) n++;
+  if(check("parse_radec_table:dec_col", -1, novas_parse_radec_table(csv, strlen(csv), ',', 0, -1, ra, dec, 2, NULL))) n++;
+  if(check("parse_radec_table:same_col", -1, novas_parse_radec_table(csv, strlen(csv), ',', 1, 1, ra, dec, 2, NULL))) n++;
+  if(check("parse_radec_table:n_max", -1, novas_parse_radec_table(csv, strlen(csv), ',', 0, 1, ra, dec, -1, NULL))) n++;
+
+  return n;
+}
+
+static int test_parse_iso_times() {
+  int n = 0;
+  const char *str[1] = { "2025-01-26T19:33:08Z" };
+  novas_timespec t[1];
+
+  if(check("parse_iso_times:str", -1, novas_parse_iso_times(NULL, 1, NOVAS_UTC, 37, 0.0, t))) n++;
+  if(check("parse_iso_times:times", -1, novas_parse_iso_times(str, 1, NOVAS_UTC, 37, 0.0, NULL))) n++;
+  if(check("parse_iso_times:n", -1, novas_parse_iso_times(str, -1, NOVAS_UTC, 37, 0.0, t))) n++;
+
+  return n;
+}
+
+static int test_iso_timestamps() {
+  int n = 0;
+  novas_timespec t[1] = { NOVAS_TIMESPEC_INIT };
+  char buf[30];
+
+  if(check("iso_timestamps:times", -1, novas_iso_timestamps(NULL, 1, buf, sizeof(buf)))) n++;
+  if(check("iso_timestamps:buf", -1, novas_iso_timestamps(t, 1, NULL, sizeof(buf)))) n++;
+  if(check("iso_timestamps:n", -1, novas_iso_timestamps(t, -1, buf, sizeof(buf)))) n++;
+  if(check("iso_timestamps:stride", -1, novas_iso_timestamps(t, 1, buf, 24))) n++;
+
+  return n;
+}
+
+static int test_leap_seconds() {
+  int n = 0;
+
+  if(check("leap_seconds:nan", -1, novas_leap_seconds(NAN))) n++;
+  if(check("load_leap_seconds:nofile", -1, novas_load_leap_seconds("/no/such/file"))) n++;
+
+  return n;
+}
+
+static int test_unix_to_jd() {
+  int n = 0;
+  double t[1] = {0.0}, jd[1];
+
+  if(check("unix_to_jd:unix_time", -1, novas_unix_to_jd(NULL, 1, NOVAS_TT, NULL, jd))) n++;
+  if(check("unix_to_jd:fjd", -1, novas_unix_to_jd(t, 1, NOVAS_TT, NULL, NULL))) n++;
+  if(check("unix_to_jd:n", -1, novas_unix_to_jd(t, -1, NOVAS_TT, NULL, jd))) n++;
+  if(check("unix_to_jd:scale:ut1", -1, novas_unix_to_jd(t, 1, NOVAS_UT1, NULL, jd))) n++;
+  if(check("unix_to_jd:scale:tcb", -1, novas_unix_to_jd(t, 1, NOVAS_TCB, NULL, jd))) n++;
+
+  return n;
+}
+
+static int test_eop_table() {
+  int n = 0;
+  novas_eop_table table = NOVAS_EOP_TABLE_INIT;
+  novas_eop eop;
+  novas_frame frame;
+  observer obs;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+
+  make_observer_at_geocenter(&obs);
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+
+  if(check("read_eop_table:filename", -1, novas_read_eop_table(NULL, &table))) n++;
+  if(check("read_eop_table:table", -1, novas_read_eop_table("eop.txt", NULL))) n++;
+  if(check("read_eop_table:nofile", -1, novas_read_eop_table("/no/such/file", &table))) n++;
+  if(check("open_eop_table:filename", -1, novas_open_eop_table(NULL, &table))) n++;
+  if(check("open_eop_table:table", -1, novas_open_eop_table("eop.bin", NULL))) n++;
+  if(check("open_eop_table:nofile", -1, novas_open_eop_table("/no/such/file", &table))) n++;
+  if(check("write_eop_table:filename", -1, novas_write_eop_table(NULL, &table))) n++;
+  if(check("write_eop_table:filename:empty", -1, novas_write_eop_table("", &table))) n++;
+  if(check("write_eop_table:table", -1, novas_write_eop_table("eop.bin", NULL))) n++;
+  if(check("write_eop_table:empty", -1, novas_write_eop_table("eop.bin", &table))) n++;
+  if(check("eop_at:table", -1, novas_eop_at(NULL, NOVAS_JD_J2000, &eop))) n++;
+  if(check("eop_at:eop", -1, novas_eop_at(&table, NOVAS_JD_J2000, NULL))) n++;
+  if(check("eop_at:empty", -1, novas_eop_at(&table, NOVAS_JD_J2000, &eop))) n++;
+  if(check("make_eop_frame:time", -1, novas_make_eop_frame(NOVAS_REDUCED_ACCURACY, &obs, NULL, &table, &frame))) n++;
+  if(check("make_eop_frame:table", -1, novas_make_eop_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, NULL, &frame))) n++;
+  if(check("make_eop_frame:empty", -1, novas_make_eop_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, &table, &frame))) n++;
+
+  novas_close_eop_table(NULL); // no crash.
+
+  return n;
+}
+
+static int test_diurnal_eop_table() {
+  int n = 0;
+  novas_diurnal_eop_table table = NOVAS_DIURNAL_EOP_TABLE_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  double x;
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+
+  if(check("make_diurnal_eop_table:start", -1, novas_make_diurnal_eop_table(NULL, 1.0, 0.0, &table))) n++;
+  if(check("make_diurnal_eop_table:table", -1, novas_make_diurnal_eop_table(&time, 1.0, 0.0, NULL))) n++;
+  if(check("make_diurnal_eop_table:days:0", -1, novas_make_diurnal_eop_table(&time, 0.0, 0.0, &table))) n++;
+  if(check("make_diurnal_eop_table:days:nan", -1, novas_make_diurnal_eop_table(&time, NAN, 0.0, &table))) n++;
+  if(check("make_diurnal_eop_table:days:huge", -1, novas_make_diurnal_eop_table(&time, 1e9, 0.0, &table))) n++;
+  if(check("diurnal_eop_from_table:table", -1, novas_diurnal_eop_from_table(NULL, &time, &x, NULL, NULL))) n++;
+  if(check("diurnal_eop_from_table:time", -1, novas_diurnal_eop_from_table(&table, NULL, &x, NULL, NULL))) n++;
+  if(check("diurnal_eop_from_table:empty", -1, novas_diurnal_eop_from_table(&table, &time, &x, NULL, NULL))) n++;
+  if(check("set_diurnal_eop_table:empty", -1, novas_set_diurnal_eop_table(&table))) n++;
+
+  novas_free_diurnal_eop_table(NULL); // no crash
+
+  return n;
+}
+
+static int test_tdb_table() {
+  int n = 0;
+  novas_tdb_table table = NOVAS_TDB_TABLE_INIT;
+  double jd = NOVAS_JD_J2000;
+  long ijd = 2451545;
+
+  if(check("make_tdb_table:table", -1, novas_make_tdb_table(NOVAS_JD_J2000, 10.0, 0.0, NULL))) n++;
+  if(check("make_tdb_table:jd:nan", -1, novas_make_tdb_table(NAN, 10.0, 0.0, &table))) n++;
+  if(check("make_tdb_table:days:0", -1, novas_make_tdb_table(NOVAS_JD_J2000, 0.0, 0.0, &table))) n++;
+  if(check("make_tdb_table:days:huge", -1, novas_make_tdb_table(NOVAS_JD_J2000, 1e12, 0.0, &table))) n++;
+  if(check_nan("tt2tdb_table:table", novas_tt2tdb_table(NULL, NOVAS_JD_J2000))) n++;
+  if(check_nan("tt2tdb_table:empty", novas_tt2tdb_table(&table, NOVAS_JD_J2000))) n++;
+  if(check("convert_tt_times:fjd", -1, novas_convert_tt_times(&table, 1, &ijd, NULL, NOVAS_TCG, &jd))) n++;
+  if(check("convert_tt_times:out", -1, novas_convert_tt_times(&table, 1, &ijd, &jd, NOVAS_TCG, NULL))) n++;
+  if(check("convert_tt_times:n", -1, novas_convert_tt_times(&table, -1, &ijd, &jd, NOVAS_TCG, &jd))) n++;
+  if(check("convert_tt_times:scale", -1, novas_convert_tt_times(&table, 1, &ijd, &jd, NOVAS_UTC, &jd))) n++;
+  if(check("convert_tt_times:table", -1, novas_convert_tt_times(NULL, 1, &ijd, &jd, NOVAS_TDB, &jd))) n++;
+  if(check("convert_tt_times:empty", -1, novas_convert_tt_times(&table, 1, &ijd, &jd, NOVAS_TCB, &jd))) n++;
+
+  novas_make_tdb_table(NOVAS_JD_J2000, 10.0, 0.0, &table);
+  if(check_nan("tt2tdb_table:range", novas_tt2tdb_table(&table, NOVAS_JD_J2000 - 1.0))) n++;
+  jd = NOVAS_JD_J2000 + 20.0;
+  if(check("convert_tt_times:range", -1, novas_convert_tt_times(&table, 1, NULL, &jd, NOVAS_TDB, &jd))) n++;
+  novas_free_tdb_table(&table);
+  novas_free_tdb_table(NULL); // no crash
+
+  return n;
+}
+
+static int test_ns_time() {
+  int n = 0;
+  novas_timespec t = NOVAS_TIMESPEC_INIT;
+  novas_tdb_table table = NOVAS_TDB_TABLE_INIT;
+  novas_ns_time ns = 0;
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 37, 0.0, &t);
+
+  if(check("get_ns_time:ns", -1, novas_get_ns_time(&t, NOVAS_TT, NULL))) n++;
+  if(check("get_ns_time:time", -1, novas_get_ns_time(NULL, NOVAS_TT, &ns))) n++;
+  if(check("get_ns_time:scale", -1, novas_get_ns_time(&t, -1, &ns))) n++;
+
+  t.ijd_tt += 200000;
+  if(check("get_ns_time:range", -1, novas_get_ns_time(&t, NOVAS_TT, &ns))) n++;
+
+  if(check("set_ns_time:time", -1, novas_set_ns_time(NOVAS_TT, 0, 37, 0.0, NULL))) n++;
+  if(check("set_ns_time:scale", -1, novas_set_ns_time(-1, 0, 37, 0.0, &t))) n++;
+
+  if(check("convert_ns_times:tt", -1, novas_convert_ns_times(NULL, 1, NULL, NOVAS_TT, &ns))) n++;
+  if(check("convert_ns_times:out", -1, novas_convert_ns_times(NULL, 1, &ns, NOVAS_TT, NULL))) n++;
+  if(check("convert_ns_times:n", -1, novas_convert_ns_times(NULL, -1, &ns, NOVAS_TT, &ns))) n++;
+  if(check("convert_ns_times:scale", -1, novas_convert_ns_times(NULL, 1, &ns, NOVAS_UT1, &ns))) n++;
+  if(check("convert_ns_times:table", -1, novas_convert_ns_times(NULL, 1, &ns, NOVAS_TDB, &ns))) n++;
+  if(check("convert_ns_times:empty", -1, novas_convert_ns_times(&table, 1, &ns, NOVAS_TCB, &ns))) n++;
+
+  novas_make_tdb_table(NOVAS_JD_J2000, 10.0, 0.0, &table);
+  ns = -NOVAS_DAY * 1000000000LL;
+  if(check("convert_ns_times:range", -1, novas_convert_ns_times(&table, 1, &ns, NOVAS_TDB, &ns))) n++;
+  if(check("convert_ns_times:range:invalid", 1, ns == INT64_MIN)) n++;
+  novas_free_tdb_table(&table);
+
+  return n;
+}
+
+static int test_sidereal_clock() {
+  int n = 0;
+  novas_timespec t = NOVAS_TIMESPEC_INIT;
+  novas_sidereal_clock clock;
+  on_surface site = ON_SURFACE_INIT;
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &t);
+
+  if(check("init_sidereal_clock:time", -1, novas_init_sidereal_clock(NULL, &site, NOVAS_FULL_ACCURACY, 0.0, &clock))) n++;
+  if(check("init_sidereal_clock:site", -1, novas_init_sidereal_clock(&t, NULL, NOVAS_FULL_ACCURACY, 0.0, &clock))) n++;
+  if(check("init_sidereal_clock:clock", -1, novas_init_sidereal_clock(&t, &site, NOVAS_FULL_ACCURACY, 0.0, NULL))) n++;
+  if(check("init_sidereal_clock:accuracy", -1, novas_init_sidereal_clock(&t, &site, -1, 0.0, &clock))) n++;
+  if(check("init_sidereal_clock:interval", -1, novas_init_sidereal_clock(&t, &site, NOVAS_FULL_ACCURACY, NAN, &clock))) n++;
+
+  novas_init_sidereal_clock(&t, &site, NOVAS_FULL_ACCURACY, 0.0, &clock);
+  if(check_nan("advance_sidereal_clock:clock", novas_advance_sidereal_clock(NULL, 1.0))) n++;
+  if(check_nan("advance_sidereal_clock:nan", novas_advance_sidereal_clock(&clock, NAN))) n++;
+  if(check_nan("advance_sidereal_clock:inf", novas_advance_sidereal_clock(&clock, INFINITY))) n++;
+  if(check_nan("sidereal_clock_error:clock", novas_sidereal_clock_error(NULL))) n++;
+
+  clock.accuracy = -1;
+  if(check_nan("advance_sidereal_clock:reanchor", novas_advance_sidereal_clock(&clock, 100.0))) n++;
+
+  return n;
+}
+
+static int test_transform_vectors() {
+  int n = 0, i;
+  novas_transform T = NOVAS_TRANSFORM_INIT;
+  double in[3] = {1.0}, out[3];
+  sky_pos p = SKY_POS_INIT;
+
+  if(check("transform_vectors:in", -1, novas_transform_vectors(NULL, 3, 1, &T, out, 3))) n++;
+  if(check("transform_vectors:transform", -1, novas_transform_vectors(in, 3, 1, NULL, out, 3))) n++;
+  if(check("transform_vectors:out", -1, novas_transform_vectors(in, 3, 1, &T, NULL, 3))) n++;
+  if(check("transform_vectors:n", -1, novas_transform_vectors(in, 3, -1, &T, out, 3))) n++;
+
+  for(i = 0; i < 3; i++) {
+    if(check("transform_vectors:in_stride", -1, novas_transform_vectors(in, i, 1, &T, out, 3))) n++;
+    if(check("transform_vectors:out_stride", -1, novas_transform_vectors(in, 3, 1, &T, out, i))) n++;
+  }
+
+  if(check("transform_vectors:inplace:stride", -1, novas_transform_vectors(in, 3, 1, &T, in, 4))) n++;
+
+  if(check("transform_sky_positions:in", -1, novas_transform_sky_positions(NULL, 1, &T, &p))) n++;
+  if(check("transform_sky_positions:transform", -1, novas_transform_sky_positions(&p, 1, NULL, &p))) n++;
+  if(check("transform_sky_positions:out", -1, novas_transform_sky_positions(&p, 1, &T, NULL))) n++;
+  if(check("transform_sky_positions:n", -1, novas_transform_sky_positions(&p, -1, &T, &p))) n++;
+
+  return n;
+}
+
+static int test_hor_to_app_array() {
+  int n = 0;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  double az = 0.0, el = 0.0, ra, dec;
+
+  make_observer_at_geocenter(&obs);
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+
+  if(check("hor_to_app_array:frame:init", -1, novas_hor_to_app_array(&frame, 1, &az, &el, NULL, NOVAS_ICRS, &ra, &dec))) n++;
+
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+  if(check("hor_to_app_array:frame:geocenter", -1, novas_hor_to_app_array(&frame, 1, &az, &el, NULL, NOVAS_ICRS, &ra, &dec))) n++;
+
+  make_observer_on_surface(10.0, 20.0, 0.0, 0.0, 1000.0, &obs);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(check("hor_to_app_array:frame", -1, novas_hor_to_app_array(NULL, 1, &az, &el, NULL, NOVAS_ICRS, &ra, &dec))) n++;
+  if(check("hor_to_app_array:az", -1, novas_hor_to_app_array(&frame, 1, NULL, &el, NULL, NOVAS_ICRS, &ra, &dec))) n++;
+  if(check("hor_to_app_array:el", -1, novas_hor_to_app_array(&frame, 1, &az, NULL, NULL, NOVAS_ICRS, &ra, &dec))) n++;
+  if(check("hor_to_app_array:out", -1, novas_hor_to_app_array(&frame, 1, &az, &el, NULL, NOVAS_ICRS, NULL, NULL))) n++;
+  if(check("hor_to_app_array:n", -1, novas_hor_to_app_array(&frame, -1, &az, &el, NULL, NOVAS_ICRS, &ra, &dec))) n++;
+  if(check("hor_to_app_array:sys", -1, novas_hor_to_app_array(&frame, 1, &az, &el, NULL, -1, &ra, &dec))) n++;
+
+  return n;
+}
+
+static int test_app_to_geom_array() {
+  int n = 0, saved = novas_inv_max_iter;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  double ra = 1.0, dec = 2.0, geom[3];
+  int iter = 0;
+
+  if(check("app_to_geom_array:frame:init", -1, novas_app_to_geom_array(&frame, NOVAS_ICRS, 1, &ra, &dec, NULL, geom, NULL))) n++;
+
+  make_observer_at_geocenter(&obs);
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(check("app_to_geom_array:frame", -1, novas_app_to_geom_array(NULL, NOVAS_ICRS, 1, &ra, &dec, NULL, geom, NULL))) n++;
+  if(check("app_to_geom_array:ra", -1, novas_app_to_geom_array(&frame, NOVAS_ICRS, 1, NULL, &dec, NULL, geom, NULL))) n++;
+  if(check("app_to_geom_array:dec", -1, novas_app_to_geom_array(&frame, NOVAS_ICRS, 1, &ra, NULL, NULL, geom, NULL))) n++;
+  if(check("app_to_geom_array:geom", -1, novas_app_to_geom_array(&frame, NOVAS_ICRS, 1, &ra, &dec, NULL, NULL, NULL))) n++;
+  if(check("app_to_geom_array:n", -1, novas_app_to_geom_array(&frame, NOVAS_ICRS, -1, &ra, &dec, NULL, geom, NULL))) n++;
+  if(check("app_to_geom_array:sys", -1, novas_app_to_geom_array(&frame, -1, 1, &ra, &dec, NULL, geom, NULL))) n++;
+
+  novas_inv_max_iter = 1;
+  if(check("app_to_geom_array:converge", -1, novas_app_to_geom_array(&frame, NOVAS_ICRS, 1, &ra, &dec, NULL, geom, &iter))) n++;
+  if(check("app_to_geom_array:converge:nan", 1, isnan(geom[0]) && iter == 2)) n++;
+  novas_inv_max_iter = saved;
+
+  return n;
+}
+
+static int test_field_transform() {
+  int n = 0;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_field_transform field = {};
+  double ra = 1.0, dec = 2.0, lon, lat;
+
+  if(check("field_transform:frame:init", -1, novas_make_field_transform(&frame, NOVAS_TOD, 1.0, 2.0, 1.0, &field))) n++;
+
+  make_observer_at_geocenter(&obs);
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(check("field_transform:frame", -1, novas_make_field_transform(NULL, NOVAS_TOD, 1.0, 2.0, 1.0, &field))) n++;
+  if(check("field_transform:field", -1, novas_make_field_transform(&frame, NOVAS_TOD, 1.0, 2.0, 1.0, NULL))) n++;
+  if(check("field_transform:sys", -1, novas_make_field_transform(&frame, -1, 1.0, 2.0, 1.0, &field))) n++;
+  if(check("field_transform:sys:hi", -1, novas_make_field_transform(&frame, NOVAS_REFERENCE_SYSTEMS, 1.0, 2.0, 1.0, &field))) n++;
+  if(check("field_transform:ra:nan", -1, novas_make_field_transform(&frame, NOVAS_TOD, NAN, 2.0, 1.0, &field))) n++;
+  if(check("field_transform:dec", -1, novas_make_field_transform(&frame, NOVAS_TOD, 1.0, 90.1, 1.0, &field))) n++;
+  if(check("field_transform:dec:nan", -1, novas_make_field_transform(&frame, NOVAS_TOD, 1.0, NAN, 1.0, &field))) n++;
+  if(check("field_transform:radius:0", -1, novas_make_field_transform(&frame, NOVAS_TOD, 1.0, 2.0, 0.0, &field))) n++;
+  if(check("field_transform:radius:nan", -1, novas_make_field_transform(&frame, NOVAS_TOD, 1.0, 2.0, NAN, &field))) n++;
+  if(check("field_transform:radius:hi", -1, novas_make_field_transform(&frame, NOVAS_TOD, 1.0, 2.0, NOVAS_FIELD_MAX_RADIUS + 0.1, &field))) n++;
+
+  if(check("field_transform:hor:frame", -1, novas_make_hor_field_transform(NULL, NULL, 1.0, 2.0, 1.0, &field))) n++;
+  if(check("field_transform:hor:geocenter", -1, novas_make_hor_field_transform(&frame, NULL, 1.0, 2.0, 1.0, &field))) n++;
+
+  novas_make_field_transform(&frame, NOVAS_TOD, 1.0, 2.0, 1.0, &field);
+
+  if(check("field_apply:field", -1, novas_field_apply(NULL, 1, &ra, &dec, &lon, &lat))) n++;
+  if(check("field_apply:ra", -1, novas_field_apply(&field, 1, NULL, &dec, &lon, &lat))) n++;
+  if(check("field_apply:dec", -1, novas_field_apply(&field, 1, &ra, NULL, &lon, &lat))) n++;
+  if(check("field_apply:out", -1, novas_field_apply(&field, 1, &ra, &dec, NULL, NULL))) n++;
+  if(check("field_apply:n", -1, novas_field_apply(&field, -1, &ra, &dec, &lon, &lat))) n++;
+
+  if(check("field_apply_offsets:field", -1, novas_field_apply_offsets(NULL, 1, &ra, &dec, &lon, &lat))) n++;
+  if(check("field_apply_offsets:x", -1, novas_field_apply_offsets(&field, 1, NULL, &dec, &lon, &lat))) n++;
+  if(check("field_apply_offsets:y", -1, novas_field_apply_offsets(&field, 1, &ra, NULL, &lon, &lat))) n++;
+  if(check("field_apply_offsets:out_x", -1, novas_field_apply_offsets(&field, 1, &ra, &dec, NULL, &lat))) n++;
+  if(check("field_apply_offsets:out_y", -1, novas_field_apply_offsets(&field, 1, &ra, &dec, &lon, NULL))) n++;
+  if(check("field_apply_offsets:n", -1, novas_field_apply_offsets(&field, -1, &ra, &dec, &lon, &lat))) n++;
+
+  return n;
+}
+
+static int test_hor_positions_f32() {
+  int n = 0;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  float x = 1.0f, y = 0.0f, z = 0.0f, az, el;
+
+  if(check("hor_positions_f32:frame:init", -1, novas_hor_positions_f32(&frame, 1, &x, &y, &z, NULL, &az, &el))) n++;
+
+  make_observer_at_geocenter(&obs);
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(check("hor_positions_f32:frame", -1, novas_hor_positions_f32(NULL, 1, &x, &y, &z, NULL, &az, &el))) n++;
+  if(check("hor_positions_f32:x", -1, novas_hor_positions_f32(&frame, 1, NULL, &y, &z, NULL, &az, &el))) n++;
+  if(check("hor_positions_f32:y", -1, novas_hor_positions_f32(&frame, 1, &x, NULL, &z, NULL, &az, &el))) n++;
+  if(check("hor_positions_f32:z", -1, novas_hor_positions_f32(&frame, 1, &x, &y, NULL, NULL, &az, &el))) n++;
+  if(check("hor_positions_f32:out", -1, novas_hor_positions_f32(&frame, 1, &x, &y, &z, NULL, NULL, NULL))) n++;
+  if(check("hor_positions_f32:n", -1, novas_hor_positions_f32(&frame, -1, &x, &y, &z, NULL, &az, &el))) n++;
+  if(check("hor_positions_f32:geocenter", -1, novas_hor_positions_f32(&frame, 1, &x, &y, &z, NULL, &az, &el))) n++;
+
+  return n;
+}
+
+static int test_make_lazy_frame() {
+  int n = 0;
+  novas_timespec ts = NOVAS_TIMESPEC_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+
+  if(check("make_lazy_frame:obs", -1, novas_make_lazy_frame(NOVAS_REDUCED_ACCURACY, NULL, &ts, 0.0, 0.0, &frame))) n++;
+  if(check("make_lazy_frame:time", -1, novas_make_lazy_frame(NOVAS_REDUCED_ACCURACY, &obs, NULL, 0.0, 0.0, &frame))) n++;
+  if(check("make_lazy_frame:frame", -1, novas_make_lazy_frame(NOVAS_REDUCED_ACCURACY, &obs, &ts, 0.0, 0.0, NULL))) n++;
+  if(check("make_lazy_frame:accuracy:-1", -1, novas_make_lazy_frame(-1, &obs, &ts, 0.0, 0.0, &frame))) n++;
+  if(check("make_lazy_frame:accuracy:3", -1, novas_make_lazy_frame(NOVAS_FAST_ACCURACY + 1, &obs, &ts, 0.0, 0.0, &frame))) n++;
+
+  if(check("frame_evaluate:frame", -1, novas_frame_evaluate(NULL))) n++;
+  if(check("frame_evaluate:frame:init", -1, novas_frame_evaluate(&frame))) n++;
+
+  return n;
+}
+
+static int test_context() {
+  int n = 0;
+  novas_context ctx = NOVAS_CONTEXT_INIT;
+  double x = 0.0, y = 0.0, p[3] = {0.0};
+  long hits = 0, misses = 0;
+
+  if(check("init_context", -1, novas_init_context(NULL))) n++;
+  if(check("reset_cache_stats", -1, novas_reset_cache_stats(NULL))) n++;
+  if(check("get_cache_stats:ctx", -1, novas_get_cache_stats(NULL, NOVAS_GAST_CACHE, &hits, &misses))) n++;
+  if(check("get_cache_stats:cache:-1", -1, novas_get_cache_stats(&ctx, -1, &hits, &misses))) n++;
+  if(check("get_cache_stats:cache:hi", -1, novas_get_cache_stats(&ctx, NOVAS_CONTEXT_CACHES, &hits, &misses))) n++;
+
+  if(check("nutation_angles_ctx:ctx", -1, nutation_angles_ctx(NULL, 0.0, NOVAS_FULL_ACCURACY, &x, &y))) n++;
+  if(check("nutation_angles_ctx:dpsi", -1, nutation_angles_ctx(&ctx, 0.0, NOVAS_FULL_ACCURACY, NULL, &y))) n++;
+  if(check("nutation_angles_ctx:deps", -1, nutation_angles_ctx(&ctx, 0.0, NOVAS_FULL_ACCURACY, &x, NULL))) n++;
+  if(check("nutation_angles_ctx:accuracy:-1", -1, nutation_angles_ctx(&ctx, 0.0, (enum novas_accuracy) -1, &x, &y))) n++;
+  if(check("nutation_angles_ctx:accuracy:hi", -1, nutation_angles_ctx(&ctx, 0.0, (enum novas_accuracy) (NOVAS_FAST_ACCURACY + 1), &x, &y))) n++;
+
+  if(check("e_tilt_ctx:ctx", -1, e_tilt_ctx(NULL, NOVAS_JD_J2000, NOVAS_FULL_ACCURACY, NULL, NULL, &x, NULL, NULL))) n++;
+  if(check("e_tilt_ctx:accuracy", -1, e_tilt_ctx(&ctx, NOVAS_JD_J2000, NOVAS_FAST_ACCURACY, NULL, NULL, &x, NULL, NULL))) n++;
+
+  if(check("precession_ctx:ctx", -1, precession_ctx(NULL, NOVAS_JD_J2000, p, NOVAS_JD_B1950, p))) n++;
+  if(check("precession_ctx:in", -1, precession_ctx(&ctx, NOVAS_JD_J2000, NULL, NOVAS_JD_B1950, p))) n++;
+  if(check("precession_ctx:out", -1, precession_ctx(&ctx, NOVAS_JD_J2000, p, NOVAS_JD_B1950, NULL))) n++;
+
+  if(check("spin_ctx:ctx", -1, spin_ctx(NULL, 1.0, p, p))) n++;
+  if(check("spin_ctx:in", -1, spin_ctx(&ctx, 1.0, NULL, p))) n++;
+  if(check("spin_ctx:out", -1, spin_ctx(&ctx, 1.0, p, NULL))) n++;
+
+  if(check_nan("gast_ctx:ctx", novas_gast_ctx(NULL, NOVAS_JD_J2000, 69.184, NOVAS_FULL_ACCURACY))) n++;
+  if(check_nan("gast_ctx:accuracy", novas_gast_ctx(&ctx, NOVAS_JD_J2000, 69.184, NOVAS_FAST_ACCURACY))) n++;
+  if(check_nan("tt2tdb_hp_ctx:ctx", tt2tdb_hp_ctx(NULL, NOVAS_JD_J2000))) n++;
+
+  return n;
+}
+
+static int test_simd() {
+  int n = 0;
+  const enum novas_simd max = novas_max_simd();
+
+  if(check("simd:set:-1", -1, novas_set_simd((enum novas_simd) -1))) n++;
+  if(check("simd:set:hi", -1, novas_set_simd(NOVAS_SIMD_LEVELS))) n++;
+  if(max < NOVAS_SIMD_AVX512)
+    if(check("simd:set:unsupported", -1, novas_set_simd((enum novas_simd) (max + 1)))) n++;
+
+  if(check("simd:unchanged", max, novas_get_simd())) n++;
+
+  return n;
+}
+
+static int test_profile() {
+  int n = 0;
+
+  if(check("profile:get:null", -1, novas_get_profile(NULL))) n++;
+
+  return n;
+}
+
 int main(int argc, const char *argv[]) {
   int n = 0;
 
@@ -2734,6 +3410,30 @@ int main(int argc, const char *argv[]) {
   if(test_enu_to_itrs()) n++;
   if(test_itrs_to_enu()) n++;
 
+  if(test_find_events()) n++;
+  if(test_hor_grid()) n++;
+  if(test_sky_index()) n++;
+  if(test_xmatch()) n++;
+  if(test_star_catalog()) n++;
+  if(test_parse_radec_table()) n++;
+  if(test_parse_iso_times()) n++;
+  if(test_iso_timestamps()) n++;
+  if(test_leap_seconds()) n++;
+  if(test_unix_to_jd()) n++;
+  if(test_eop_table()) n++;
+  if(test_diurnal_eop_table()) n++;
+  if(test_tdb_table()) n++;
+  if(test_ns_time()) n++;
+  if(test_sidereal_clock()) n++;
+  if(test_transform_vectors()) n++;
+  if(test_hor_to_app_array()) n++;
+  if(test_app_to_geom_array()) n++;
+  if(test_field_transform()) n++;
+  if(test_hor_positions_f32()) n++;
+  if(test_make_lazy_frame()) n++;
+  if(test_context()) n++;
+  if(test_simd()) n++;
+  if(test_profile()) n++;
   if(n) fprintf(stderr, " -- FAILED %d tests\n", n);
   else fprintf(stderr, " -- OK\n");
 
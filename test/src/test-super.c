@@ -4920,6 +4920,1900 @@ static int test_enu_itrs() {
   return n;
 }
 
+static int test_find_events_sun() {
+  int n = 0, i, k;
+
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  object sun = NOVAS_SUN_INIT;
+  novas_event_finder finder = NOVAS_EVENT_FINDER_INIT;
+  novas_event events[10];
+  double rise, set, transit;
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 0.0, 0.0, 0.0, &obs);
+  if(!is_ok("find_events:sun:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) n++;
+
+  rise = novas_rises_above(0.0, &sun, &frame, NULL);
+  set = novas_sets_below(0.0, &sun, &frame, NULL);
+  transit = novas_transit_time(&sun, &frame);
+
+  finder.func = novas_event_elevation;
+  finder.arg = &sun;
+  finder.level = 0.0;
+  finder.types = NOVAS_EVENT_ANY;
+
+  k = novas_find_events(&finder, &frame, 1.0, events, 10);
+  if(!is_equal("find_events:sun:count", k, 4, 1e-6)) n++;
+
+  for(i = 0; i < k && i < 10; i++) {
+    double utc = novas_get_time(&events[i].time, NOVAS_UTC);
+
+    if(i > 0 && !is_ok("find_events:sun:order", events[i].dt < events[i-1].dt)) n++;
+
+    switch(events[i].type) {
+      case NOVAS_EVENT_RISING:
+        if(!is_equal("find_events:sun:rise", utc, rise, 1e-6)) n++;
+        break;
+      case NOVAS_EVENT_FALLING:
+        if(!is_equal("find_events:sun:set", utc, set, 1e-6)) n++;
+        break;
+      case NOVAS_EVENT_MAXIMUM:
+        // Max elevation is within a minute of transit
+        if(!is_equal("find_events:sun:max", utc, transit, 1e-3)) n++;
+        if(!is_ok("find_events:sun:max:value", events[i].value < 45.0 || events[i].value > 75.0)) n++;
+        break;
+      case NOVAS_EVENT_MINIMUM:
+        if(!is_ok("find_events:sun:min:value", events[i].value > -25.0)) n++;
+        break;
+    }
+  }
+
+  // Only rising, with truncated output.
+  finder.types = NOVAS_EVENT_RISING;
+  k = novas_find_events(&finder, &frame, 2.0, events, 1);
+  if(!is_equal("find_events:sun:rise:count", k, 2, 1e-6)) n++;
+  if(!is_equal("find_events:sun:rise:type", events[0].type, NOVAS_EVENT_RISING, 1e-6)) n++;
+  if(!is_equal("find_events:sun:rise:first", novas_get_time(&events[0].time, NOVAS_UTC), rise, 1e-6)) n++;
+
+  // Count only
+  k = novas_find_events(&finder, &frame, 2.0, NULL, 0);
+  if(!is_equal("find_events:sun:rise:count-only", k, 2, 1e-6)) n++;
+
+  // Astronomical twilight
+  finder.level = -18.0;
+  finder.types = NOVAS_EVENT_CROSSING;
+  k = novas_find_events(&finder, &frame, 1.0, events, 10);
+  if(!is_equal("find_events:sun:twilight:count", k, 2, 1e-6)) n++;
+  if(!is_equal("find_events:sun:twilight:value", events[0].value, -18.0, 1e-6)) n++;
+  if(!is_equal("find_events:sun:twilight:el", novas_event_elevation(&frame, &sun) > -18.0, 1, 1e-6)) n++;
+
+  return n;
+}
+
+static int test_find_events_moon_phase() {
+  int n = 0, k;
+
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  novas_event_finder finder = NOVAS_EVENT_FINDER_INIT;
+  novas_event events[4];
+  double jd0 = novas_jd_from_date(NOVAS_ASTRONOMICAL_CALENDAR, 2025, 5, 03, 0.0);
+
+  novas_set_time(NOVAS_TDB, jd0, 37, 0.0, &time);
+  make_observer_at_geocenter(&obs);
+  if(!is_ok("find_events:moon_phase:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) n++;
+
+  finder.func = novas_event_moon_phase;
+  finder.period = 360.0;
+  finder.step = 1.0;
+
+  // New moon (phase wraps through +/- 180 at full moon, which must not be reported)
+  finder.level = 0.0;
+  finder.types = NOVAS_EVENT_CROSSING;
+  k = novas_find_events(&finder, &frame, 30.0, events, 4);
+  if(!is_equal("find_events:moon_phase:new:count", k, 1, 1e-6)) n++;
+  if(!is_equal("find_events:moon_phase:new:type", events[0].type, NOVAS_EVENT_RISING, 1e-6)) n++;
+  if(!is_equal("find_events:moon_phase:new", novas_get_time(&events[0].time, NOVAS_TDB), novas_next_moon_phase(0.0, jd0), 1e-5)) n++;
+
+  // Full moon
+  finder.level = 180.0;
+  k = novas_find_events(&finder, &frame, 30.0, events, 4);
+  if(!is_equal("find_events:moon_phase:full:count", k, 1, 1e-6)) n++;
+  if(!is_equal("find_events:moon_phase:full", novas_get_time(&events[0].time, NOVAS_TDB), novas_next_moon_phase(180.0, jd0), 1e-5)) n++;
+
+  // 1st and 3rd quarters
+  finder.level = 90.0;
+  k = novas_find_events(&finder, &frame, 30.0, events, 4);
+  if(!is_equal("find_events:moon_phase:1st:count", k, 1, 1e-6)) n++;
+  if(!is_equal("find_events:moon_phase:1st", novas_get_time(&events[0].time, NOVAS_TDB), novas_next_moon_phase(90.0, jd0), 1e-5)) n++;
+
+  finder.level = -90.0;
+  k = novas_find_events(&finder, &frame, 30.0, events, 4);
+  if(!is_equal("find_events:moon_phase:3rd:count", k, 1, 1e-6)) n++;
+  if(!is_equal("find_events:moon_phase:3rd", novas_get_time(&events[0].time, NOVAS_TDB), novas_next_moon_phase(-90.0, jd0), 1e-5)) n++;
+
+  return n;
+}
+
+static int test_find_events_conjunction() {
+  int n = 0, k;
+
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  novas_event_finder finder = NOVAS_EVENT_FINDER_INIT;
+  novas_event events[4];
+  object pair[2];
+  double sep;
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &time);
+  make_observer_at_geocenter(&obs);
+  if(!is_ok("find_events:conjunction:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) n++;
+
+  // A catalog source near the Sun's path, and the Sun
+  make_planet(NOVAS_SUN, &pair[0]);
+  make_redshifted_object("test", 20.0, -20.0, 0.0, &pair[1]);
+
+  finder.func = novas_event_separation;
+  finder.arg = pair;
+  finder.types = NOVAS_EVENT_MINIMUM;
+  finder.step = 2.0;
+
+  k = novas_find_events(&finder, &frame, 60.0, events, 4);
+  if(!is_equal("find_events:conjunction:count", k, 1, 1e-6)) n++;
+
+  if(k == 1) {
+    novas_frame f1 = NOVAS_FRAME_INIT;
+    double dt = 0.01;
+    novas_timespec t1;
+
+    if(!is_ok("find_events:conjunction:type", events[0].type != NOVAS_EVENT_MINIMUM)) n++;
+    sep = events[0].value;
+
+    if(!is_ok("find_events:conjunction:make_frame:-", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &events[0].time, 0.0, 0.0, &f1))) n++;
+    if(!is_equal("find_events:conjunction:value", novas_event_separation(&f1, pair), sep, 1e-9)) n++;
+
+    novas_offset_time(&events[0].time, -dt * NOVAS_DAY, &t1);
+    novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &t1, 0.0, 0.0, &f1);
+    if(!is_ok("find_events:conjunction:before", novas_event_separation(&f1, pair) <= sep)) n++;
+
+    novas_offset_time(&events[0].time, dt * NOVAS_DAY, &t1);
+    novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &t1, 0.0, 0.0, &f1);
+    if(!is_ok("find_events:conjunction:after", novas_event_separation(&f1, pair) <= sep)) n++;
+  }
+
+  if(!is_equal("find_events:sun_angle", novas_event_sun_angle(&frame, &pair[1]), novas_sun_angle(&pair[1], &frame), 1e-12)) n++;
+  if(!is_equal("find_events:solar_illum", novas_event_solar_illum(&frame, &pair[1]), 1.0, 1e-12)) n++;
+
+  return n;
+}
+
+static int test_hor_grid() {
+  int n = 0, i, j;
+
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frames[3] = { NOVAS_FRAME_INIT, NOVAS_FRAME_INIT, NOVAS_FRAME_INIT };
+  const double ra[4] = { 2.5, 8.0, 14.0, 20.5 }, dec[4] = { 60.0, -10.0, 20.0, 45.0 };
+  double dirs[12], az[12], el[12], X[12], az0[12], el0[12];
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+
+  for(j = 0; j < 3; j++) {
+    novas_timespec t;
+    novas_offset_time(&time, 7200.0 * j, &t);
+    if(!is_ok("hor_grid:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &t, 0.0, 0.0, &frames[j]))) n++;
+  }
+
+  for(i = 0; i < 4; i++)
+    radec2vector(ra[i], dec[i], 1.0, &dirs[3 * i]);
+
+  if(!is_ok("hor_grid:aberrated", novas_hor_grid(frames, 3, dirs, 4, 1, NULL, az, el, X))) n++;
+
+  for(i = 0; i < 4; i++) {
+    object source;
+    make_redshifted_object("test", ra[i], dec[i], 0.0, &source);
+
+    for(j = 0; j < 3; j++) {
+      const int k = i * 3 + j;
+      sky_pos pos = SKY_POS_INIT;
+      double A, E;
+
+      novas_sky_pos(&source, &frames[j], NOVAS_TOD, &pos);
+      novas_app_to_hor(&frames[j], NOVAS_TOD, pos.ra, pos.dec, NULL, &A, &E);
+
+      if(!is_equal("hor_grid:el", el[k], E, 3e-5)) n++;
+      if(!is_equal("hor_grid:az", remainder(az[k] - A, DEG360) * cos(E * DEGREE), 0.0, 3e-5)) n++;
+      if(!is_ok("hor_grid:az:range", az[k] < 0.0 || az[k] >= DEG360)) n++;
+
+      if(el[k] < 0.0) {
+        if(!is_ok("hor_grid:airmass:below", !isnan(X[k]))) n++;
+      }
+      else if(!is_equal("hor_grid:airmass", X[k], novas_airmass(el[k]), 1e-12)) n++;
+    }
+  }
+
+  // Geometric directions, az/el only
+  if(!is_ok("hor_grid:geometric", novas_hor_grid(frames, 3, dirs, 4, 0, NULL, az0, el0, NULL))) n++;
+  for(i = 0; i < 12; i++) {
+    double d = novas_sep(az[i], el[i], az0[i], el0[i]) * 3600.0;
+    if(!is_ok("hor_grid:geometric:aberration", d < 1.0 || d > 21.0)) n++;
+  }
+
+  // Refracted elevations
+  if(!is_ok("hor_grid:refracted", novas_hor_grid(frames, 3, dirs, 4, 1, novas_standard_refraction, NULL, el0, NULL))) n++;
+  for(i = 0; i < 12; i++) {
+    if(el[i] < 5.0) continue;
+    if(!is_equal("hor_grid:refracted:el", el0[i] - el[i],
+            novas_standard_refraction(0.0, &obs.on_surf, NOVAS_REFRACT_ASTROMETRIC, el[i]), 1e-6)) n++;
+  }
+
+  return n;
+}
+
+static int test_airmass() {
+  int n = 0;
+
+  if(!is_equal("airmass:zenith", novas_airmass(90.0), 1.0, 1e-3)) n++;
+  if(!is_equal("airmass:30", novas_airmass(30.0), 2.0, 1e-2)) n++;
+  if(!is_equal("airmass:horizon", novas_airmass(0.0), 38.0, 0.1)) n++;
+  if(!is_ok("airmass:below", !isnan(novas_airmass(-1.0)))) n++;
+
+  return n;
+}
+
+static int sky_index_has(const int *src, int n, int i) {
+  int k;
+  for(k = 0; k < n; k++) if(src[k] == i) return 1;
+  return 0;
+}
+
+static int test_sky_index() {
+  int n = 0, i, k, l, m;
+
+  const int N = 2000;
+  cat_entry *cat = (cat_entry *) calloc(N, sizeof(cat_entry));
+  int *src = (int *) calloc(N, sizeof(int));
+  int *near = (int *) calloc(N, sizeof(int));
+  novas_sky_index index = NOVAS_SKY_INDEX_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  double dir[3];
+
+  for(i = 0; i < N; i++) {
+    double f = fmod(0.6180339887 * i, 1.0);
+    make_cat_entry("test", "TST", i, fmod(7.31 * i, 24.0), asin(2.0 * f - 1.0) / DEGREE, 10.0, -20.0, 2.0, 0.0, &cat[i]);
+  }
+
+  for(l = 0; l <= 5; l += 5) {
+    if(!is_ok("sky_index:make", novas_make_sky_index(cat, N, l, &index))) n++;
+    if(!is_equal("sky_index:cells", index.cell[8L << (2 * l)], N, 1e-6)) n++;
+
+    radec2vector(3.0, 20.0, 1.0, dir);
+
+    for(k = 0; k <= 180; k += 30) {
+      int exp = 0;
+
+      m = novas_sky_index_cone(&index, dir, k, src, N);
+
+      for(i = 0; i < N; i++) {
+        double p[3];
+        radec2vector(cat[i].ra, cat[i].dec, 1.0, p);
+        if(novas_vdot(p, dir) >= cos(k * DEGREE)) {
+          exp++;
+          if(!is_ok("sky_index:cone:member", !sky_index_has(src, m, i))) n++;
+        }
+      }
+
+      if(!is_equal("sky_index:cone:count", m, exp, 1e-6)) n++;
+    }
+
+    // Count only
+    if(!is_equal("sky_index:cone:all", novas_sky_index_cone(&index, dir, 180.0, NULL, 0), N, 1e-6)) n++;
+
+    // Truncated
+    if(!is_equal("sky_index:cone:trunc", novas_sky_index_cone(&index, dir, 180.0, src, 10), N, 1e-6)) n++;
+
+    novas_free_sky_index(&index);
+  }
+
+  if(!is_ok("sky_index:free", index.cell != NULL)) n++;
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(!is_ok("sky_index:make:6", novas_make_sky_index(cat, N, 6, &index))) n++;
+
+  k = novas_sky_index_above(&index, &frame, 30.0, src, N);
+  if(!is_ok("sky_index:above:fraction", k <= 0 || k >= N / 2)) n++;
+
+  m = novas_sky_index_near(&index, &frame, NOVAS_TOD, 6.0, -30.0, 10.0, near, N);
+  if(!is_ok("sky_index:near:fraction", m <= 0 || m >= N / 50)) n++;
+
+  for(i = 0; i < N; i++) {
+    object source;
+    sky_pos pos = SKY_POS_INIT;
+    double el;
+
+    make_cat_object(&cat[i], &source);
+    novas_sky_pos(&source, &frame, NOVAS_TOD, &pos);
+    novas_app_to_hor(&frame, NOVAS_TOD, pos.ra, pos.dec, NULL, NULL, &el);
+
+    if(el > 30.0 && !is_ok("sky_index:above:member", !sky_index_has(src, k, i))) n++;
+
+    if(novas_sep(15.0 * pos.ra, pos.dec, 15.0 * 6.0, -30.0) < 10.0)
+      if(!is_ok("sky_index:near:member", !sky_index_has(near, m, i))) n++;
+  }
+
+  if(!is_equal("sky_index:near:count", novas_sky_index_near(&index, &frame, NOVAS_TOD, 6.0, -30.0, 10.0, NULL, 0), m, 1e-6)) n++;
+
+  novas_free_sky_index(&index);
+  novas_free_sky_index(NULL);
+
+  free(near);
+  free(src);
+  free(cat);
+
+  return n;
+}
+
+static int test_xmatch() {
+  int n = 0, i, k, t;
+
+  const int N = 3000;
+  cat_entry *a = (cat_entry *) calloc(N, sizeof(cat_entry));
+  cat_entry *b = (cat_entry *) calloc(N, sizeof(cat_entry));
+  novas_xmatch_pair *m = (novas_xmatch_pair *) calloc(4 * N, sizeof(novas_xmatch_pair));
+  novas_xmatch_pair *m1 = (novas_xmatch_pair *) calloc(2 * N, sizeof(novas_xmatch_pair));
+  double *ua = (double *) calloc(3 * N, sizeof(double));
+  double *ub = (double *) calloc(3 * N, sizeof(double));
+  novas_zone_catalog za = NOVAS_ZONE_CATALOG_INIT, zb = NOVAS_ZONE_CATALOG_INIT;
+  const double jd = NOVAS_JD_J2000 + 20.0 * 365.25;
+  int nall = 0;
+
+  // Catalog b: the same sources, at a different epoch (2020), with small offsets.
+  for(i = 0; i < N; i++) {
+    double f = fmod(0.6180339887 * i, 1.0), ra = fmod(7.31 * i, 24.0), dec = asin(2.0 * f - 1.0) / DEGREE;
+
+    if(i % 100 == 0) dec = 89.9 - 0.001 * i / 100;        // near pole
+    if(i % 100 == 1) ra = 23.99999;                       // near RA wrap
+
+    make_cat_entry("a", "A", i, ra, dec, 100.0, -50.0, 10.0, 0.0, &a[i]);
+    make_cat_entry("b", "B", i, ra + 0.3 / (15.0 * 3600.0 * cos(dec * DEGREE)) + 20.0 * 0.1 / (15.0 * 3600.0 * cos(dec * DEGREE)),
+            dec - 20.0 * 0.05 / 3600.0, 100.0, -50.0, 10.0, 0.0, &b[i]);
+    if(b[i].ra >= 24.0) b[i].ra -= 24.0;
+  }
+
+  if(!is_ok("xmatch:make:a", novas_make_zone_catalog(a, N, NOVAS_JD_J2000, jd, 0.05, &za))) n++;
+  if(!is_ok("xmatch:make:b", novas_make_zone_catalog(b, N, jd, jd, 0.05, &zb))) n++;
+  if(!is_equal("xmatch:make:count", za.zone[za.n_zones], N, 1e-6)) n++;
+
+  for(t = 1; t <= 4; t += 3) {
+    k = novas_xmatch(&za, &zb, 1.0, NOVAS_XMATCH_BEST, t, m, 2 * N);
+    if(!is_equal("xmatch:best:count", k, N, 1e-6)) n++;
+
+    for(i = 0; i < k && i < N; i++) {
+      if(!is_equal("xmatch:best:a", m[i].a, i, 1e-6)) n++;
+      if(!is_equal("xmatch:best:b", m[i].b, i, 1e-6)) n++;
+      if(!is_equal("xmatch:best:sep", m[i].sep, 0.3, 0.02)) n++;
+    }
+
+    // Self-match
+    if(!is_equal("xmatch:self", novas_xmatch(&za, &za, 0.1, NOVAS_XMATCH_BEST, t, NULL, 0), N, 1e-6)) n++;
+  }
+
+  // All matches within 1 deg vs brute force
+  for(i = 0; i < N; i++) {
+    ua[3 * za.src[i]] = za.x[i];
+    ua[3 * za.src[i] + 1] = za.y[i];
+    ua[3 * za.src[i] + 2] = za.z[i];
+    ub[3 * zb.src[i]] = zb.x[i];
+    ub[3 * zb.src[i] + 1] = zb.y[i];
+    ub[3 * zb.src[i] + 2] = zb.z[i];
+  }
+
+  for(i = 0; i < N; i++) {
+    int j;
+    for(j = 0; j < N; j++)
+      if(novas_vdot(&ua[3 * i], &ub[3 * j]) >= cos(DEGREE)) nall++;
+  }
+
+  if(!is_equal("xmatch:all:count", novas_xmatch(&za, &zb, 3600.0, NOVAS_XMATCH_ALL, 1, NULL, 0), nall, 1e-6)) n++;
+
+  k = novas_xmatch(&za, &zb, 3600.0, NOVAS_XMATCH_ALL, 4, m1, 2 * N);
+  if(!is_equal("xmatch:all:threads", novas_xmatch(&za, &zb, 3600.0, NOVAS_XMATCH_ALL, 1, m, 2 * N), k, 1e-6)) n++;
+  for(i = 0; i < k && i < 2 * N; i++) {
+    if(!is_equal("xmatch:all:threads:a", m[i].a, m1[i].a, 1e-6)) n++;
+    if(!is_equal("xmatch:all:threads:b", m[i].b, m1[i].b, 1e-6)) n++;
+    if(i > 0 && !is_ok("xmatch:all:order", m[i].a < m[i-1].a || (m[i].a == m[i-1].a && m[i].sep < m[i-1].sep))) n++;
+    if(!is_ok("xmatch:all:sep", m[i].sep > 3600.0)) n++;
+  }
+
+  novas_free_zone_catalog(&za);
+  novas_free_zone_catalog(&zb);
+  novas_free_zone_catalog(NULL);
+
+  free(ua);
+  free(ub);
+  free(m1);
+  free(m);
+  free(b);
+  free(a);
+
+  return n;
+}
+
+static int test_star_catalog() {
+  int n = 0, i;
+
+  const char *filename = "test-starcat.bin";
+  cat_entry stars[3];
+  novas_star_catalog cat = NOVAS_STAR_CATALOG_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+
+  make_cat_entry("Alpha", "TST", 1, 2.5, 60.0, 100.0, -50.0, 10.0, 20.0, &stars[0]);
+  make_cat_entry("Beta", "TST", 2, 14.0, -30.0, 0.0, 0.0, 0.0, 0.0, &stars[1]);
+  make_cat_entry("Gamma", "TST", 3, 20.5, 5.0, -3000.0, 5000.0, 500.0, -100.0, &stars[2]);
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame);
+
+  if(!is_ok("star_catalog:write", novas_write_star_catalog(filename, stars, 3, 1))) n++;
+  if(!is_ok("star_catalog:open", novas_open_star_catalog(filename, &cat))) n++;
+  if(!is_equal("star_catalog:n", cat.n, 3, 1e-6)) n++;
+  if(!is_ok("star_catalog:meta", cat.meta == NULL)) n++;
+
+  for(i = 0; i < cat.n && i < 3; i++) {
+    object source;
+    novas_star_vec vec;
+    sky_pos ref = SKY_POS_INIT, pos = SKY_POS_INIT;
+    double p0[3], p[3];
+
+    if(!is_ok("star_catalog:meta:name", strcmp(cat.meta[i].starname, stars[i].starname))) n++;
+    if(!is_ok("star_catalog:meta:catalog", strcmp(cat.meta[i].catalog, stars[i].catalog))) n++;
+    if(!is_equal("star_catalog:meta:number", cat.meta[i].starnumber, stars[i].starnumber, 1e-6)) n++;
+
+    if(!is_ok("star_catalog:make_vec", novas_make_star_vec(&stars[i], &vec))) n++;
+    if(!is_ok("star_catalog:vec", memcmp(&vec, &cat.stars[i], sizeof(vec)))) n++;
+
+    make_cat_object(&stars[i], &source);
+    novas_sky_pos(&source, &frame, NOVAS_TOD, &ref);
+    if(!is_ok("star_catalog:sky_pos", novas_star_vec_sky_pos(&cat.stars[i], &frame, NOVAS_TOD, &pos))) n++;
+    if(!is_equal("star_catalog:sky_pos:ra", pos.ra, ref.ra, 1e-10)) n++;
+    if(!is_equal("star_catalog:sky_pos:dec", pos.dec, ref.dec, 1e-9)) n++;
+    if(!is_equal("star_catalog:sky_pos:dis", pos.dis / ref.dis, 1.0, 1e-12)) n++;
+
+    novas_geom_posvel(&source, &frame, NOVAS_CIRS, p0, NULL);
+    if(!is_ok("star_catalog:geom_pos", novas_star_vec_geom_pos(&cat.stars[i], &frame, NOVAS_CIRS, p))) n++;
+    if(!is_equal("star_catalog:geom_pos:dist", novas_vdist(p, p0) / novas_vlen(p0), 0.0, 1e-12)) n++;
+  }
+
+  novas_close_star_catalog(&cat);
+  if(!is_ok("star_catalog:close", cat.stars != NULL)) n++;
+  novas_close_star_catalog(NULL);
+
+  // Without metadata
+  if(!is_ok("star_catalog:write:nometa", novas_write_star_catalog(filename, stars, 3, 0))) n++;
+  if(!is_ok("star_catalog:open:nometa", novas_open_star_catalog(filename, &cat))) n++;
+  if(!is_ok("star_catalog:nometa", cat.meta != NULL)) n++;
+  if(cat.n == 3) {
+    novas_star_vec vec;
+    novas_make_star_vec(&stars[2], &vec);
+    if(!is_ok("star_catalog:nometa:vec", memcmp(&vec, &cat.stars[2], sizeof(vec)))) n++;
+  }
+  novas_close_star_catalog(&cat);
+
+  remove(filename);
+
+  return n;
+}
+
+static int test_parse_radec_table() {
+  int n = 0, k;
+
+  const char *csv = "# id,ra,dec\n"
+          "1,12:34:56.789,-01:02:03.45,x\r\n"
+          "2, 01 02 03 , +89 59 59.9999\n"
+          "\n"
+          "  \t\r\n"
+          "3,12h34m56.789s,-1d02m03.45s\n"
+          "4,12.5,-45.25\n"
+          "5,bad,123:00:00\n"
+          "6,1:00:00";
+  const char *ws = "a 12:34:56.789 -01:02:03.45\n \t \n  b\t1:00:00   +2:00:00.5 \n";
+  double ra[10], dec[10];
+  size_t used;
+
+  k = novas_parse_radec_table(csv, strlen(csv), ',', 1, 2, ra, dec, 10, NULL);
+  if(!is_equal("parse_radec_table:count", k, 6, 1e-6)) n++;
+  if(!is_equal("parse_radec_table:ra:0", ra[0], novas_str_hours("12:34:56.789"), 1e-12)) n++;
+  if(!is_equal("parse_radec_table:dec:0", dec[0], novas_str_degrees("-01:02:03.45"), 1e-12)) n++;
+  if(!is_equal("parse_radec_table:ra:1", ra[1], novas_str_hours("01:02:03"), 1e-12)) n++;
+  if(!is_equal("parse_radec_table:dec:1", dec[1], novas_str_degrees("89:59:59.9999"), 1e-12)) n++;
+  if(!is_equal("parse_radec_table:ra:2", ra[2], ra[0], 1e-12)) n++;
+  if(!is_equal("parse_radec_table:dec:2", dec[2], dec[0], 1e-12)) n++;
+  if(!is_equal("parse_radec_table:ra:3", ra[3], 12.5, 1e-12)) n++;
+  if(!is_equal("parse_radec_table:dec:3", dec[3], -45.25, 1e-12)) n++;
+  if(!is_ok("parse_radec_table:ra:4", !isnan(ra[4]))) n++;
+  if(!is_equal("parse_radec_table:dec:4", dec[4], 123.0, 1e-12)) n++;
+  if(!is_equal("parse_radec_table:ra:5", ra[5], 1.0, 1e-12)) n++;
+  if(!is_ok("parse_radec_table:dec:5", !isnan(dec[5]))) n++;
+
+  // Streaming: incomplete last line is left
+  k = novas_parse_radec_table(csv, strlen(csv), ',', 1, 2, ra, dec, 10, &used);
+  if(!is_equal("parse_radec_table:stream:count", k, 5, 1e-6)) n++;
+  if(!is_equal("parse_radec_table:stream:used", used, strlen(csv) - strlen("6,1:00:00"), 1e-6)) n++;
+
+  // Limited number of rows
+  k = novas_parse_radec_table(csv, strlen(csv), ',', 1, 2, ra, dec, 2, &used);
+  if(!is_equal("parse_radec_table:n_max:count", k, 2, 1e-6)) n++;
+  if(!is_ok("parse_radec_table:n_max:used", csv[used - 1] != '\n')) n++;
+  k = novas_parse_radec_table(&csv[used], strlen(csv) - used, ',', 1, 2, ra, dec, 10, NULL);
+  if(!is_equal("parse_radec_table:n_max:rest", k, 4, 1e-6)) n++;
+
+  // White-space separated, swapped columns
+  k = novas_parse_radec_table(ws, strlen(ws), 0, 2, 1, dec, ra, 10, NULL);
+  if(!is_equal("parse_radec_table:ws:count", k, 2, 1e-6)) n++;
+  if(!is_equal("parse_radec_table:ws:ra", dec[0], -novas_str_degrees("01:02:03.45"), 1e-12)) n++;
+  if(!is_equal("parse_radec_table:ws:dec", ra[1], 1.0, 1e-12)) n++;
+  if(!is_equal("parse_radec_table:ws:dec", dec[1], 2.0 + 0.5 / 3600.0, 1e-12)) n++;
+
+  // Empty
+  if(!is_equal("parse_radec_table:empty", novas_parse_radec_table(NULL, 0, ',', 0, 1, ra, dec, 10, NULL), 0, 1e-6)) n++;
+
+  return n;
+}
+
+static int test_parse_iso_times() {
+  int n = 0, i;
+  const char *str[] = {
+          "2025-01-26T19:33:08Z",
+          "2025-01-26 19:33:08.123456789",
+          "2025-01-26T21:33:08.5+02:00",
+          "2025-01-26T14:03:08-0530",
+          "1500-03-01T00:00:00.000Z",
+          "2025-01-26T19:33",              // generic fallback
+          "2024-02-29T12:00:00Z",
+          "garbage",
+          NULL
+  };
+  const int N = sizeof(str) / sizeof(char *);
+  novas_timespec t[9];
+
+  if(!is_equal("parse_iso_times", novas_parse_iso_times(str, N, NOVAS_UTC, 37, 0.1, t), N - 2, 1e-6)) n++;
+
+  for(i = 0; i < N - 2; i++) {
+    novas_timespec ref = NOVAS_TIMESPEC_INIT;
+    char label[60];
+
+    sprintf(label, "parse_iso_times:%d", i);
+    if(!is_ok(label, novas_set_time(NOVAS_UTC, novas_parse_iso_date(str[i], NULL), 37, 0.1, &ref))) n++;
+    if(!is_equal(label, novas_diff_time(&t[i], &ref), 0.0, 1e-4)) n++;
+    if(!is_equal(label, t[i].dut1, ref.dut1, 1e-8)) n++;
+  }
+
+  if(!is_equal("parse_iso_times:ns", novas_diff_time(&t[1], &t[0]), 0.123456789, 1e-9)) n++;
+
+  for(; i < N; i++) {
+    char label[60];
+    sprintf(label, "parse_iso_times:invalid:%d", i);
+    if(!is_ok(label, !isnan(t[i].fjd_tt))) n++;
+  }
+
+  if(!is_equal("parse_iso_times:tai", novas_parse_iso_times(str, 1, NOVAS_TAI, 37, 0.1, t), 1, 1e-6)) n++;
+  if(!is_equal("parse_iso_times:tai:check", novas_get_time(t, NOVAS_TAI), novas_parse_iso_date(str[0], NULL), 1e-9)) n++;
+
+  {
+    // Short and truncated strings must not be read past their termination.
+    const char *trunc[] = { "", "abc", "2025-", "2025-01-26", "2025-01-26T19:3", "2025-01-26T19:33:0" };
+    const int M = sizeof(trunc) / sizeof(char *);
+    const int valid = novas_parse_iso_times(trunc, M, NOVAS_UTC, 37, 0.1, t);
+    int m = 0;
+
+    for(i = 0; i < M; i++) {
+      char label[60];
+      double jd = novas_parse_iso_date(trunc[i], NULL);
+
+      sprintf(label, "parse_iso_times:truncated:%d", i);
+      if(isnan(jd)) {
+        if(!is_ok(label, !isnan(t[i].fjd_tt))) n++;
+      }
+      else {
+        if(!is_equal(label, novas_get_time(&t[i], NOVAS_UTC), jd, 1e-9)) n++;
+        m++;
+      }
+    }
+
+    if(!is_equal("parse_iso_times:truncated", valid, m, 1e-6)) n++;
+  }
+
+  return n;
+}
+
+static int test_iso_timestamps() {
+  int n = 0, i;
+  novas_timespec t[100];
+  char buf[100 * 32], str[32];
+
+  for(i = 0; i < 100; i++) {
+    // Spanning from ~BCE 100 to ~CE 10100, in irregular steps.
+    double jd = 1684500.0 + i * 37000.123456;
+    if(!is_ok("iso_timestamps:set_time", novas_set_time(NOVAS_UTC, jd, 37, 0.0, &t[i]))) n++;
+  }
+
+  if(!is_ok("iso_timestamps", novas_iso_timestamps(t, 100, buf, 32))) n++;
+
+  for(i = 0; i < 100; i++) {
+    char label[60];
+    sprintf(label, "iso_timestamps:check:%d", i);
+    novas_iso_timestamp(&t[i], str, sizeof(str));
+    if(!is_ok(label, strcmp(&buf[32 * i], str))) {
+      printf("### %s vs %s\n", &buf[32 * i], str);
+      n++;
+    }
+  }
+
+  t[0].fjd_tt = NAN;
+  if(!is_ok("iso_timestamps:nan", novas_iso_timestamps(t, 1, buf, 32))) n++;
+  if(!is_equal("iso_timestamps:nan:check", strlen(buf), 0, 1e-6)) n++;
+
+  return n;
+}
+
+static int test_leap_seconds() {
+  int n = 0;
+  const char *iers = "test-leap-iers.dat", *iana = "test-leap-iana.list";
+  FILE *fp;
+
+  if(!is_equal("leap_seconds:1960", novas_leap_seconds(2436934.5), 10, 1e-6)) n++;
+  if(!is_equal("leap_seconds:1972", novas_leap_seconds(2441317.5), 10, 1e-6)) n++;
+  if(!is_equal("leap_seconds:1972.5:before", novas_leap_seconds(2441499.49), 10, 1e-6)) n++;
+  if(!is_equal("leap_seconds:1972.5", novas_leap_seconds(2441499.5), 11, 1e-6)) n++;
+  if(!is_equal("leap_seconds:J2000", novas_leap_seconds(NOVAS_JD_J2000), 32, 1e-6)) n++;
+  if(!is_equal("leap_seconds:2016", novas_leap_seconds(2457753.5 - 1e-6), 36, 1e-6)) n++;
+  if(!is_equal("leap_seconds:2017", novas_leap_seconds(2457754.5), 37, 1e-6)) n++;
+  if(!is_equal("leap_seconds:2050", novas_leap_seconds(2469807.5), 37, 1e-6)) n++;
+
+  fp = fopen(iers, "w");
+  fprintf(fp, "#  File expires on 28 June 2027\n");
+  fprintf(fp, "#    MJD        Date        TAI-UTC (s)\n");
+  fprintf(fp, "#           day month year\n");
+  fprintf(fp, "    41317.0    1  1 1972       10\n");
+  fprintf(fp, "    57754.0    1  1 2017       37\n");
+  fprintf(fp, "    61041.0    1  1 2026       38\n");
+  fclose(fp);
+
+  if(!is_equal("leap_seconds:load:iers", novas_load_leap_seconds(iers), 3, 1e-6)) n++;
+  if(!is_equal("leap_seconds:load:iers:J2000", novas_leap_seconds(NOVAS_JD_J2000), 10, 1e-6)) n++;
+  if(!is_equal("leap_seconds:load:iers:2026", novas_leap_seconds(2461041.5), 38, 1e-6)) n++;
+  remove(iers);
+
+  fp = fopen(iana, "w");
+  fprintf(fp, "#@\t3960057600\n");
+  fprintf(fp, "2272060800\t10\t# 1 Jan 1972\n");
+  fprintf(fp, "3692217600\t37\t# 1 Jan 2017\n");
+  fclose(fp);
+
+  if(!is_equal("leap_seconds:load:iana", novas_load_leap_seconds(iana), 2, 1e-6)) n++;
+  if(!is_equal("leap_seconds:load:iana:2016", novas_leap_seconds(2457753.5 - 1e-6), 10, 1e-6)) n++;
+  if(!is_equal("leap_seconds:load:iana:2017", novas_leap_seconds(2457754.5), 37, 1e-6)) n++;
+  remove(iana);
+
+  if(!is_equal("leap_seconds:builtin", novas_load_leap_seconds(NULL), 28, 1e-6)) n++;
+  if(!is_equal("leap_seconds:builtin:J2000", novas_leap_seconds(NOVAS_JD_J2000), 32, 1e-6)) n++;
+
+  return n;
+}
+
+static int test_unix_to_jd() {
+  int n = 0, i;
+  const enum novas_timescale scales[] = { NOVAS_UTC, NOVAS_TAI, NOVAS_GPS, NOVAS_TT, NOVAS_TDB };
+  double t[200], jd[200], fjd[200];
+  long ijd[200];
+
+  for(i = 0; i < 200; i++)
+    t[i] = 1483228800.0 + (i - 100) * 3.3;    // across the 2017 leap second
+
+  for(i = 0; i < 5; i++) {
+    int k;
+
+    if(!is_ok("unix_to_jd", novas_unix_to_jd(t, 200, scales[i], NULL, jd))) n++;
+    if(!is_ok("unix_to_jd:split", novas_unix_to_jd(t, 200, scales[i], ijd, fjd))) n++;
+
+    for(k = 0; k < 200; k++) {
+      novas_timespec ts = NOVAS_TIMESPEC_INIT;
+      long sec = (long) floor(t[k]);
+      char label[60];
+
+      sprintf(label, "unix_to_jd:%d:%d", scales[i], k);
+      novas_set_unix_time(sec, (long) ((t[k] - sec) * 1e9), k < 100 ? 36 : 37, 0.0, &ts);
+
+      if(!is_equal(label, jd[k], novas_get_time(&ts, scales[i]), 1e-9)) n++;
+      if(!is_equal(label, (ijd[k] - ts.ijd_tt) + fjd[k], novas_get_split_time(&ts, scales[i], NULL), 1e-11)) n++;
+      if(!is_ok(label, fjd[k] < 0.0 || fjd[k] >= 1.0)) n++;
+    }
+  }
+
+  t[0] = NAN;
+  if(!is_ok("unix_to_jd:nan", novas_unix_to_jd(t, 2, NOVAS_TT, ijd, fjd))) n++;
+  if(!is_ok("unix_to_jd:nan:check", !isnan(fjd[0]))) n++;
+  if(!is_ok("unix_to_jd:nan:next", isnan(fjd[1]))) n++;
+
+  return n;
+}
+
+static double test_eop_xp(double d) {
+  return 100.0 + d * (2.0 + d * (0.1 - 0.003 * d));   // [mas], cubic
+}
+
+static double test_eop_ut1_tai(double d) {
+  return -36.5 + 1e-3 * d * (1.0 - 0.01 * d);          // [s], quadratic
+}
+
+static int test_eop_table() {
+  int n = 0, i;
+  const char *finals = "test-eop-finals.txt", *c04 = "test-eop-c04.txt", *bin = "test-eop.bin";
+  novas_eop_table table = NOVAS_EOP_TABLE_INIT, mapped = NOVAS_EOP_TABLE_INIT, eop1980 = NOVAS_EOP_TABLE_INIT;
+  novas_eop eop;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_frame frame, ref;
+  observer obs;
+  FILE *fp;
+
+  // finals2000A style, across the 2017 Jan 1 leap second (MJD 57754)
+  fp = fopen(finals, "w");
+  for(i = 0; i < 12; i++) {
+    const double mjd = 57748.0 + i;
+    const int leap = mjd < 57754.0 ? 36 : 37;
+    fprintf(fp, "%2d%2d%2d %8.2f %c %9.6f%9.6f %9.6f%9.6f  %c%10.7f%10.7f %7.4f%7.4f  %c %9.3f%9.3f %9.3f%9.3f\n",
+            16, 12, 26 + i, mjd, 'I', 1e-3 * test_eop_xp(i), 1e-5, -1e-3 * test_eop_xp(i), 1e-5, 'I',
+            test_eop_ut1_tai(i) + leap, 1e-6, 1.0, 0.01, 'I', 0.1 * i, 0.01, -0.1 * i, 0.01);
+  }
+  // A prediction without nutation offsets...
+  fprintf(fp, "%2d%2d%2d %8.2f %c %9.6f%9.6f %9.6f%9.6f  %c%10.7f%10.7f\n", 17, 1, 7, 57760.0, 'P',
+          1e-3 * test_eop_xp(12), 1e-5, -1e-3 * test_eop_xp(12), 1e-5, 'P', test_eop_ut1_tai(12) + 37, 1e-6);
+  // And one without values (end of predictions)
+  fprintf(fp, "%2d%2d%2d %8.2f %c\n", 17, 1, 8, 57761.0, 'P');
+  fclose(fp);
+
+  if(!is_ok("eop_table:read:finals", novas_read_eop_table(finals, &table))) n++;
+  if(!is_equal("eop_table:read:finals:n", table.n, 13, 1e-6)) n++;
+  if(!is_equal("eop_table:read:finals:dx:missing", table.eop[12].dx, 0.0, 1e-9)) n++;
+
+  // IAU1980 finals files have dPsi / dEps in place of dX / dY.
+  rename(finals, "finals.all");
+  if(!is_ok("eop_table:read:iau1980", novas_read_eop_table("finals.all", &eop1980))) n++;
+  if(!is_equal("eop_table:read:iau1980:n", eop1980.n, 13, 1e-6)) n++;
+  if(!is_equal("eop_table:read:iau1980:xp", eop1980.eop[5].xp, table.eop[5].xp, 1e-9)) n++;
+  if(!is_equal("eop_table:read:iau1980:dx", eop1980.eop[5].dx, 0.0, 1e-9)) n++;
+  if(!is_equal("eop_table:read:iau1980:dy", eop1980.eop[5].dy, 0.0, 1e-9)) n++;
+  novas_close_eop_table(&eop1980);
+  remove("finals.all");
+
+  for(i = 0; i <= 48; i++) {
+    const double d = 0.25 * i;
+    char label[60];
+
+    sprintf(label, "eop_table:at:%d", i);
+    if(!is_ok(label, novas_eop_at(&table, 57748.0 + d + 2400000.5, &eop))) n++;
+    if(!is_equal(label, eop.xp, test_eop_xp(d), 1e-6)) n++;
+    if(!is_equal(label, eop.yp, -test_eop_xp(d), 1e-6)) n++;
+    if(!is_equal(label, eop.dut1, test_eop_ut1_tai(d) + (d < 6.0 ? 36 : 37), 1e-7)) n++;
+    if(d <= 10.0 && !is_equal(label, eop.dx, 0.1 * d, 1e-6)) n++;
+  }
+
+  if(!is_ok("eop_table:write", novas_write_eop_table(bin, &table))) n++;
+  if(!is_ok("eop_table:open", novas_open_eop_table(bin, &mapped))) n++;
+  if(!is_equal("eop_table:open:n", mapped.n, table.n, 1e-6)) n++;
+  if(!is_ok("eop_table:open:check", memcmp(mapped.eop, table.eop, table.n * sizeof(novas_eop)))) n++;
+  remove(bin);
+
+  // Automatic EOP frame vs. explicit
+  make_observer_at_geocenter(&obs);
+  novas_set_time(NOVAS_UTC, 57752.3 + 2400000.5, 36, 0.0, &time);
+  if(!is_ok("eop_table:make_eop_frame", novas_make_eop_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, &mapped, &frame))) n++;
+  novas_eop_at(&mapped, 57752.3 + 2400000.5, &eop);
+  novas_set_time(NOVAS_UTC, 57752.3 + 2400000.5, 36, eop.dut1, &time);
+  novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, eop.xp, eop.yp, &ref);
+  if(!is_equal("eop_table:make_eop_frame:ut1_to_tt", frame.time.ut1_to_tt, ref.time.ut1_to_tt, 1e-9)) n++;
+  if(!is_equal("eop_table:make_eop_frame:dx", frame.dx, ref.dx, 1e-9)) n++;
+  if(!is_equal("eop_table:make_eop_frame:dy", frame.dy, ref.dy, 1e-9)) n++;
+  if(!is_equal("eop_table:make_eop_frame:era", frame.era, ref.era, 1e-12)) n++;
+
+  novas_set_time(NOVAS_UTC, 57800.0 + 2400000.5, 37, 0.0, &time);
+  if(!is_ok("eop_table:make_eop_frame:range", !novas_make_eop_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, &mapped, &frame))) n++;
+  if(!is_ok("eop_table:at:range:before", !novas_eop_at(&mapped, 57747.9 + 2400000.5, &eop))) n++;
+
+  novas_close_eop_table(&mapped);
+  novas_close_eop_table(&table);
+  if(!is_ok("eop_table:close", table.n != 0 || table.eop != NULL)) n++;
+
+  // EOP 14 C04 and 20 C04 styles
+  fp = fopen(c04, "w");
+  fprintf(fp, "# EOP C04 test\n");
+  fprintf(fp, "2000   1   1  51544   0.043282   0.377909   0.3554777   0.0009904   0.000076  -0.000023\n");
+  fprintf(fp, "2000   1   2  51545   0.043440   0.377531   0.3545355   0.0008977   0.000081  -0.000025\n");
+  fprintf(fp, "2000   1   3   0.00   51546.00   0.043577   0.377237   0.3536420   0.000085  -0.000029\n");
+  fclose(fp);
+
+  if(!is_ok("eop_table:read:c04", novas_read_eop_table(c04, &table))) n++;
+  if(!is_equal("eop_table:read:c04:n", table.n, 3, 1e-6)) n++;
+  if(!is_equal("eop_table:read:c04:xp", table.eop[0].xp, 43.282, 1e-9)) n++;
+  if(!is_equal("eop_table:read:c04:dx", table.eop[1].dx, 0.081, 1e-9)) n++;
+  if(!is_equal("eop_table:read:c04:dut1:20", table.eop[2].dut1, 0.3536420, 1e-9)) n++;
+  if(!is_equal("eop_table:read:c04:dy:20", table.eop[2].dy, -0.029, 1e-9)) n++;
+  if(!is_ok("eop_table:at:linear", novas_eop_at(&table, 51545.5 + 2400000.5, &eop))) n++;
+  if(!is_equal("eop_table:at:linear:yp", eop.yp, 377.384, 1e-9)) n++;
+  novas_close_eop_table(&table);
+  remove(c04);
+
+  return n;
+}
+
+static int test_diurnal_eop_table() {
+  int n = 0, i;
+  novas_diurnal_eop_table table = NOVAS_DIURNAL_EOP_TABLE_INIT;
+  novas_timespec start = NOVAS_TIMESPEC_INIT, time;
+  double x, y, t, x0, y0, t0;
+
+  novas_set_time(NOVAS_TT, 2461000.0, 37, 0.1, &start);
+
+  if(!is_ok("diurnal_eop_table:make", novas_make_diurnal_eop_table(&start, 3.0, 0.0, &table))) n++;
+  if(!is_equal("diurnal_eop_table:n", table.n, 3 * 48 + 1, 1e-6)) n++;
+  if(!is_ok("diurnal_eop_table:pole_error", table.pole_error > 1e-7)) n++;
+  if(!is_ok("diurnal_eop_table:ut1_error", table.ut1_error > 5e-9)) n++;
+
+  for(i = 0; i < 100; i++) {
+    char label[60];
+
+    time = start;
+    time.fjd_tt += 0.0299 * i;
+
+    sprintf(label, "diurnal_eop_table:interp:%d", i);
+    if(!is_ok(label, novas_diurnal_eop_from_table(&table, &time, &x, &y, &t))) n++;
+
+    novas_diurnal_eop_at_time(&time, &x0, &y0, &t0);
+    if(!is_equal(label, x, x0, table.pole_error * 1.01)) n++;
+    if(!is_equal(label, y, y0, table.pole_error * 1.01)) n++;
+    if(!is_equal(label, t, t0, table.ut1_error * 1.01)) n++;
+  }
+
+  // Outside of table range
+  time = start;
+  time.fjd_tt -= 0.01;
+  if(!is_ok("diurnal_eop_table:range:before", !novas_diurnal_eop_from_table(&table, &time, &x, NULL, NULL))) n++;
+  time.fjd_tt += 3.02;
+  if(!is_ok("diurnal_eop_table:range:after", !novas_diurnal_eop_from_table(&table, &time, &x, NULL, NULL))) n++;
+
+  // Used automatically by novas_diurnal_eop_at_time()
+  time = start;
+  time.fjd_tt += 1.01;
+  novas_diurnal_eop_at_time(&time, &x0, NULL, NULL);
+  if(!is_ok("diurnal_eop_table:set", novas_set_diurnal_eop_table(&table))) n++;
+  novas_diurnal_eop_at_time(&time, &x, NULL, NULL);
+  novas_diurnal_eop_from_table(&table, &time, &y, NULL, NULL);
+  if(!is_equal("diurnal_eop_table:set:check", x, y, 1e-15)) n++;
+  if(!is_equal("diurnal_eop_table:set:direct", x, x0, table.pole_error * 1.01)) n++;
+
+  // Outside of the table, calculated directly, without an error.
+  time.fjd_tt += 5.0;
+  errno = 0;
+  if(!is_ok("diurnal_eop_table:set:outside", novas_diurnal_eop_at_time(&time, &x, NULL, NULL))) n++;
+  if(!is_ok("diurnal_eop_table:set:outside:errno", errno)) n++;
+  if(!is_ok("diurnal_eop_table:set:outside:x", isnan(x))) n++;
+  time.fjd_tt -= 5.0;
+
+  novas_free_diurnal_eop_table(&table);
+  if(!is_ok("diurnal_eop_table:free", table.data != NULL || table.n != 0)) n++;
+
+  // No longer in use after free.
+  time.fjd_tt += 1e-3;
+  novas_diurnal_eop_at_time(&time, &x, NULL, NULL);
+  if(!is_ok("diurnal_eop_table:free:unset", isnan(x))) n++;
+
+  if(!is_ok("diurnal_eop_table:make:step", novas_make_diurnal_eop_table(&start, 0.1, 1.0, &table))) n++;
+  if(!is_equal("diurnal_eop_table:make:step:n", table.n, 4, 1e-6)) n++;
+  novas_free_diurnal_eop_table(&table);
+
+  return n;
+}
+
+static int test_tdb_table() {
+  int n = 0, i;
+  novas_tdb_table table = NOVAS_TDB_TABLE_INIT;
+  const double jd0 = NOVAS_JD_J2000 - 3650.0;
+  long ijd[100];
+  double fjd[100], out[100];
+
+  if(!is_ok("tdb_table:make", novas_make_tdb_table(jd0, 7300.0, 0.0, &table))) n++;
+  if(!is_equal("tdb_table:n", table.n, 7300 / 16 + 1, 1e-6)) n++;
+  if(!is_ok("tdb_table:max_error", table.max_error > 1e-11)) n++;
+
+  for(i = 0; i < 100; i++) {
+    double jd = jd0 + 73.0 * i + 0.123 * i;
+    char label[60];
+
+    sprintf(label, "tdb_table:tt2tdb:%d", i);
+    if(!is_equal(label, novas_tt2tdb_table(&table, jd), tt2tdb_hp(jd), 1e-11)) n++;
+
+    ijd[i] = (long) floor(jd);
+    fjd[i] = jd - ijd[i];
+  }
+
+  if(!is_equal("tdb_table:end", novas_tt2tdb_table(&table, jd0 + 7300.0), tt2tdb_hp(jd0 + 7300.0), 1e-11)) n++;
+
+  for(i = 0; i < 3; i++) {
+    static const enum novas_timescale scales[] = { NOVAS_TDB, NOVAS_TCB, NOVAS_TCG };
+    int k;
+
+    if(!is_ok("tdb_table:convert", novas_convert_tt_times(&table, 100, ijd, fjd, scales[i], out))) n++;
+
+    for(k = 0; k < 100; k++) {
+      novas_timespec t = NOVAS_TIMESPEC_INIT;
+      char label[60];
+
+      sprintf(label, "tdb_table:convert:%d:%d", scales[i], k);
+      novas_set_split_time(NOVAS_TT, ijd[k], fjd[k], 37, 0.0, &t);
+      if(!is_equal(label, (out[k] - novas_get_split_time(&t, scales[i], NULL)) * 86400.0, 0.0, 1e-9)) n++;
+    }
+  }
+
+  // Full JDs, in-place, and TT
+  for(i = 0; i < 100; i++)
+    out[i] = ijd[i] + fjd[i];
+  if(!is_ok("tdb_table:convert:tt", novas_convert_tt_times(NULL, 100, NULL, out, NOVAS_TT, out))) n++;
+  if(!is_equal("tdb_table:convert:tt:check", out[10], ijd[10] + fjd[10], 1e-12)) n++;
+  if(!is_ok("tdb_table:convert:jd", novas_convert_tt_times(&table, 100, NULL, out, NOVAS_TDB, out))) n++;
+  if(!is_equal("tdb_table:convert:jd:check", out[10], ijd[10] + fjd[10] + tt2tdb_hp(ijd[10] + fjd[10]) / 86400.0, 1e-9)) n++;
+
+  novas_free_tdb_table(&table);
+  if(!is_ok("tdb_table:free", table.coeffs != NULL || table.n != 0)) n++;
+
+  return n;
+}
+
+static int test_ns_time() {
+  int n = 0, i;
+  novas_timespec t = NOVAS_TIMESPEC_INIT, t1 = NOVAS_TIMESPEC_INIT;
+  novas_tdb_table table = NOVAS_TDB_TABLE_INIT;
+  novas_ns_time ns = 0, tt[5], out[5];
+
+  static const enum novas_timescale scales[] = { NOVAS_TT, NOVAS_TAI, NOVAS_GPS, NOVAS_UTC, NOVAS_TDB, NOVAS_TCB, NOVAS_TCG };
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000, 32, 0.0, &t);
+  if(!is_ok("ns_time:get:j2000", novas_get_ns_time(&t, NOVAS_TT, &ns))) n++;
+  if(!is_equal("ns_time:get:j2000:check", ns, 0, 1e-6)) n++;
+
+  novas_set_time(NOVAS_TT, NOVAS_JD_J2000 - 0.25, 32, 0.0, &t);
+  if(!is_ok("ns_time:get:neg", novas_get_ns_time(&t, NOVAS_TT, &ns))) n++;
+  if(!is_equal("ns_time:get:neg:check", ns, -21600 * 1000000000LL, 1e-6)) n++;
+
+  if(!is_ok("ns_time:set:neg", novas_set_ns_time(NOVAS_TT, ns + 123, 32, 0.0, &t1))) n++;
+  if(!is_equal("ns_time:set:neg:check", novas_diff_time(&t1, &t), 123e-9, 1e-11)) n++;
+
+  // 2024-06-01 12:34:56.123456789 UTC
+  ns = 770517296123456789LL;
+  for(i = 0; i < 7; i++) {
+    novas_ns_time ns1 = 0;
+    char label[60];
+
+    sprintf(label, "ns_time:set:%d", scales[i]);
+    if(!is_ok(label, novas_set_ns_time(scales[i], ns, 37, 0.1, &t))) n++;
+
+    sprintf(label, "ns_time:get:%d", scales[i]);
+    if(!is_ok(label, novas_get_ns_time(&t, scales[i], &ns1))) n++;
+
+    // The inverse TCB / TCG conversions in novas_set_split_time() are first-order only.
+    sprintf(label, "ns_time:roundtrip:%d", scales[i]);
+    if(!is_equal(label, ns1 - ns, 0, scales[i] == NOVAS_TCB ? 400.0 : (scales[i] == NOVAS_TCG ? 1.01 : 1e-6))) n++;
+  }
+
+  // Offset / diff
+  if(!is_equal("ns_time:offset", novas_ns_offset(ns, 1.5e-9) - ns, 2, 1e-6)) n++;
+  if(!is_equal("ns_time:offset:neg", novas_ns_offset(ns, -0.001) - ns, -1000000, 1e-6)) n++;
+  if(!is_equal("ns_time:diff", novas_ns_diff(ns + 1234567, ns), 1.234567e-3, 1e-15)) n++;
+
+  // Batch conversion, against novas_get_ns_time()
+  novas_make_tdb_table(NOVAS_JD_J2000 + 8000.0, 1000.0, 0.0, &table);
+
+  for(i = 0; i < 5; i++) {
+    novas_set_time(NOVAS_TT, NOVAS_JD_J2000 + 8000.0 + 200.0 * i + 0.1234, 37, 0.0, &t);
+    novas_get_ns_time(&t, NOVAS_TT, &tt[i]);
+  }
+
+  for(i = 0; i < 7; i++) {
+    int k;
+
+    if(!is_ok("ns_time:convert", novas_convert_ns_times(&table, 5, tt, scales[i], out))) n++;
+
+    for(k = 0; k < 5; k++) {
+      novas_ns_time exp = 0;
+      char label[60];
+
+      novas_set_ns_time(NOVAS_TT, tt[k], 37, 0.0, &t);
+      novas_get_ns_time(&t, scales[i], &exp);
+
+      sprintf(label, "ns_time:convert:%d:%d", scales[i], k);
+      if(!is_equal(label, out[k] - exp, 0, 1.01)) n++;
+    }
+  }
+
+  // UTC across a leap second (2016-12-31 23:59:60 UTC)
+  novas_set_time(NOVAS_UTC, 2457754.5 - 0.5 / NOVAS_DAY, 36, 0.0, &t);
+  novas_get_ns_time(&t, NOVAS_TT, &tt[0]);
+  tt[1] = tt[0] + 1000000000LL;
+  tt[2] = tt[1] + 1000000000LL;
+  if(!is_ok("ns_time:convert:leap", novas_convert_ns_times(NULL, 3, tt, NOVAS_UTC, out))) n++;
+  if(!is_equal("ns_time:convert:leap:1", out[1] - out[0], 1000000000LL, 1e-6)) n++;
+  if(!is_equal("ns_time:convert:leap:2", out[2] - out[1], 0, 1e-6)) n++;
+
+  // In-place
+  if(!is_ok("ns_time:convert:inplace", novas_convert_ns_times(NULL, 3, tt, NOVAS_UTC, tt))) n++;
+  if(!is_equal("ns_time:convert:inplace:check", tt[2], out[2], 1e-6)) n++;
+
+  novas_free_tdb_table(&table);
+
+  return n;
+}
+
+static int test_sidereal_clock() {
+  int n = 0, k;
+  novas_timespec t = NOVAS_TIMESPEC_INIT;
+  novas_sidereal_clock clock;
+  on_surface site = ON_SURFACE_INIT;
+
+  site.longitude = -71.3;
+
+  for(k = 0; k < 10; k++) {
+    novas_timespec t1 = NOVAS_TIMESPEC_INIT;
+    double lst = 0.0, err;
+    char label[60];
+    int i;
+
+    novas_set_time(NOVAS_UTC, NOVAS_JD_J2000 + 1000.123 * k, 37, 0.1, &t);
+
+    sprintf(label, "sidereal_clock:init:%d", k);
+    if(!is_ok(label, novas_init_sidereal_clock(&t, &site, NOVAS_FULL_ACCURACY, 0.0, &clock))) n++;
+
+    sprintf(label, "sidereal_clock:interval:%d", k);
+    if(!is_equal(label, clock.interval, NOVAS_SIDEREAL_CLOCK_INTERVAL, 1e-12)) n++;
+
+    // novas_time_lst() is precise to ~20 us, due to the double-precision UT1 date.
+    sprintf(label, "sidereal_clock:anchor:%d", k);
+    if(!is_equal(label, remainder(clock.lst0 - novas_time_lst(&t, site.longitude, NOVAS_FULL_ACCURACY), 24.0) * 3600.0, 0.0, 3e-5)) n++;
+
+    // 1 kHz, across a re-anchoring
+    for(i = 0; i < 100000; i++)
+      lst = novas_advance_sidereal_clock(&clock, 1e-3);
+
+    err = novas_sidereal_clock_error(&clock);
+
+    sprintf(label, "sidereal_clock:elapsed:%d", k);
+    if(!is_equal(label, clock.elapsed, 40.0, 2e-3)) n++;
+
+    sprintf(label, "sidereal_clock:error:%d", k);
+    if(!is_equal(label, err, 1e-6 + clock.elapsed * NOVAS_SIDEREAL_CLOCK_DRIFT, 1e-12)) n++;
+
+    novas_offset_time(&t, 100.0, &t1);
+
+    sprintf(label, "sidereal_clock:lst:%d", k);
+    if(!is_equal(label, remainder(lst - novas_time_lst(&t1, site.longitude, NOVAS_FULL_ACCURACY), 24.0) * 3600.0, 0.0, err + 3e-5)) n++;
+
+    // Backwards
+    lst = novas_advance_sidereal_clock(&clock, -10.0);
+    novas_offset_time(&t, 90.0, &t1);
+
+    sprintf(label, "sidereal_clock:back:%d", k);
+    if(!is_equal(label, remainder(lst - novas_time_lst(&t1, site.longitude, NOVAS_FULL_ACCURACY), 24.0) * 3600.0, 0.0, err + 3e-5)) n++;
+  }
+
+  if(!is_ok("sidereal_clock:init:reduced", novas_init_sidereal_clock(&t, &site, NOVAS_REDUCED_ACCURACY, 1.0, &clock))) n++;
+  if(!is_equal("sidereal_clock:reduced", novas_advance_sidereal_clock(&clock, 1.5), novas_time_lst(&t, site.longitude, NOVAS_REDUCED_ACCURACY) + 1.5 * clock.rate, 1e-3 / 3600.0)) n++;
+  if(!is_equal("sidereal_clock:reduced:elapsed", clock.elapsed, 0.0, 1e-12)) n++;
+
+  return n;
+}
+
+static int test_transform_vectors() {
+  int n = 0, i;
+  novas_transform T = NOVAS_TRANSFORM_INIT;
+  novas_timespec ts = NOVAS_TIMESPEC_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  double in[50][4] = {{0.0}}, out[50][3] = {{0.0}}, exp[3];
+  sky_pos pos[50], pos1[50];
+
+  if(!is_ok("transform_vectors:set_time", novas_set_time(NOVAS_TDB, tdb, 32, 0.0, &ts))) return 1;
+  if(!is_ok("transform_vectors:make_observer", make_observer_at_geocenter(&obs))) return 1;
+  if(!is_ok("transform_vectors:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &ts, 20.0, 30.0, &frame))) return 1;
+  if(!is_ok("transform_vectors:make_transform", novas_make_transform(&frame, NOVAS_GCRS, NOVAS_ITRS, &T))) return 1;
+
+  for(i = 0; i < 50; i++) {
+    radec2vector(0.47 * i, 3.5 * i - 80.0, 1.0 + i, in[i]);
+    in[i][3] = -1.0;
+    radec2vector(0.47 * i, 3.5 * i - 80.0, 1.0, pos[i].r_hat);
+    vector2radec(pos[i].r_hat, &pos[i].ra, &pos[i].dec);
+    pos[i].dis = i;
+    pos[i].rv = -i;
+  }
+
+  // Strided input, contiguous output
+  if(!is_ok("transform_vectors", novas_transform_vectors(in[0], 4, 50, &T, out[0], 3))) n++;
+
+  for(i = 0; i < 50; i++) {
+    char label[60];
+
+    novas_transform_vector(in[i], &T, exp);
+    sprintf(label, "transform_vectors:%d", i);
+    if(!is_ok(label, check_equal_pos(out[i], exp, 1e-15 * vlen(exp)))) n++;
+  }
+
+  // In-place
+  if(!is_ok("transform_vectors:inplace", novas_transform_vectors(in[0], 4, 50, &T, in[0], 4))) n++;
+
+  for(i = 0; i < 50; i++) {
+    char label[60];
+
+    sprintf(label, "transform_vectors:inplace:%d", i);
+    if(!is_ok(label, check_equal_pos(in[i], out[i], 1e-15 * vlen(out[i])))) n++;
+
+    sprintf(label, "transform_vectors:inplace:pad:%d", i);
+    if(!is_equal(label, in[i][3], -1.0, 1e-15)) n++;
+  }
+
+  if(!is_ok("transform_vectors:none", novas_transform_vectors(in[0], 4, 0, &T, out[0], 3))) n++;
+
+  // sky_pos records
+  if(!is_ok("transform_sky_positions", novas_transform_sky_positions(pos, 50, &T, pos1))) n++;
+
+  for(i = 0; i < 50; i++) {
+    sky_pos p1 = pos[i];
+    char label[60];
+
+    novas_transform_sky_pos(&pos[i], &T, &p1);
+
+    sprintf(label, "transform_sky_positions:ra:%d", i);
+    if(!is_equal(label, pos1[i].ra, p1.ra, 1e-12)) n++;
+
+    sprintf(label, "transform_sky_positions:dec:%d", i);
+    if(!is_equal(label, pos1[i].dec, p1.dec, 1e-12)) n++;
+
+    sprintf(label, "transform_sky_positions:dis:%d", i);
+    if(!is_equal(label, pos1[i].dis, i, 1e-12)) n++;
+  }
+
+  if(!is_ok("transform_sky_positions:inplace", novas_transform_sky_positions(pos, 50, &T, pos))) n++;
+  if(!is_equal("transform_sky_positions:inplace:check", pos[17].dec, pos1[17].dec, 1e-12)) n++;
+
+  return n;
+}
+
+static int test_hor_to_app_array() {
+  int n = 0, i, s;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  double az[2000], el[2000], ra[2000], dec[2000];
+
+  static const enum novas_reference_system systems[] = { NOVAS_ICRS, NOVAS_J2000, NOVAS_TOD, NOVAS_CIRS, NOVAS_TIRS, NOVAS_ITRS };
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  if(!is_ok("hor_to_app_array:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 20.0, -30.0, &frame))) return 1;
+
+  for(i = 0; i < 2000; i++) {
+    az[i] = 0.1234 * i * i;
+    el[i] = -0.9 + 0.0453 * i;
+  }
+
+  for(s = 0; s < 6; s++) {
+    int k;
+
+    for(k = 0; k < 2; k++) {
+      RefractionModel model = k ? novas_optical_refraction : NULL;
+      int m;
+
+      // Both above and below the refraction table threshold
+      for(m = 0; m < 2; m++) {
+        const int N = m ? 2000 : 500;
+        char label[80];
+
+        sprintf(label, "hor_to_app_array:sys=%d:ref=%d:n=%d", systems[s], k, N);
+        if(!is_ok(label, novas_hor_to_app_array(&frame, N, az, el, model, systems[s], ra, dec))) n++;
+
+        for(i = 0; i < N; i++) {
+          double r = 0.0, d = 0.0;
+
+          novas_hor_to_app(&frame, az[i], el[i], model, systems[s], &r, &d);
+
+          sprintf(label, "hor_to_app_array:sys=%d:ref=%d:n=%d:%d", systems[s], k, N, i);
+          if(!is_equal(label, novas_equ_sep(ra[i], dec[i], r, d) * 3600.0, 0.0, (k && m) ? 2e-3 : 1e-4)) {
+            n++;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // With only one of the outputs
+  if(!is_ok("hor_to_app_array:ra", novas_hor_to_app_array(&frame, 10, az, el, NULL, NOVAS_CIRS, ra, NULL))) n++;
+  if(!is_ok("hor_to_app_array:dec", novas_hor_to_app_array(&frame, 10, az, el, NULL, NOVAS_CIRS, NULL, dec))) n++;
+  if(!is_ok("hor_to_app_array:none", novas_hor_to_app_array(&frame, 0, az, el, NULL, NOVAS_CIRS, ra, dec))) n++;
+
+  return n;
+}
+
+static int test_itrs_pole_offsets() {
+  int n = 0;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_transform T = NOVAS_TRANSFORM_INIT;
+  double pos[3] = { 1e5, -2e5, 3e5 }, geom[3] = {0.0}, v[3] = {0.0}, ra = 0.0, dec = 0.0;
+  sky_pos cirs = SKY_POS_INIT, itrs = SKY_POS_INIT;
+  int i;
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.1, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+
+  // Large pole offsets [mas], so a mas vs arcsec mixup is apparent.
+  if(!is_ok("itrs_pole_offsets:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 100.0, -200.0, &frame))) return 1;
+
+  if(!is_ok("itrs_pole_offsets:cirs", novas_geom_to_app(&frame, pos, NOVAS_CIRS, &cirs))) n++;
+  if(!is_ok("itrs_pole_offsets:itrs", novas_geom_to_app(&frame, pos, NOVAS_ITRS, &itrs))) n++;
+
+  // Same as rotating CIRS to ITRS with the frame's transform
+  novas_make_transform(&frame, NOVAS_CIRS, NOVAS_ITRS, &T);
+  novas_transform_vector(cirs.r_hat, &T, v);
+  for(i = 0; i < 3; i++)
+    if(!is_equal("itrs_pole_offsets:geom_to_app", itrs.r_hat[i], v[i], 1e-12)) n++;
+
+  // And back, from the ITRS coordinates obtained via the transform
+  vector2radec(v, &ra, &dec);
+  if(!is_ok("itrs_pole_offsets:app_to_geom", novas_app_to_geom(&frame, NOVAS_ITRS, ra, dec, cirs.dis, geom))) n++;
+  if(!is_ok("itrs_pole_offsets:app_to_geom:check", check_equal_pos(geom, pos, 1e-9 * novas_vlen(pos)))) n++;
+
+  return n;
+}
+
+static int test_app_to_geom_array() {
+  int n = 0, i, s;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  double ra[300], dec[300], dist[300], geom[900];
+  int iter[300];
+
+  static const enum novas_reference_system systems[] = { NOVAS_ICRS, NOVAS_J2000, NOVAS_TOD, NOVAS_CIRS, NOVAS_TIRS };
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  if(!is_ok("app_to_geom_array:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) return 1;
+
+  // Scattered positions at various distances, followed by a tight cluster at infinity.
+  for(i = 0; i < 300; i++) {
+    ra[i] = i < 200 ? fmod(1.37 * i, 24.0) : 21.9 + 1e-6 * i;
+    dec[i] = i < 200 ? 85.0 * sin(0.77 * i) : -12.3 + 1e-5 * i;
+    dist[i] = (i < 200 && i % 3 == 0) ? 1.0 + i : 0.0;
+  }
+
+  for(s = 0; s < 5; s++) {
+    char label[80];
+
+    sprintf(label, "app_to_geom_array:sys=%d", systems[s]);
+    if(!is_ok(label, novas_app_to_geom_array(&frame, systems[s], 300, ra, dec, dist, geom, iter))) n++;
+
+    for(i = 0; i < 300; i++) {
+      double exp[3];
+
+      novas_app_to_geom(&frame, systems[s], ra[i], dec[i], dist[i], exp);
+
+      sprintf(label, "app_to_geom_array:sys=%d:%d", systems[s], i);
+      if(!is_ok(label, check_equal_pos(&geom[3 * i], exp, 1e-12 * novas_vlen(exp)))) {
+        n++;
+        break;
+      }
+
+      sprintf(label, "app_to_geom_array:sys=%d:iter:%d", systems[s], i);
+      if(!is_ok(label, iter[i] < 1 || iter[i] > 3)) n++;
+    }
+
+    // Nearby positions are warm-started with a single evaluation.
+    sprintf(label, "app_to_geom_array:sys=%d:warm", systems[s]);
+    if(!is_equal(label, iter[250], 1, 1e-6)) n++;
+  }
+
+  // Without distances or iteration counts
+  if(!is_ok("app_to_geom_array:nodist", novas_app_to_geom_array(&frame, NOVAS_ICRS, 300, ra, dec, NULL, geom, NULL))) n++;
+  for(i = 0; i < 300; i++) {
+    double exp[3];
+    novas_app_to_geom(&frame, NOVAS_ICRS, ra[i], dec[i], 0.0, exp);
+    if(!is_ok("app_to_geom_array:nodist:check", check_equal_pos(&geom[3 * i], exp, 1e-12 * novas_vlen(exp)))) {
+      n++;
+      break;
+    }
+  }
+
+  if(!is_ok("app_to_geom_array:none", novas_app_to_geom_array(&frame, NOVAS_ICRS, 0, ra, dec, NULL, geom, NULL))) n++;
+
+  // Fast accuracy frames, with first-order aberration
+  if(!is_ok("app_to_geom_array:fast:make_frame", novas_make_frame(NOVAS_FAST_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) return n + 1;
+  if(!is_ok("app_to_geom_array:fast", novas_app_to_geom_array(&frame, NOVAS_TOD, 300, ra, dec, dist, geom, NULL))) n++;
+  for(i = 0; i < 300; i++) {
+    double exp[3];
+    novas_app_to_geom(&frame, NOVAS_TOD, ra[i], dec[i], dist[i], exp);
+    if(!is_ok("app_to_geom_array:fast:check", check_equal_pos(&geom[3 * i], exp, 1e-12 * novas_vlen(exp)))) {
+      n++;
+      break;
+    }
+  }
+
+  return n;
+}
+
+static int test_field_transform() {
+  int n = 0, i, s;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  novas_field_transform field;
+  double ra[100], dec[100], lon[100], lat[100], x = 0.0, y = 0.0;
+
+  static const enum novas_reference_system systems[] = { NOVAS_ICRS, NOVAS_J2000, NOVAS_TOD, NOVAS_CIRS, NOVAS_TIRS };
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  if(!is_ok("field_transform:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) return 1;
+
+  // Random positions inside a 1 degree field.
+  for(i = 0; i < 100; i++) {
+    const double r = 0.99 * sqrt((double) i / 100), phi = 2.4 * i;
+    dec[i] = -12.3 + r * sin(phi);
+    ra[i] = 21.9 + r * cos(phi) / (15.0 * cos(dec[i] * DEGREE));
+  }
+
+  for(s = 0; s < 5; s++) {
+    char label[80];
+
+    sprintf(label, "field_transform:sys=%d", systems[s]);
+    if(!is_ok(label, novas_make_field_transform(&frame, systems[s], 21.9, -12.3, 1.0, &field))) n++;
+
+    sprintf(label, "field_transform:sys=%d:error", systems[s]);
+    if(!is_ok(label, field.error > 1e-5)) n++;
+
+    if(!is_ok(label, novas_field_apply(&field, 100, ra, dec, lon, lat))) n++;
+
+    for(i = 0; i < 100; i++) {
+      double pos[3];
+      sky_pos exp = SKY_POS_INIT;
+
+      radec2vector(ra[i], dec[i], NOVAS_DEFAULT_DISTANCE, pos);
+      novas_geom_to_app(&frame, pos, systems[s], &exp);
+
+      sprintf(label, "field_transform:sys=%d:%d", systems[s], i);
+      if(!is_ok(label, novas_sep(lon[i] * 15.0, lat[i], exp.ra * 15.0, exp.dec) * 3600.0 > 2.0 * field.error + 1e-9)) {
+        n++;
+        break;
+      }
+    }
+  }
+
+  // The field center maps to the output center (within the fit error)
+  if(!is_ok("field_transform:center", novas_field_apply_offsets(&field, 1, &x, &y, &x, &y))) n++;
+  if(!is_equal("field_transform:center:x", x, 0.0, field.error * ARCSEC)) n++;
+  if(!is_equal("field_transform:center:y", y, 0.0, field.error * ARCSEC)) n++;
+
+  // Positions in the opposite hemisphere
+  ra[0] = 9.9;
+  dec[0] = 12.3;
+  if(!is_ok("field_transform:opposite", novas_field_apply(&field, 1, ra, dec, lon, NULL))) n++;
+  if(!is_ok("field_transform:opposite:nan", !isnan(lon[0]))) n++;
+
+  // Horizontal
+  if(!is_ok("field_transform:hor", novas_make_hor_field_transform(&frame, novas_standard_refraction, 21.9, -12.3, 1.0, &field))) n++;
+  if(!is_ok("field_transform:hor:error", field.error > 0.01)) n++;
+  if(!is_ok("field_transform:hor:apply", novas_field_apply(&field, 100, &ra[1], &dec[1], lon, lat))) n++;
+
+  for(i = 1; i < 100; i++) {
+    double pos[3], az = 0.0, el = 0.0;
+    sky_pos app = SKY_POS_INIT;
+
+    radec2vector(ra[i], dec[i], NOVAS_DEFAULT_DISTANCE, pos);
+    novas_geom_to_app(&frame, pos, NOVAS_TOD, &app);
+    novas_app_to_hor(&frame, NOVAS_TOD, app.ra, app.dec, novas_standard_refraction, &az, &el);
+
+    if(!is_ok("field_transform:hor:check", novas_sep(lon[i - 1], lat[i - 1], az, el) * 3600.0 > 2.0 * field.error + 1e-9)) {
+      n++;
+      break;
+    }
+  }
+
+  // Larger fields have larger errors, but still reported accurately.
+  if(!is_ok("field_transform:large", novas_make_field_transform(&frame, NOVAS_TOD, 21.9, -12.3, 10.0, &field))) n++;
+  if(!is_ok("field_transform:large:error", field.error < 1e-4 || field.error > 0.01)) n++;
+
+  // In-place
+  if(!is_ok("field_transform:inplace:ref", novas_field_apply(&field, 99, &ra[1], &dec[1], lon, lat))) n++;
+  if(!is_ok("field_transform:inplace", novas_field_apply(&field, 99, &ra[1], &dec[1], &ra[1], &dec[1]))) n++;
+  for(i = 0; i < 99; i++) {
+    if(!is_equal("field_transform:inplace:lon", ra[i + 1], lon[i], 1e-15)) n++;
+    if(!is_equal("field_transform:inplace:lat", dec[i + 1], lat[i], 1e-15)) n++;
+  }
+
+  return n;
+}
+
+static int test_hor_positions_f32() {
+  int n = 0, i, k;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  float x[3000], y[3000], z[3000], az[3000], el[3000];
+
+  static const int sizes[] = { 100, 3000 };
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  if(!is_ok("hor_positions_f32:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) return 1;
+
+  for(i = 0; i < 3000; i++) {
+    const double dec = asin(2.0 * (i + 0.5) / 3000 - 1.0), ra = 2.39996 * i;
+    x[i] = (float) (cos(dec) * cos(ra));
+    y[i] = (float) (cos(dec) * sin(ra));
+    z[i] = (float) sin(dec);
+  }
+
+  // Without refraction, with directly evaluated refraction, and with tabulated refraction.
+  for(k = 0; k < 3; k++) {
+    RefractionModel ref = k ? novas_standard_refraction : NULL;
+    const int N = sizes[k > 1];
+    double max = 0.0;
+    char label[80];
+
+    sprintf(label, "hor_positions_f32:%d", k);
+    if(!is_ok(label, novas_hor_positions_f32(&frame, N, x, y, z, ref, az, el))) n++;
+
+    for(i = 0; i < N; i++) {
+      double pos[3] = { x[i], y[i], z[i] }, A = 0.0, E = 0.0, d;
+      sky_pos app = SKY_POS_INIT;
+
+      novas_geom_to_app(&frame, pos, NOVAS_CIRS, &app);
+      novas_app_to_hor(&frame, NOVAS_CIRS, app.ra, app.dec, ref, &A, &E);
+
+      if(E < 0.0)
+        continue;
+
+      d = novas_sep(A, E, az[i], el[i]) * 3600.0;
+      if(d > max)
+        max = d;
+    }
+
+    // Single-precision results above the horizon are accurate to ~0.1 arcsec (away from the Sun).
+    sprintf(label, "hor_positions_f32:%d:accuracy", k);
+    if(!is_ok(label, max > 0.2)) n++;
+  }
+
+  if(!is_ok("hor_positions_f32:az_only", novas_hor_positions_f32(&frame, 100, x, y, z, NULL, az, NULL))) n++;
+  if(!is_ok("hor_positions_f32:el_only", novas_hor_positions_f32(&frame, 100, x, y, z, NULL, NULL, el))) n++;
+  if(!is_ok("hor_positions_f32:none", novas_hor_positions_f32(&frame, 0, x, y, z, NULL, az, el))) n++;
+
+  return n;
+}
+
+static int test_fast_accuracy() {
+  int n = 0, i, k;
+  observer obs = OBSERVER_INIT, air = OBSERVER_INIT;
+  const double v[3] = { 0.2, -0.1, 0.01 };
+  object sun = NOVAS_SUN_INIT;
+  double max = 0.0, maxsun = 0.0, maxnut = 0.0;
+
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  make_airborne_observer(&obs.on_surf, v, &air);
+
+  for(k = 0; k < 20; k++) {
+    novas_timespec time = NOVAS_TIMESPEC_INIT;
+    novas_frame fr = NOVAS_FRAME_INIT, ff = NOVAS_FRAME_INIT;
+    const double jd = 2415020.5 + 3652.5 * k + 0.37 * k;
+    double dpsi = 0.0, deps = 0.0, dpsi0 = 0.0, deps0 = 0.0;
+    sky_pos a = SKY_POS_INIT, b = SKY_POS_INIT;
+    char label[80];
+
+    novas_set_time(NOVAS_TT, jd, 37, 0.1, &time);
+
+    sprintf(label, "fast_accuracy:make_frame:%d", k);
+    if(!is_ok(label, novas_make_frame(NOVAS_REDUCED_ACCURACY, (k & 1) ? &air : &obs, &time, 0.0, 0.0, &fr))) return 1;
+    if(!is_ok(label, novas_make_frame(NOVAS_FAST_ACCURACY, (k & 1) ? &air : &obs, &time, 0.0, 0.0, &ff))) return 1;
+
+    for(i = 0; i < 100; i++) {
+      cat_entry star = CAT_ENTRY_INIT;
+      object o = NOVAS_OBJECT_INIT;
+      double d;
+
+      make_cat_entry("test", "TST", i, remainder(1.37 * (i + k), 24.0) + 12.0, asin(2.0 * (i + 0.5) / 100 - 1.0) / DEGREE,
+              -50.0 + i, 30.0 - 0.5 * i, 0.1 * i, 0.0, &star);
+      make_cat_object(&star, &o);
+
+      novas_sky_pos(&o, &fr, NOVAS_TOD, &a);
+      novas_sky_pos(&o, &ff, NOVAS_TOD, &b);
+
+      d = novas_sep(15.0 * a.ra, a.dec, 15.0 * b.ra, b.dec) * 3600.0;
+      if(d > max)
+        max = d;
+    }
+
+    novas_sky_pos(&sun, &fr, NOVAS_TOD, &a);
+    novas_sky_pos(&sun, &ff, NOVAS_TOD, &b);
+    a.dis = novas_sep(15.0 * a.ra, a.dec, 15.0 * b.ra, b.dec) * 3600.0;
+    if(a.dis > maxsun)
+      maxsun = a.dis;
+
+    novas_nutation_fast(jd, 0.0, &dpsi, &deps);
+    iau2000a(jd, 0.0, &dpsi0, &deps0);
+    dpsi = fabs(dpsi - dpsi0) / ARCSEC;
+    deps = fabs(deps - deps0) / ARCSEC;
+    if(dpsi > maxnut)
+      maxnut = dpsi;
+    if(deps > maxnut)
+      maxnut = deps;
+  }
+
+  // Fast calculations are good to ~0.1 arcsec.
+  if(!is_ok("fast_accuracy:stars", max > 0.1)) n++;
+  if(!is_ok("fast_accuracy:sun", maxsun > 0.1)) n++;
+  if(!is_ok("fast_accuracy:nutation", maxnut > 0.06)) n++;
+
+  return n;
+}
+
+// Observable for novas_find_events(): the x pole offset of the frame, without evaluating it.
+static double event_pole_x(const novas_frame *frame, const void *arg) {
+  (void) arg;
+  return frame->dx;
+}
+
+static int test_lazy_frame() {
+  int n = 0, acc;
+  novas_timespec ts = NOVAS_TIMESPEC_INIT;
+  observer obs = OBSERVER_INIT, geo = OBSERVER_INIT;
+  cat_entry star = CAT_ENTRY_INIT;
+  object source = NOVAS_OBJECT_INIT, sun = NOVAS_SUN_INIT;
+
+  enable_earth_sun_hp(1);
+
+  novas_set_time(NOVAS_TDB, tdb, 37, 0.1, &ts);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+  make_observer_at_geocenter(&geo);
+  make_cat_entry("test", "TST", 1, 3.456, 21.7, -10.0, 20.0, 5.0, 12.0, &star);
+  make_cat_object(&star, &source);
+
+  for(acc = NOVAS_FULL_ACCURACY; acc <= NOVAS_FAST_ACCURACY; acc++) {
+    novas_frame frame = NOVAS_FRAME_INIT, lazy = NOVAS_FRAME_INIT;
+    novas_transform T = NOVAS_TRANSFORM_INIT, T1 = NOVAS_TRANSFORM_INIT;
+    sky_pos p = SKY_POS_INIT, p1 = SKY_POS_INIT;
+    double pos[3] = {0.0}, vel[3] = {0.0}, pos1[3] = {0.0}, vel1[3] = {0.0};
+    double az = 0.0, el = 0.0, az1 = 0.0, el1 = 0.0;
+    char label[80];
+
+    sprintf(label, "lazy_frame:%d:make_frame", acc);
+    if(!is_ok(label, novas_make_frame(acc, &obs, &ts, 100.0, -200.0, &frame))) return 1;
+
+    sprintf(label, "lazy_frame:%d:make_lazy_frame", acc);
+    if(!is_ok(label, novas_make_lazy_frame(acc, &obs, &ts, 100.0, -200.0, &lazy))) return 1;
+
+    sprintf(label, "lazy_frame:%d:geom_posvel", acc);
+    if(!is_ok(label, novas_geom_posvel(&source, &lazy, NOVAS_ICRS, pos1, vel1))) n++;
+    novas_geom_posvel(&source, &frame, NOVAS_ICRS, pos, vel);
+    if(!is_ok(label, check_equal_pos(pos, pos1, 1e-12 * novas_vlen(pos)))) n++;
+    if(!is_ok(label, !(lazy.state & FRAME_PLANETS))) n++;
+
+    // For a geocentric observer, geometric ICRS positions of stars require neither Earth
+    // orientation nor planets.
+    sprintf(label, "lazy_frame:%d:geom_posvel:geo", acc);
+    if(!is_ok(label, novas_make_lazy_frame(acc, &geo, &ts, 100.0, -200.0, &lazy))) return 1;
+    if(!is_ok(label, novas_geom_posvel(&source, &lazy, NOVAS_ICRS, pos1, vel1))) n++;
+    if(!is_ok(label, (lazy.state & (FRAME_ORIENTATION | FRAME_PLANETS)) != (FRAME_ORIENTATION | FRAME_PLANETS))) n++;
+
+    if(!is_ok(label, novas_make_lazy_frame(acc, &obs, &ts, 100.0, -200.0, &lazy))) return 1;
+
+    sprintf(label, "lazy_frame:%d:sky_pos", acc);
+    if(!is_ok(label, novas_sky_pos(&source, &lazy, NOVAS_TOD, &p1))) n++;
+    novas_sky_pos(&source, &frame, NOVAS_TOD, &p);
+    if(!is_equal(label, p.ra, p1.ra, 1e-12)) n++;
+    if(!is_equal(label, p.dec, p1.dec, 1e-11)) n++;
+
+    sprintf(label, "lazy_frame:%d:sky_pos:sun", acc);
+    novas_sky_pos(&sun, &frame, NOVAS_ITRS, &p);
+    if(!is_ok(label, novas_sky_pos(&sun, &lazy, NOVAS_ITRS, &p1))) n++;
+    if(!is_equal(label, p.ra, p1.ra, 1e-12)) n++;
+    if(!is_equal(label, p.dec, p1.dec, 1e-11)) n++;
+
+    sprintf(label, "lazy_frame:%d:app_to_hor", acc);
+    novas_app_to_hor(&frame, NOVAS_TOD, p.ra, p.dec, NULL, &az, &el);
+    if(!is_ok(label, novas_app_to_hor(&lazy, NOVAS_TOD, p.ra, p.dec, NULL, &az1, &el1))) n++;
+    if(!is_equal(label, az, az1, 1e-10)) n++;
+    if(!is_equal(label, el, el1, 1e-10)) n++;
+
+    sprintf(label, "lazy_frame:%d:make_transform", acc);
+    novas_make_transform(&frame, NOVAS_ICRS, NOVAS_ITRS, &T);
+    if(!is_ok(label, novas_make_transform(&lazy, NOVAS_ICRS, NOVAS_ITRS, &T1))) n++;
+    if(!is_ok(label, memcmp(&T.matrix, &T1.matrix, sizeof(T.matrix)))) n++;
+
+    sprintf(label, "lazy_frame:%d:lst", acc);
+    if(!is_equal(label, novas_frame_lst(&frame), novas_frame_lst(&lazy), 1e-12)) n++;
+
+    // Changing observer keeps the frame lazy
+    sprintf(label, "lazy_frame:%d:change_observer", acc);
+    if(!is_ok(label, novas_change_observer(&lazy, &geo, &lazy))) n++;
+    if(!is_ok(label, !(lazy.state & FRAME_PLANETS))) n++;
+
+    novas_change_observer(&frame, &geo, &frame);
+    novas_sky_pos(&sun, &frame, NOVAS_GCRS, &p);
+    novas_sky_pos(&sun, &lazy, NOVAS_GCRS, &p1);
+    if(!is_equal(label, p.ra, p1.ra, 1e-12)) n++;
+    if(!is_equal(label, p.dec, p1.dec, 1e-11)) n++;
+
+    sprintf(label, "lazy_frame:%d:evaluate", acc);
+    if(!is_ok(label, novas_make_lazy_frame(acc, &obs, &ts, 100.0, -200.0, &lazy))) n++;
+    if(!is_ok(label, novas_frame_evaluate(&lazy))) n++;
+    if(!is_ok(label, (lazy.state & (FRAME_ORIENTATION | FRAME_DIURNAL_EOP | FRAME_PLANETS)))) n++;
+    if(!is_equal(label, frame.gst, lazy.gst, 1e-12)) n++;
+    if(!is_equal(label, frame.dx, lazy.dx, 1e-12)) n++;
+    if(!is_ok(label, memcmp(&frame.gcrs_to_cirs, &lazy.gcrs_to_cirs, sizeof(frame.gcrs_to_cirs)))) n++;
+
+    sprintf(label, "lazy_frame:%d:find_events", acc);
+    novas_make_frame(acc, &obs, &ts, 100.0, -200.0, &frame);
+    if(!is_ok(label, novas_make_lazy_frame(acc, &obs, &ts, 100.0, -200.0, &lazy))) n++;
+    else {
+      novas_event_finder finder = NOVAS_EVENT_FINDER_INIT;
+      novas_event e[4], e1[4];
+      int i, k;
+
+      // The polar offsets of the frames constructed during the search must not depend on
+      // whether the input frame was already evaluated.
+      finder.func = event_pole_x;
+      finder.types = NOVAS_EVENT_EXTREMUM;
+      finder.step = 0.05;
+
+      k = novas_find_events(&finder, &lazy, 1.0, e1, 4);
+      if(!is_equal(label, k, novas_find_events(&finder, &frame, 1.0, e, 4), 1e-6)) n++;
+      for(i = 0; i < k && i < 4; i++) {
+        novas_frame f1 = NOVAS_FRAME_INIT;
+
+        if(!is_equal(label, e[i].value, e1[i].value, 1e-9)) n++;
+
+        // Same as a frame constructed directly for the time of the event
+        novas_make_frame(acc, &obs, &e[i].time, 100.0, -200.0, &f1);
+        if(!is_equal(label, e[i].value, f1.dx, 1e-9)) n++;
+      }
+    }
+  }
+
+  return n;
+}
+
+static int test_context() {
+  int n = 0, k;
+  novas_context ctx = NOVAS_CONTEXT_INIT;
+  const double jd[2] = { tdb, tdb + 1.234 };
+  const double p0[3] = { 1.0, -2.0, 3.0 };
+  long hits = -1, misses = -1;
+
+  for(k = 0; k < 4; k++) {
+    const double t = jd[k & 1];
+    double dpsi, deps, dpsi1, deps1, ee, ee1, tobl, tobl1, p[3], p1[3];
+    char label[80];
+
+    sprintf(label, "context:%d:nutation_angles", k);
+    nutation_angles((t - NOVAS_JD_J2000) / JULIAN_CENTURY_DAYS, NOVAS_FULL_ACCURACY, &dpsi, &deps);
+    if(!is_ok(label, nutation_angles_ctx(&ctx, (t - NOVAS_JD_J2000) / JULIAN_CENTURY_DAYS, NOVAS_FULL_ACCURACY, &dpsi1, &deps1))) n++;
+    if(!is_equal(label, dpsi, dpsi1, 1e-15)) n++;
+    if(!is_equal(label, deps, deps1, 1e-15)) n++;
+
+    sprintf(label, "context:%d:e_tilt", k);
+    e_tilt(t, NOVAS_REDUCED_ACCURACY, NULL, &tobl, &ee, NULL, NULL);
+    if(!is_ok(label, e_tilt_ctx(&ctx, t, NOVAS_REDUCED_ACCURACY, NULL, &tobl1, &ee1, NULL, NULL))) n++;
+    if(!is_equal(label, tobl, tobl1, 1e-15)) n++;
+    if(!is_equal(label, ee, ee1, 1e-15)) n++;
+
+    sprintf(label, "context:%d:gast", k);
+    if(!is_equal(label, novas_gast(t, 69.184, NOVAS_FULL_ACCURACY), novas_gast_ctx(&ctx, t, 69.184, NOVAS_FULL_ACCURACY), 1e-15)) n++;
+
+    sprintf(label, "context:%d:tt2tdb_hp", k);
+    if(!is_equal(label, tt2tdb_hp(t), tt2tdb_hp_ctx(&ctx, t), 1e-15)) n++;
+
+    sprintf(label, "context:%d:precession", k);
+    precession(NOVAS_JD_J2000, p0, t, p);
+    if(!is_ok(label, precession_ctx(&ctx, NOVAS_JD_J2000, p0, t, p1))) n++;
+    if(!is_ok(label, check_equal_pos(p, p1, 1e-15))) n++;
+    precession(t, p0, NOVAS_JD_B1950, p);
+    if(!is_ok(label, precession_ctx(&ctx, t, p0, NOVAS_JD_B1950, p1))) n++;
+    if(!is_ok(label, check_equal_pos(p, p1, 1e-15))) n++;
+
+    sprintf(label, "context:%d:spin", k);
+    spin(t, p0, p);
+    if(!is_ok(label, spin_ctx(&ctx, t, p0, p1))) n++;
+    if(!is_ok(label, check_equal_pos(p, p1, 1e-15))) n++;
+  }
+
+  // 2 epochs, each calculated once, then reused.
+  if(!is_ok("context:stats:gast", novas_get_cache_stats(&ctx, NOVAS_GAST_CACHE, &hits, &misses))) n++;
+  if(!is_equal("context:stats:gast:hits", hits, 2, 1e-6)) n++;
+  if(!is_equal("context:stats:gast:misses", misses, 2, 1e-6)) n++;
+
+  // e_tilt_ctx() is called explicitly and via novas_gast_ctx() with a different accuracy.
+  if(!is_ok("context:stats:ee_ct", novas_get_cache_stats(&ctx, NOVAS_EE_CT_CACHE, &hits, &misses))) n++;
+  if(!is_equal("context:stats:ee_ct:hits", hits, 2, 1e-6)) n++;
+  if(!is_equal("context:stats:ee_ct:misses", misses, 4, 1e-6)) n++;
+
+  if(!is_ok("context:stats:reset", novas_reset_cache_stats(&ctx))) n++;
+  if(!is_ok("context:stats:reset", novas_get_cache_stats(&ctx, NOVAS_SPIN_CACHE, &hits, &misses))) n++;
+  if(!is_equal("context:stats:reset:hits", hits, 0, 1e-6)) n++;
+  if(!is_equal("context:stats:reset:misses", misses, 0, 1e-6)) n++;
+
+  if(!is_ok("context:init", novas_init_context(&ctx))) n++;
+  if(!is_equal("context:init:size", ctx.cache[NOVAS_TT2TDB_CACHE].size, 0, 1e-6)) n++;
+
+  // Beyond the number of slots, the oldest entries are replaced.
+  for(k = 0; k <= NOVAS_CONTEXT_SLOTS; k++)
+    tt2tdb_hp_ctx(&ctx, tdb + k);
+  tt2tdb_hp_ctx(&ctx, tdb + NOVAS_CONTEXT_SLOTS);
+  tt2tdb_hp_ctx(&ctx, tdb);
+
+  if(!is_ok("context:stats:slots", novas_get_cache_stats(&ctx, NOVAS_TT2TDB_CACHE, &hits, &misses))) n++;
+  if(!is_equal("context:stats:slots:hits", hits, 1, 1e-6)) n++;
+  if(!is_equal("context:stats:slots:misses", misses, NOVAS_CONTEXT_SLOTS + 2, 1e-6)) n++;
+  if(!is_equal("context:stats:slots:size", ctx.cache[NOVAS_TT2TDB_CACHE].size, NOVAS_CONTEXT_SLOTS, 1e-6)) n++;
+
+  return n;
+}
+
+static int test_simd() {
+  int n = 0, i, k;
+  const enum novas_simd max = novas_max_simd();
+  novas_frame frames[2] = { NOVAS_FRAME_INIT, NOVAS_FRAME_INIT };
+  novas_field_transform field;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  float x[1000], y[1000], z[1000], az0[1000], el0[1000], az[1000], el[1000];
+  double dirs[300], gaz0[200], gel0[200], gaz[200], gel[200], dx[100], dy[100], fx0[100], fy0[100], fx[100], fy[100];
+  double tv0[400], tv[400];
+  novas_transform T;
+
+  if(!is_ok("simd:get", novas_get_simd() > max)) n++;
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+
+  for(k = 0; k < 2; k++) {
+    novas_timespec t;
+    novas_offset_time(&time, 3600.0 * k, &t);
+    if(!is_ok("simd:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &t, 0.0, 0.0, &frames[k]))) return 1;
+  }
+
+  if(!is_ok("simd:make_field", novas_make_field_transform(&frames[0], NOVAS_TOD, 21.9, -12.3, 1.0, &field))) return 1;
+
+  for(i = 0; i < 1000; i++) {
+    const double dec = asin(2.0 * (i + 0.5) / 1000 - 1.0), ra = 2.39996 * i;
+    x[i] = (float) (cos(dec) * cos(ra));
+    y[i] = (float) (cos(dec) * sin(ra));
+    z[i] = (float) sin(dec);
+
+    if(i < 100) {
+      dirs[3 * i] = x[i];
+      dirs[3 * i + 1] = y[i];
+      dirs[3 * i + 2] = z[i];
+      dx[i] = 0.01 * cos(ra) * i / 100.0;
+      dy[i] = 0.01 * sin(ra) * i / 100.0;
+    }
+  }
+
+  // Reference results with the scalar kernels
+  if(!is_ok("simd:set:scalar", novas_set_simd(NOVAS_SIMD_SCALAR))) return 1;
+  if(!is_ok("simd:scalar:f32", novas_hor_positions_f32(&frames[0], 1000, x, y, z, novas_standard_refraction, az0, el0))) n++;
+  if(!is_ok("simd:scalar:grid", novas_hor_grid(frames, 2, dirs, 100, 1, NULL, gaz0, gel0, NULL))) n++;
+  if(!is_ok("simd:scalar:field", novas_field_apply_offsets(&field, 100, dx, dy, fx0, fy0))) n++;
+  if(!is_ok("simd:make_transform", novas_make_transform(&frames[0], NOVAS_ICRS, NOVAS_TOD, &T))) return 1;
+  if(!is_ok("simd:scalar:vectors", novas_transform_vectors(dirs, 3, 100, &T, tv0, 4))) n++;
+
+  for(k = NOVAS_SIMD_SSE2; k <= (int) max; k++) {
+    char label[80];
+
+    sprintf(label, "simd:set:%d", k);
+    if(!is_ok(label, novas_set_simd((enum novas_simd) k))) n++;
+    if(!is_ok(label, (int) novas_get_simd() != k)) n++;
+
+    sprintf(label, "simd:f32:%d", k);
+    if(!is_ok(label, novas_hor_positions_f32(&frames[0], 1000, x, y, z, novas_standard_refraction, az, el))) n++;
+    for(i = 0; i < 1000; i++) {
+      if(!is_equal(label, el[i], el0[i], 1e-4)) { n++; break; }
+      if(el[i] > -80.0 && !is_equal(label, remainder(az[i] - az0[i], 360.0), 0.0, 1e-3)) { n++; break; }
+    }
+
+    sprintf(label, "simd:grid:%d", k);
+    if(!is_ok(label, novas_hor_grid(frames, 2, dirs, 100, 1, NULL, gaz, gel, NULL))) n++;
+    for(i = 0; i < 200; i++) {
+      if(!is_equal(label, gel[i], gel0[i], 1e-9)) { n++; break; }
+      if(!is_equal(label, remainder(gaz[i] - gaz0[i], 360.0), 0.0, 1e-6)) { n++; break; }
+    }
+
+    sprintf(label, "simd:field:%d", k);
+    if(!is_ok(label, novas_field_apply_offsets(&field, 100, dx, dy, fx, fy))) n++;
+    for(i = 0; i < 100; i++) {
+      if(!is_equal(label, fx[i], fx0[i], 1e-12)) { n++; break; }
+      if(!is_equal(label, fy[i], fy0[i], 1e-12)) { n++; break; }
+    }
+
+    sprintf(label, "simd:vectors:%d", k);
+    if(!is_ok(label, novas_transform_vectors(dirs, 3, 100, &T, tv, 4))) n++;
+    for(i = 0; i < 100; i++) {
+      if(!is_equal(label, novas_vdist(&tv[4 * i], &tv0[4 * i]), 0.0, 1e-15)) { n++; break; }
+    }
+  }
+
+  novas_set_simd(max);
+
+  return n;
+}
+
+static int test_profile() {
+  int n = 0, i;
+  novas_profile p;
+  novas_frame frame = NOVAS_FRAME_INIT;
+  observer obs = OBSERVER_INIT;
+  novas_timespec time = NOVAS_TIMESPEC_INIT;
+  double pos[3] = { 1e5, -2e5, 3e5 }, az = 0.0, el = 0.0;
+  sky_pos app = SKY_POS_INIT;
+
+  // Skip if built without NOVAS_PROFILE
+  if(novas_get_profile(&p) != 0)
+    return 0;
+
+  novas_set_time(NOVAS_UTC, novas_date("2025-08-20T03:00:00"), 37, 0.0, &time);
+  make_observer_on_surface(40.73, -73.92, 100.0, 10.0, 1010.0, &obs);
+
+  if(!is_ok("profile:reset", novas_reset_profile())) n++;
+  if(!is_ok("profile:make_frame", novas_make_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) return n + 1;
+  if(!is_ok("profile:get", novas_get_profile(&p))) return n + 1;
+
+  if(!is_ok("profile:frame:calls", p.calls[NOVAS_PROFILE_FRAME] != 1)) n++;
+  if(!is_ok("profile:frame:nanos", p.nanos[NOVAS_PROFILE_FRAME] <= 0)) n++;
+  if(!is_ok("profile:ephemeris:calls", p.calls[NOVAS_PROFILE_EPHEMERIS] < 1)) n++;
+  if(!is_ok("profile:light_time:calls", p.calls[NOVAS_PROFILE_LIGHT_TIME] < 1)) n++;
+  if(!is_ok("profile:light_time:iter", p.iterations[NOVAS_LIGHT_TIME_ITERATIONS] < p.calls[NOVAS_PROFILE_LIGHT_TIME])) n++;
+  if(!is_ok("profile:nutation", p.cache_hits[NOVAS_PROFILE_NUTATION_CACHE] + p.cache_misses[NOVAS_PROFILE_NUTATION_CACHE] < 1)) n++;
+  if(!is_ok("profile:deflection:none", p.calls[NOVAS_PROFILE_DEFLECTION] != 0)) n++;
+
+  if(!is_ok("profile:geom_to_app", novas_geom_to_app(&frame, pos, NOVAS_TOD, &app))) n++;
+  if(!is_ok("profile:app_to_hor", novas_app_to_hor(&frame, NOVAS_TOD, app.ra, app.dec, novas_standard_refraction, &az, &el))) n++;
+  if(!is_ok("profile:get:2", novas_get_profile(&p))) return n + 1;
+
+  if(!is_ok("profile:deflection:calls", p.calls[NOVAS_PROFILE_DEFLECTION] < 1)) n++;
+  if(!is_ok("profile:refraction:calls", p.calls[NOVAS_PROFILE_REFRACTION] != 1)) n++;
+
+  if(!is_ok("profile:lazy", novas_make_lazy_frame(NOVAS_REDUCED_ACCURACY, &obs, &time, 0.0, 0.0, &frame))) n++;
+  if(!is_ok("profile:lazy:evaluate", novas_frame_evaluate(&frame))) n++;
+  if(!is_ok("profile:get:3", novas_get_profile(&p))) return n + 1;
+  if(!is_ok("profile:lazy:calls", p.calls[NOVAS_PROFILE_FRAME] != 2)) n++;
+
+  if(!is_ok("profile:reset:2", novas_reset_profile())) n++;
+  if(!is_ok("profile:get:4", novas_get_profile(&p))) return n + 1;
+
+  for(i = 0; i < NOVAS_PROFILE_STAGES; i++)
+    if(!is_ok("profile:reset:check", p.calls[i] != 0 || p.nanos[i] != 0)) n++;
+
+  return n;
+}
+
 int main(int argc, char *argv[]) {
   int n = 0;
 
@@ -5079,6 +6973,37 @@ int main(int argc, char *argv[]) {
 
   if(test_enu_itrs()) n++;
 
+  // v1.6
+  if(test_find_events_sun()) n++;
+  if(test_find_events_moon_phase()) n++;
+  if(test_find_events_conjunction()) n++;
+
+  n += test_hor_grid();
+  n += test_airmass();
+  n += test_sky_index();
+  n += test_xmatch();
+  n += test_star_catalog();
+  n += test_parse_radec_table();
+  n += test_parse_iso_times();
+  n += test_iso_timestamps();
+  n += test_leap_seconds();
+  n += test_unix_to_jd();
+  n += test_eop_table();
+  n += test_diurnal_eop_table();
+  n += test_tdb_table();
+  n += test_ns_time();
+  n += test_sidereal_clock();
+  n += test_transform_vectors();
+  n += test_hor_to_app_array();
+  n += test_app_to_geom_array();
+  n += test_itrs_pole_offsets();
+  n += test_field_transform();
+  n += test_hor_positions_f32();
+  n += test_fast_accuracy();
+  n += test_lazy_frame();
+  n += test_context();
+  n += test_simd();
+  n += test_profile();
   n += test_dates();
 
   if(n) fprintf(stderr, " -- FAILED %d tests\n", n);